@@ -19,6 +19,7 @@
 // Common includes
 //
 
+#include <mutex>
 #include <logging/logger.h>
 
 
@@ -77,6 +78,14 @@ namespace gui {
 
       namespace {
         double scale_factor = 1.0;
+
+        std::mutex listener_guard;
+
+        std::vector<scale_factor_listener>& get_scale_factor_listeners () {
+          // lazy create static
+          static std::vector<scale_factor_listener> listeners;
+          return listeners;
+        }
       }
 
       void info (gui::os::instance i) {
@@ -93,6 +102,19 @@ namespace gui {
 
       void set_scale_factor (double s) {
         scale_factor = s;
+        std::vector<scale_factor_listener> listeners;
+        {
+          std::lock_guard<std::mutex> lock(listener_guard);
+          listeners = get_scale_factor_listeners();
+        }
+        for (const auto& l : listeners) {
+          l(s);
+        }
+      }
+
+      void add_scale_factor_listener (scale_factor_listener l) {
+        std::lock_guard<std::mutex> lock(listener_guard);
+        get_scale_factor_listeners().push_back(std::move(l));
       }
 
       double get_scale_factor () {
@@ -36,6 +36,7 @@
 #error Unknown target system in guidefs.h
 #endif // GUIPP_QT
 
+#include <functional>
 #include <string>
 #include <vector>
 #include <logging/logger.h>
@@ -259,6 +260,11 @@ namespace gui {
       GUIPP_CORE_EXPORT double get_scale_factor ();
       GUIPP_CORE_EXPORT void set_scale_factor (double);
 
+      typedef std::function<void(double)> scale_factor_listener;
+
+      /// Listeners are called with the new factor on each set_scale_factor, init included.
+      GUIPP_CORE_EXPORT void add_scale_factor_listener (scale_factor_listener);
+
       template<typename R, typename T>
       inline typename std::enable_if<std::is_signed<R>::value && !std::is_floating_point<R>::value, R>::type
       scale_from_native (const T& v) {
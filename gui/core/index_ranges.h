@@ -0,0 +1,115 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     set of indices stored as sorted disjoint ranges
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <vector>
+#include <iterator>
+#include <initializer_list>
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include "gui/core/range.h"
+
+
+namespace gui {
+
+  namespace core {
+
+    // --------------------------------------------------------------------------
+    /**
+     * Set of non negative indices, stored as sorted, disjoint and non adjacent
+     * ranges [begin, end). Inserting a range merges it with its neighbours,
+     * so selecting all or a large block is a single range regardless of its size.
+     */
+    class index_ranges {
+    public:
+      typedef core::range<int> range_type;
+      typedef std::vector<range_type> ranges_type;
+
+      // --------------------------------------------------------------------------
+      struct iterator {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const int*;
+        using reference = int;
+
+        iterator ();
+        iterator (const ranges_type* ranges, std::size_t r);
+
+        iterator& operator++ ();
+        iterator operator++ (int);
+
+        bool operator== (const iterator& other) const;
+        bool operator!= (const iterator& other) const;
+
+        int operator* () const;
+
+      private:
+        const ranges_type* ranges;
+        std::size_t r;
+        int idx;
+      };
+
+      // --------------------------------------------------------------------------
+      index_ranges ();
+      index_ranges (std::initializer_list<int> indices);
+
+      template<typename I>
+      index_ranges (I first, I last);
+
+      bool contains (int i) const;
+
+      /// Insert all indices from first to last, including both.
+      void insert (int first, int last);
+      void insert (int i);
+
+      void erase (int i);
+      void clear ();
+
+      bool empty () const;
+      std::size_t size () const;
+
+      int front () const;
+      int back () const;
+
+      iterator begin () const;
+      iterator end () const;
+
+      const ranges_type& get_ranges () const;
+
+      bool operator== (const index_ranges& other) const;
+      bool operator!= (const index_ranges& other) const;
+
+    private:
+      ranges_type::const_iterator find (int i) const;
+
+      ranges_type ranges;
+      std::size_t count;
+    };
+
+  } // namespace core
+
+} // namespace gui
+
+#include "gui/core/index_ranges.inl"
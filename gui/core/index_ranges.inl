@@ -0,0 +1,199 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     set of indices stored as sorted disjoint ranges
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <algorithm>
+
+
+namespace gui {
+
+  namespace core {
+
+    // --------------------------------------------------------------------------
+    inline index_ranges::iterator::iterator ()
+      : ranges(nullptr)
+      , r(0)
+      , idx(0)
+    {}
+
+    inline index_ranges::iterator::iterator (const ranges_type* ranges, std::size_t r)
+      : ranges(ranges)
+      , r(r)
+      , idx(r < ranges->size() ? (*ranges)[r].begin() : 0)
+    {}
+
+    inline auto index_ranges::iterator::operator++ () -> iterator& {
+      if (++idx >= (*ranges)[r].end()) {
+        ++r;
+        idx = r < ranges->size() ? (*ranges)[r].begin() : 0;
+      }
+      return *this;
+    }
+
+    inline auto index_ranges::iterator::operator++ (int) -> iterator {
+      iterator retval = *this;
+      operator++();
+      return retval;
+    }
+
+    inline bool index_ranges::iterator::operator== (const iterator& other) const {
+      return (r == other.r) && (idx == other.idx);
+    }
+
+    inline bool index_ranges::iterator::operator!= (const iterator& other) const {
+      return !operator==(other);
+    }
+
+    inline int index_ranges::iterator::operator* () const {
+      return idx;
+    }
+
+    // --------------------------------------------------------------------------
+    inline index_ranges::index_ranges ()
+      : count(0)
+    {}
+
+    inline index_ranges::index_ranges (std::initializer_list<int> indices)
+      : index_ranges(indices.begin(), indices.end())
+    {}
+
+    template<typename I>
+    index_ranges::index_ranges (I first, I last)
+      : count(0)
+    {
+      for (; first != last; ++first) {
+        insert(*first);
+      }
+    }
+
+    inline auto index_ranges::find (int i) const -> ranges_type::const_iterator {
+      // first range ending behind i.
+      return std::upper_bound(ranges.begin(), ranges.end(), i, [] (int i, const range_type& r) {
+        return i < r.end();
+      });
+    }
+
+    inline bool index_ranges::contains (int i) const {
+      if (ranges.size() == 1) {
+        // common case of one block, e.g. after select all.
+        return (ranges.front().begin() <= i) && (i < ranges.front().end());
+      }
+      auto it = find(i);
+      return (it != ranges.end()) && (it->begin() <= i);
+    }
+
+    inline void index_ranges::insert (int first, int last) {
+      if (last < first) {
+        return;
+      }
+      int b = first;
+      int e = last + 1;
+      // all ranges touching or overlapping [b, e) are merged into one.
+      auto lo = std::lower_bound(ranges.begin(), ranges.end(), b, [] (const range_type& r, int b) {
+        return r.end() < b;
+      });
+      auto hi = lo;
+      std::size_t merged = 0;
+      while ((hi != ranges.end()) && (hi->begin() <= e)) {
+        b = std::min(b, hi->begin());
+        e = std::max(e, hi->end());
+        merged += hi->end() - hi->begin();
+        ++hi;
+      }
+      count += (e - b) - merged;
+      if (lo == hi) {
+        ranges.insert(lo, range_type(b, e));
+      } else {
+        *lo = range_type(b, e);
+        ranges.erase(lo + 1, hi);
+      }
+    }
+
+    inline void index_ranges::insert (int i) {
+      insert(i, i);
+    }
+
+    inline void index_ranges::erase (int i) {
+      auto it = ranges.begin() + (find(i) - ranges.cbegin());
+      if ((it == ranges.end()) || (it->begin() > i)) {
+        return;
+      }
+      const auto b = it->begin();
+      const auto e = it->end();
+      --count;
+      if (b == i) {
+        if (e == i + 1) {
+          ranges.erase(it);
+        } else {
+          *it = range_type(i + 1, e);
+        }
+      } else if (e == i + 1) {
+        *it = range_type(b, i);
+      } else {
+        *it = range_type(i + 1, e);
+        ranges.insert(it, range_type(b, i));
+      }
+    }
+
+    inline void index_ranges::clear () {
+      ranges.clear();
+      count = 0;
+    }
+
+    inline bool index_ranges::empty () const {
+      return ranges.empty();
+    }
+
+    inline std::size_t index_ranges::size () const {
+      return count;
+    }
+
+    inline int index_ranges::front () const {
+      return ranges.front().begin();
+    }
+
+    inline int index_ranges::back () const {
+      return ranges.back().end() - 1;
+    }
+
+    inline auto index_ranges::begin () const -> iterator {
+      return iterator(&ranges, 0);
+    }
+
+    inline auto index_ranges::end () const -> iterator {
+      return iterator(&ranges, ranges.size());
+    }
+
+    inline auto index_ranges::get_ranges () const -> const ranges_type& {
+      return ranges;
+    }
+
+    inline bool index_ranges::operator== (const index_ranges& other) const {
+      return ranges == other.ranges;
+    }
+
+    inline bool index_ranges::operator!= (const index_ranges& other) const {
+      return ranges != other.ranges;
+    }
+
+  } // namespace core
+
+} // namespace gui
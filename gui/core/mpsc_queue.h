@@ -0,0 +1,69 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     lock free bounded multi producer single consumer queue
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+
+namespace gui {
+
+  namespace core {
+
+    // --------------------------------------------------------------------------
+    /**
+     * Fixed size queue for any number of producer threads and one consumer thread.
+     * Each slot carries a sequence number, so producers only contend on the head index.
+     * N must be a power of two.
+     */
+    template<typename T, std::size_t N>
+    class mpsc_queue {
+    public:
+      static_assert((N & (N - 1)) == 0, "mpsc_queue size must be a power of two");
+
+      typedef T value_type;
+      static constexpr std::size_t capacity = N;
+
+      mpsc_queue ();
+
+      /// Producer: returns false if the queue is full.
+      bool push (const T& v);
+
+      /// Consumer: returns false if the queue is empty.
+      bool pop (T& out);
+
+    private:
+      struct cell {
+        std::atomic<std::size_t> sequence;
+        T data;
+      };
+
+      std::array<cell, N> cells;
+      alignas(64) std::atomic<std::size_t> head;   // shared by the producers
+      alignas(64) std::size_t tail;                // consumer only
+    };
+
+  } // namespace core
+
+} // namespace gui
+
+#include "gui/core/mpsc_queue.inl"
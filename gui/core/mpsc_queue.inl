@@ -0,0 +1,80 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     lock free bounded multi producer single consumer queue
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <cstdint>
+#include <utility>
+
+
+namespace gui {
+
+  namespace core {
+
+    // --------------------------------------------------------------------------
+    template<typename T, std::size_t N>
+    mpsc_queue<T, N>::mpsc_queue ()
+      : head(0)
+      , tail(0)
+    {
+      for (std::size_t i = 0; i < N; ++i) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+      }
+    }
+
+    template<typename T, std::size_t N>
+    bool mpsc_queue<T, N>::push (const T& v) {
+      std::size_t pos = head.load(std::memory_order_relaxed);
+      for (;;) {
+        cell& c = cells[pos & (N - 1)];
+        const std::size_t seq = c.sequence.load(std::memory_order_acquire);
+        const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+        if (diff == 0) {
+          if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+            c.data = v;
+            c.sequence.store(pos + 1, std::memory_order_release);
+            return true;
+          }
+        } else if (diff < 0) {
+          // the consumer has not yet released this slot.
+          return false;
+        } else {
+          pos = head.load(std::memory_order_relaxed);
+        }
+      }
+    }
+
+    template<typename T, std::size_t N>
+    bool mpsc_queue<T, N>::pop (T& out) {
+      cell& c = cells[tail & (N - 1)];
+      if (c.sequence.load(std::memory_order_acquire) != tail + 1) {
+        return false;
+      }
+      out = std::move(c.data);
+      // release captured resources now, not when the slot is reused.
+      c.data = T();
+      c.sequence.store(tail + N, std::memory_order_release);
+      ++tail;
+      return true;
+    }
+
+  } // namespace core
+
+} // namespace gui
@@ -0,0 +1,75 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     coalesced update request that is safe against its owner's destruction
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <atomic>
+#include <functional>
+#include <memory>
+
+
+namespace gui {
+
+  namespace core {
+
+    // --------------------------------------------------------------------------
+    /**
+     * Request flag for updates posted to an other thread.
+     * Only the first request posts an update, further requests are coalesced
+     * until the update runs. Posted updates are bound to a shared state, they
+     * do nothing after the pending_update was destroyed.
+     */
+    class pending_update {
+    public:
+      typedef std::function<void()> action_t;
+
+      pending_update ();
+      ~pending_update ();
+
+      pending_update (const pending_update&) = delete;
+      pending_update& operator= (const pending_update&) = delete;
+
+      /// Any thread: returns true if the caller has to post an update.
+      bool request ();
+
+      /// Withdraw a request that could not be posted.
+      void cancel ();
+
+      bool is_pending () const;
+
+      /// The action to post, it resets the request and calls f while this exists.
+      action_t bind (action_t f) const;
+
+    private:
+      struct state {
+        state ();
+
+        std::atomic_bool pending;
+        std::atomic_bool alive;
+      };
+
+      std::shared_ptr<state> s;
+    };
+
+  } // namespace core
+
+} // namespace gui
+
+#include "gui/core/pending_update.inl"
@@ -0,0 +1,64 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     coalesced update request that is safe against its owner's destruction
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+
+namespace gui {
+
+  namespace core {
+
+    // --------------------------------------------------------------------------
+    inline pending_update::state::state ()
+      : pending(false)
+      , alive(true)
+    {}
+
+    // --------------------------------------------------------------------------
+    inline pending_update::pending_update ()
+      : s(std::make_shared<state>())
+    {}
+
+    inline pending_update::~pending_update () {
+      s->alive = false;
+    }
+
+    inline bool pending_update::request () {
+      return !s->pending.exchange(true);
+    }
+
+    inline void pending_update::cancel () {
+      s->pending = false;
+    }
+
+    inline bool pending_update::is_pending () const {
+      return s->pending;
+    }
+
+    inline auto pending_update::bind (action_t f) const -> action_t {
+      std::shared_ptr<state> st = s;
+      return [st, f] () {
+        if (st->alive) {
+          // reset first, a request during f posts the next update.
+          st->pending = false;
+          f();
+        }
+      };
+    }
+
+  } // namespace core
+
+} // namespace gui
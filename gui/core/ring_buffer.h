@@ -0,0 +1,69 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     lock free single producer single consumer ring buffer
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+
+namespace gui {
+
+  namespace core {
+
+    // --------------------------------------------------------------------------
+    /**
+     * Fixed size ring buffer for one producer and one consumer thread.
+     * N must be a power of two.
+     */
+    template<typename T, std::size_t N>
+    class ring_buffer {
+    public:
+      static_assert((N & (N - 1)) == 0, "ring_buffer size must be a power of two");
+
+      typedef T value_type;
+      static constexpr std::size_t capacity = N;
+
+      ring_buffer ();
+
+      /// Producer: returns false if the buffer is full.
+      bool push (const T& v);
+
+      /// Producer: returns the number of values that did fit into the buffer.
+      std::size_t push (const T* data, std::size_t count);
+
+      /// Consumer: returns the number of values copied to out.
+      std::size_t pop (T* out, std::size_t max);
+
+      std::size_t size () const;
+      bool empty () const;
+
+    private:
+      std::array<T, N> buffer;
+      alignas(64) std::atomic<std::size_t> head;   // written by producer
+      alignas(64) std::atomic<std::size_t> tail;   // written by consumer
+    };
+
+  } // namespace core
+
+} // namespace gui
+
+#include "gui/core/ring_buffer.inl"
@@ -0,0 +1,78 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     lock free single producer single consumer ring buffer
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <algorithm>
+
+
+namespace gui {
+
+  namespace core {
+
+    // --------------------------------------------------------------------------
+    template<typename T, std::size_t N>
+    inline ring_buffer<T, N>::ring_buffer ()
+      : head(0)
+      , tail(0)
+    {}
+
+    template<typename T, std::size_t N>
+    inline bool ring_buffer<T, N>::push (const T& v) {
+      return push(&v, 1) == 1;
+    }
+
+    template<typename T, std::size_t N>
+    std::size_t ring_buffer<T, N>::push (const T* data, std::size_t count) {
+      const std::size_t h = head.load(std::memory_order_relaxed);
+      const std::size_t t = tail.load(std::memory_order_acquire);
+      const std::size_t n = std::min(count, N - (h - t));
+      for (std::size_t i = 0; i < n; ++i) {
+        buffer[(h + i) & (N - 1)] = data[i];
+      }
+      head.store(h + n, std::memory_order_release);
+      return n;
+    }
+
+    template<typename T, std::size_t N>
+    std::size_t ring_buffer<T, N>::pop (T* out, std::size_t max) {
+      const std::size_t t = tail.load(std::memory_order_relaxed);
+      const std::size_t h = head.load(std::memory_order_acquire);
+      const std::size_t n = std::min(max, h - t);
+      for (std::size_t i = 0; i < n; ++i) {
+        out[i] = buffer[(t + i) & (N - 1)];
+      }
+      tail.store(t + n, std::memory_order_release);
+      return n;
+    }
+
+    template<typename T, std::size_t N>
+    inline std::size_t ring_buffer<T, N>::size () const {
+      return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    template<typename T, std::size_t N>
+    inline bool ring_buffer<T, N>::empty () const {
+      return size() == 0;
+    }
+
+  } // namespace core
+
+} // namespace gui
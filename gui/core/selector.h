@@ -20,7 +20,7 @@
 //
 // Common includes
 //
-#include <set>
+#include <iterator>
 
 
 // --------------------------------------------------------------------------
@@ -28,6 +28,7 @@
 // Library includes
 //
 #include "gui/core/gui++-core-export.h"
+#include "gui/core/index_ranges.h"
 
 
 namespace gui {
@@ -158,15 +159,15 @@ namespace gui {
 
       // --------------------------------------------------------------------------
       struct multi {
-        typedef std::set<int> selection_type;
-        typedef selection_type::const_iterator iterator;
+        typedef index_ranges selection_type;
+        typedef selection_type::iterator iterator;
 
         inline multi ()
           : last_selected_index(-1)
         {}
 
         inline bool is_selected (int i) const {
-          return selection.find(i) != selection.end();
+          return selection.contains(i);
         }
 
         inline void set_selected (int i) {
@@ -192,9 +193,7 @@ namespace gui {
         }
 
         inline void select_range (int from, int to) {
-          for (int i = from; i <= to; ++i) {
-            selection.insert(selection.end(), i);
-          }
+          selection.insert(from, to);
           last_selected_index = to;
         }
 
@@ -213,11 +212,11 @@ namespace gui {
         }
 
         inline int get_first_index () const {
-          return selection.empty() ? 0 : *begin();
+          return selection.empty() ? 0 : selection.front();
         }
 
         inline int get_last_index () const {
-          return selection.empty() ? 0 : *selection.rbegin();
+          return selection.empty() ? 0 : selection.back();
         }
 
         inline int get_last_selected_index () const {
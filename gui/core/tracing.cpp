@@ -0,0 +1,263 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     timed trace spans with chrome trace-event export
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include "gui/core/tracing.h"
+
+
+namespace gui {
+
+  namespace core {
+
+    namespace tracing {
+
+      namespace {
+
+        std::atomic_bool enabled(false);
+
+        // --------------------------------------------------------------------------
+        // One record in the ring buffer. seq is the record number + 1 when the
+        // slot is complete and 0 while it is written, so a reader can detect a
+        // slot that is overwritten while it reads it.
+        struct slot {
+          slot ()
+            : seq(0)
+            , name(nullptr)
+            , id(nullptr)
+            , begin(0)
+            , end(0)
+            , cat(category::event)
+          {}
+
+          std::atomic<std::uint64_t> seq;
+          std::atomic<const char*> name;
+          std::atomic<const void*> id;
+          std::atomic<std::uint64_t> begin;
+          std::atomic<std::uint64_t> end;
+          std::atomic<category> cat;
+        };
+
+        // --------------------------------------------------------------------------
+        // Single producer ring buffer, only the owning thread writes to it.
+        struct thread_buffer {
+          static constexpr std::size_t capacity = buffer_capacity;
+
+          explicit thread_buffer (std::size_t tid)
+            : head(0)
+            , start(0)
+            , tid(tid)
+            , finished(false)
+          {}
+
+          // a finished buffer without records to export can be handed to a new thread.
+          bool is_unused () const {
+            return finished.load(std::memory_order_acquire) &&
+                   (start.load(std::memory_order_acquire) == head.load(std::memory_order_acquire));
+          }
+
+          void reuse (std::size_t new_tid) {
+            tid.store(new_tid, std::memory_order_relaxed);
+            finished.store(false, std::memory_order_release);
+          }
+
+          void push (const span_record& r) {
+            const auto h = head.load(std::memory_order_relaxed);
+            slot& s = slots[h & (capacity - 1)];
+            s.seq.store(0, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            s.name.store(r.name, std::memory_order_relaxed);
+            s.id.store(r.id, std::memory_order_relaxed);
+            s.begin.store(r.begin, std::memory_order_relaxed);
+            s.end.store(r.end, std::memory_order_relaxed);
+            s.cat.store(r.cat, std::memory_order_relaxed);
+            s.seq.store(h + 1, std::memory_order_release);
+            head.store(h + 1, std::memory_order_release);
+          }
+
+          // Read record i, returns false if it is overwritten meanwhile.
+          bool read (std::uint64_t i, span_record& r) const {
+            const slot& s = slots[i & (capacity - 1)];
+            if (s.seq.load(std::memory_order_acquire) != i + 1) {
+              return false;
+            }
+            r.name = s.name.load(std::memory_order_relaxed);
+            r.id = s.id.load(std::memory_order_relaxed);
+            r.begin = s.begin.load(std::memory_order_relaxed);
+            r.end = s.end.load(std::memory_order_relaxed);
+            r.cat = s.cat.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            return s.seq.load(std::memory_order_relaxed) == i + 1;
+          }
+
+          std::array<slot, capacity> slots;
+          std::atomic<std::uint64_t> head;
+          // first record to export, moved by clear from any thread.
+          std::atomic<std::uint64_t> start;
+          std::atomic<std::size_t> tid;
+          // set when the owning thread has exited.
+          std::atomic_bool finished;
+        };
+
+        typedef std::shared_ptr<thread_buffer> thread_buffer_ptr;
+
+        /// Unused buffers kept for new threads, the others are freed.
+        constexpr std::size_t max_spare_buffers = 4;
+
+        // Buffers are kept after their thread has finished, to allow a later export.
+        // Once their records are exported or cleared, they are recycled.
+        std::mutex registry_guard;
+        std::vector<thread_buffer_ptr> registry;
+        std::vector<thread_buffer_ptr> spare;
+        std::size_t next_tid = 1;
+
+        // registry_guard must be locked.
+        void collect_unused () {
+          auto i = std::stable_partition(registry.begin(), registry.end(), [] (const thread_buffer_ptr& b) {
+            return !b->is_unused();
+          });
+          for (auto j = i; (j != registry.end()) && (spare.size() < max_spare_buffers); ++j) {
+            spare.push_back(*j);
+          }
+          registry.erase(i, registry.end());
+        }
+
+        // marks the buffer as finished when the thread exits.
+        struct thread_owner {
+          ~thread_owner () {
+            if (buffer) {
+              buffer->finished.store(true, std::memory_order_release);
+            }
+          }
+
+          thread_buffer_ptr buffer;
+        };
+
+        thread_buffer& get_thread_buffer () {
+          thread_local thread_owner owner;
+          if (!owner.buffer) {
+            std::lock_guard<std::mutex> lock(registry_guard);
+            collect_unused();
+            if (spare.empty()) {
+              owner.buffer = std::make_shared<thread_buffer>(next_tid);
+            } else {
+              owner.buffer = spare.back();
+              spare.pop_back();
+              owner.buffer->reuse(next_tid);
+            }
+            ++next_tid;
+            registry.push_back(owner.buffer);
+          }
+          return *owner.buffer;
+        }
+
+      }
+
+      // --------------------------------------------------------------------------
+      const char* category_name (category c) {
+        switch (c) {
+          case category::event:   return "event";
+          case category::layout:  return "layout";
+          case category::paint:   return "paint";
+          case category::present: return "present";
+          case category::action:  return "action";
+        }
+        return "unknown";
+      }
+
+      void set_enabled (bool e) {
+        enabled.store(e, std::memory_order_relaxed);
+      }
+
+      bool is_enabled () {
+        return enabled.load(std::memory_order_relaxed);
+      }
+
+      std::uint64_t now () {
+        const auto t = std::chrono::steady_clock::now().time_since_epoch();
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(t).count());
+      }
+
+      void record (const span_record& r) {
+        get_thread_buffer().push(r);
+      }
+
+      void write_chrome_trace (std::ostream& out) {
+        std::vector<thread_buffer_ptr> buffers;
+        {
+          std::lock_guard<std::mutex> lock(registry_guard);
+          buffers = registry;
+        }
+
+        out << "{\"traceEvents\":[";
+        bool first = true;
+        for (const auto& b : buffers) {
+          const auto head = b->head.load(std::memory_order_acquire);
+          const auto count = std::min<std::uint64_t>(head, thread_buffer::capacity);
+          const auto start = std::max(head - count, b->start.load(std::memory_order_acquire));
+          span_record r;
+          for (auto i = start; i < head; ++i) {
+            if (!b->read(i, r)) {
+              continue;
+            }
+            if (!first) {
+              out << ',';
+            }
+            first = false;
+            out << "\n{\"name\":\"" << r.name
+                << "\",\"cat\":\"" << category_name(r.cat)
+                << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << b->tid.load(std::memory_order_relaxed)
+                << ",\"ts\":" << (r.begin / 1000) << '.' << (r.begin % 1000 / 100)
+                << ",\"dur\":" << ((r.end - r.begin) / 1000) << '.' << ((r.end - r.begin) % 1000 / 100)
+                << ",\"args\":{\"id\":\"" << r.id << "\"}}";
+          }
+        }
+        out << "\n],\"displayTimeUnit\":\"ms\"}\n";
+      }
+
+      void clear () {
+        std::lock_guard<std::mutex> lock(registry_guard);
+        for (auto& b : registry) {
+          b->start.store(b->head.load(std::memory_order_acquire), std::memory_order_release);
+        }
+        collect_unused();
+      }
+
+      std::size_t buffer_count () {
+        std::lock_guard<std::mutex> lock(registry_guard);
+        return registry.size();
+      }
+
+    } // namespace tracing
+
+  } // namespace core
+
+} // namespace gui
@@ -0,0 +1,121 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     timed trace spans with chrome trace-event export
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include "gui/core/gui++-core-export.h"
+
+
+namespace gui {
+
+  namespace core {
+
+    namespace tracing {
+
+      // --------------------------------------------------------------------------
+      enum class category : std::uint8_t {
+        event,
+        layout,
+        paint,
+        present,
+        action
+      };
+
+      GUIPP_CORE_EXPORT const char* category_name (category);
+
+      // --------------------------------------------------------------------------
+      struct span_record {
+        const char* name;
+        const void* id;
+        std::uint64_t begin;
+        std::uint64_t end;
+        category cat;
+      };
+
+      /// Records kept per thread, older ones are overwritten.
+      constexpr std::size_t buffer_capacity = 8192;
+
+      // --------------------------------------------------------------------------
+      GUIPP_CORE_EXPORT void set_enabled (bool);
+      GUIPP_CORE_EXPORT bool is_enabled ();
+
+      GUIPP_CORE_EXPORT std::uint64_t now ();
+
+      /// Append a record to the ring buffer of the calling thread.
+      GUIPP_CORE_EXPORT void record (const span_record&);
+
+      /// Write all buffered records as chrome trace-event json (chrome://tracing, perfetto).
+      GUIPP_CORE_EXPORT void write_chrome_trace (std::ostream&);
+
+      /// Drop all buffered records and recycle the buffers of finished threads.
+      GUIPP_CORE_EXPORT void clear ();
+
+      /// Number of thread buffers in use, including finished threads with records to export.
+      GUIPP_CORE_EXPORT std::size_t buffer_count ();
+
+      // --------------------------------------------------------------------------
+      class span {
+      public:
+        inline span (category cat, const char* name, const void* id = nullptr)
+          : name(name)
+          , id(id)
+          , begin(is_enabled() ? now() : 0)
+          , cat(cat)
+        {}
+
+        inline ~span () {
+          if (begin) {
+            record({name, id, begin, now(), cat});
+          }
+        }
+
+        span (const span&) = delete;
+        span& operator= (const span&) = delete;
+
+      private:
+        const char* name;
+        const void* id;
+        const std::uint64_t begin;
+        const category cat;
+      };
+
+    } // namespace tracing
+
+  } // namespace core
+
+} // namespace gui
+
+#define GUIPP_TRACE_CONCAT_IMPL(a, b) a ## b
+#define GUIPP_TRACE_CONCAT(a, b) GUIPP_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef GUIPP_USE_TRACE
+# define GUIPP_TRACE_SPAN(cat, name, id) \
+  gui::core::tracing::span GUIPP_TRACE_CONCAT(guipp_trace_span_, __LINE__)(gui::core::tracing::category::cat, name, id)
+#else
+# define GUIPP_TRACE_SPAN(cat, name, id)
+#endif // GUIPP_USE_TRACE
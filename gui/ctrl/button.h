@@ -35,6 +35,7 @@
 #include "gui/layout/layout_container.h"
 #include "gui/draw/pen.h"
 #include "gui/draw/icons.h"
+#include "gui/draw/icon_cache.h"
 
 
 namespace gui {
@@ -222,7 +222,7 @@ namespace gui {
       super::on_paint(draw::paint([&] (draw::graphics& g) {
         const auto r = super::client_geometry();
         const auto st = super::get_state();
-        g.frame(draw::icon_t<I>(r.center(), r.max_radius() * 2 / 3),
+        g.frame(draw::cached_icon_t<I>(r.center(), r.max_radius() * 2 / 3),
                 look::get_flat_button_foreground(st, super::get_foreground(), super::get_background()));
       }));
     }
@@ -265,7 +265,7 @@ namespace gui {
       super::on_paint(draw::paint([&] (draw::graphics& g) {
         const auto r = super::client_geometry();
         const auto st = super::get_state();
-        g.frame(draw::icon(icon, r.center(), r.max_radius() * 2 / 3),
+        g.frame(draw::cached_icon(icon, r.center(), r.max_radius() * 2 / 3),
                 look::get_flat_button_foreground(st, super::get_foreground(), super::get_background()));
       }));
     }
@@ -14,6 +14,12 @@
  * @license   MIT license. See accompanying file LICENSE.
  */
 
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <algorithm>
+
 // --------------------------------------------------------------------------
 //
 // Library includes
@@ -27,23 +33,35 @@ namespace gui {
 
     namespace detail {
       // --------------------------------------------------------------------------
-      column_size_type column_list_layout::get_column_left_pos (std::size_t i) const {
-        column_size_type w = 0;
-        for (decltype(i) j = 0; j < i; ++j) {
-          w += get_column_width(j);
+      const std::vector<column_size_type>& column_list_layout::get_offsets () const {
+        if (offsets.size() != widths.size() + 1) {
+          offsets.resize(widths.size() + 1);
+          offsets[0] = 0;
+          for (std::size_t j = 0; j < widths.size(); ++j) {
+            offsets[j + 1] = offsets[j] + widths[j];
+          }
         }
-        return w;
+        return offsets;
+      }
+
+      void column_list_layout::widths_changed () {
+        offsets.clear();
+      }
+
+      column_size_type column_list_layout::get_column_left_pos (std::size_t i) const {
+        const auto& o = get_offsets();
+        return o[std::min(i, o.size() - 1)];
       }
 
       int column_list_layout::index_at (core::point::type pt) const {
-        core::point::type pos = 0;
-        int idx = 0;
-        const auto max_idx = get_column_count();
-        while ((pos <= pt) && (idx < max_idx)) {
-          pos += get_column_width(idx);
-          ++idx;
+        const auto max_idx = static_cast<int>(get_column_count());
+        if ((max_idx == 0) || (pt < 0)) {
+          return -1;
         }
-        return idx - 1;
+        // first column whose right border is behind pt, or the last column.
+        const auto& o = get_offsets();
+        const auto i = std::upper_bound(o.begin() + 1, o.end(), pt) - (o.begin() + 1);
+        return std::min(static_cast<int>(i), max_idx - 1);
       }
 
       int column_list_layout::split_idx_at (core::point::type pt, core::size::type delta) const {
@@ -76,6 +94,7 @@ namespace gui {
       void column_list_layout::set_column_count (std::size_t i) {
         widths.resize(i);
         aligns.resize(i);
+        widths_changed();
       }
 
       void column_list_layout::set_columns (const std::vector<column_info>& infos, bool update) {
@@ -87,6 +106,7 @@ namespace gui {
           widths[idx] = i.width;
           ++idx;
         }
+        widths_changed();
         if (update) {
           redraw_views();
         }
@@ -95,6 +115,7 @@ namespace gui {
       void column_list_layout::set_column_width (std::size_t i, column_size_type w, bool update) {
         if (widths[i] != w) {
           widths[i] = w;
+          widths_changed();
           if (update) {
             redraw_views();
           }
@@ -123,6 +144,7 @@ namespace gui {
         for (column_size_type& width  : widths) {
           width = w;
         }
+        widths_changed();
       }
 
       void column_list_layout::set_default_align (text_origin_t a) {
@@ -153,6 +175,7 @@ namespace gui {
         min_widths[idx] = i.min_width;
         ++idx;
       }
+      widths_changed();
       if (update) {
         redraw_views();
       }
@@ -175,6 +198,7 @@ namespace gui {
         weights[idx] = i.weight;
         ++idx;
       }
+      widths_changed();
       if (update) {
         redraw_views();
       }
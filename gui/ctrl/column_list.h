@@ -21,7 +21,9 @@
 //
 // Common includes
 //
+#include <array>
 #include <functional>
+#include <utility>
 
 
 // --------------------------------------------------------------------------
@@ -88,6 +90,7 @@ namespace gui {
 
       protected:
         void redraw_views ();
+        void widths_changed ();
 
         win::window* main;
         win::window* list;
@@ -95,6 +98,12 @@ namespace gui {
         std::vector<column_size_type> widths;
         std::vector<text_origin_t> aligns;
 
+      private:
+        const std::vector<column_size_type>& get_offsets () const;
+
+        // left position of each column and the right of the last, built on demand.
+        mutable std::vector<column_size_type> offsets;
+
       };
 
     }
@@ -325,26 +334,24 @@ namespace gui {
       typedef std::tuple<Arguments ...> row_type;
       typedef std::tuple<cell_drawer_t<Arguments>...> drawer_type;
 
+      typedef void (cell_fn) (const row_type& row,
+                              const drawer_type& drawer,
+                              const layout_type& layout,
+                              draw::graphics& g,
+                              const core::rectangle& place,
+                              const draw::brush& background,
+                              item_state state);
+
       template<std::size_t I>
       static void draw_cell (const row_type& row,
                              const drawer_type& drawer,
                              const layout_type& layout,
                              draw::graphics& g,
                              const core::rectangle& place,
-                             core::point::type x,
-                             const draw::brush& background,
-                             item_state state);
-
-      template<std::size_t I, typename T, typename ... Args>
-      static void draw_cell (const row_type& row,
-                             const drawer_type& drawer,
-                             const layout_type& layout,
-                             draw::graphics& g,
-                             const core::rectangle& r,
-                             core::point::type x,
                              const draw::brush& background,
                              item_state state);
 
+      /// Draws only the columns inside the invalid area of g.
       static void draw_row (const row_type& row,
                             const drawer_type& drawer,
                             const layout_type& layout,
@@ -409,19 +416,23 @@ namespace gui {
 
       virtual row_type at (std::size_t) const = 0;
 
+      /// Sources that store their rows return them here, others return nullptr and are read by at().
+      virtual const row_type* get_row (std::size_t) const {
+        return nullptr;
+      }
+
       void draw_at (std::size_t idx,
                     draw::graphics& g,
                     const core::rectangle& place,
                     const draw::brush& background,
                     item_state state) const override {
         if (super::get_layout()) {
-          column_list_row_drawer_t<Arguments...>::draw_row(at(idx),
-                                                           drawer,
-                                                           *super::get_layout(),
-                                                           g,
-                                                           place,
-                                                           background,
-                                                           state);
+          typedef column_list_row_drawer_t<Arguments...> row_drawer;
+          if (const row_type* row = get_row(idx)) {
+            row_drawer::draw_row(*row, drawer, *super::get_layout(), g, place, background, state);
+          } else {
+            row_drawer::draw_row(at(idx), drawer, *super::get_layout(), g, place, background, state);
+          }
         }
       }
 
@@ -464,6 +475,10 @@ namespace gui {
         return data[idx];
       }
 
+      const row_type* get_row (std::size_t idx) const override {
+        return &data[idx];
+      }
+
 //      const_column_list_data& set_data (const std::vector<row_type>& args) {
 //        data = container_type(args);
 //        return *this;
@@ -379,41 +379,25 @@ namespace gui {
     // --------------------------------------------------------------------------
     template<typename ... A>
     template<std::size_t I>
-    void column_list_row_drawer_t<A ...>::draw_cell (const row_type&,
-                                                     const drawer_type&,
-                                                     const layout_type&,
-                                                     draw::graphics& g,
-                                                     const core::rectangle& place,
-                                                     core::point::type x,
-                                                     const draw::brush& background,
-                                                     item_state) {
-      if (x < place.x2()) {
-        g.fill(draw::rectangle(core::point(x, place.y()), place.x2y2()), background);
-      }
-    }
-
-    template<typename ... A>
-    template<std::size_t I, typename T, typename ... Args>
     void column_list_row_drawer_t<A ...>::draw_cell (const row_type& row,
                                                      const drawer_type& drawer,
                                                      const layout_type& layout,
                                                      draw::graphics& g,
-                                                     const core::rectangle& r,
-                                                     core::point::type x,
+                                                     const core::rectangle& place,
                                                      const draw::brush& background,
                                                      item_state state) {
-      core::size::type width = layout.get_column_width(I);
-      text_origin_t align = layout.get_column_align(I);
+      draw::clip clp(g, place.grown({1, 1}));
+      std::get<I>(drawer)(std::get<I>(row), g, place, background, state, layout.get_column_align(I));
+    }
 
-      core::rectangle place(core::point(x, r.y()), core::point(x + width, r.y2()));
-      {
-        draw::clip clp(g, place.grown({1, 1}));
-        auto dat = std::get<I>(row);
-        auto drw = std::get<I>(/*static_cast<const std::tuple<cell_drawer_t<A>...>&>(*/drawer/*)*/);
-        drw(dat, g, place, background, state, align);
+    namespace detail {
+
+      template<typename D, std::size_t ... I>
+      constexpr std::array<typename D::cell_fn*, sizeof...(I)> make_cell_functions (std::index_sequence<I...>) {
+        return {{&D::template draw_cell<I>...}};
       }
-      draw_cell<I + 1, Args ...>(row, drawer, layout, g, r, x + width, background, state);
-    }
+
+    } // namespace detail
 
     template<typename ... A>
     void column_list_row_drawer_t<A ...>::draw_row (const row_type& row,
@@ -423,7 +407,25 @@ namespace gui {
                                                     const core::rectangle& place,
                                                     const draw::brush& background,
                                                     item_state state) {
-      draw_cell<0, A ...>(row, drawer, layout, g, place, place.x(), background, state);
+      static constexpr auto cells = detail::make_cell_functions<column_list_row_drawer_t>(std::index_sequence_for<A...>());
+      constexpr std::size_t count = sizeof...(A);
+
+      const auto& ctx = g.context();
+      const core::rectangle visible = core::rectangle(g.get_invalid_area().os(ctx), ctx) & place;
+      if (visible.empty()) {
+        return;
+      }
+      // columns left of the visible area are skipped, the loop stops at its right.
+      std::size_t i = static_cast<std::size_t>(std::max(0, layout.index_at(visible.x() - place.x())));
+      core::point::type x = place.x() + layout.get_column_left_pos(i);
+      for (; (i < count) && (x < visible.x2()); ++i) {
+        const core::point::type x2 = x + layout.get_column_width(i);
+        cells[i](row, drawer, layout, g, core::rectangle(core::point(x, place.y()), core::point(x2, place.y2())), background, state);
+        x = x2;
+      }
+      if ((i == count) && (x < place.x2())) {
+        g.fill(draw::rectangle(core::point(x, place.y()), place.x2y2()), background);
+      }
     }
 
     // --------------------------------------------------------------------------
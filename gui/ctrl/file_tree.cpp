@@ -21,6 +21,8 @@
 #ifdef GUIPP_QT
 # include <QtCore/QDir>
 #endif // GUIPP_QT
+#include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <utility>
 #include <util/time_util.h>
@@ -30,7 +32,9 @@
 // Library includes
 //
 #include "gui/draw/pen.h"
+#include "gui/win/window_event_proc.h"
 #include "gui/ctrl/file_tree.h"
+#include "gui/ctrl/worker_pool.h"
 
 
 namespace gui {
@@ -105,10 +109,240 @@ namespace gui {
       } catch (...) {}
     }
 
+#ifdef USE_BOOST
+    file_info::file_info (const sys_fs::directory_entry& entry)
+      : file_info(entry.path())
+    {}
+#else
+    file_info::file_info (const sys_fs::directory_entry& entry)
+      : path(entry.path())
+      , size(0)
+    {
+      std::error_code ec;
+      status = entry.status(ec);
+      if (!ec && sys_fs::is_regular_file(status)) {
+        size = entry.file_size(ec);
+        if (ec) {
+          size = 0;
+        }
+      }
+      last_write_time = entry.last_write_time(ec);
+    }
+#endif // USE_BOOST
+
     file_info::file_info ()
       : size(0)
     {}
 
+    // --------------------------------------------------------------------------
+    file_info_cache::file_info_cache ()
+      : max_directories(64)
+      , use_counter(0)
+    {}
+
+    // lazy create static
+    file_info_cache& file_info_cache::get () {
+      static file_info_cache c;
+      return c;
+    }
+
+    auto file_info_cache::lookup (const sys_fs::path& dir) -> list_ptr {
+      std::error_code ec;
+      const auto dir_time = sys_fs::last_write_time(dir, ec);
+
+      std::lock_guard<std::mutex> lock(guard);
+      auto i = entries.find(dir);
+      if (i == entries.end()) {
+        return nullptr;
+      }
+      if (ec || (i->second.dir_time != dir_time)) {
+        entries.erase(i);
+        return nullptr;
+      }
+      i->second.last_use = ++use_counter;
+      return i->second.list;
+    }
+
+    void file_info_cache::store (const sys_fs::path& dir, const sys_fs::file_time_type& dir_time, list_ptr list) {
+      std::lock_guard<std::mutex> lock(guard);
+      entries[dir] = {dir_time, std::move(list), ++use_counter};
+      while (entries.size() > max_directories) {
+        auto oldest = std::min_element(entries.begin(), entries.end(), [] (const auto& lhs, const auto& rhs) {
+          return lhs.second.last_use < rhs.second.last_use;
+        });
+        entries.erase(oldest);
+      }
+    }
+
+    void file_info_cache::invalidate (const sys_fs::path& dir) {
+      std::lock_guard<std::mutex> lock(guard);
+      entries.erase(dir);
+    }
+
+    void file_info_cache::clear () {
+      std::lock_guard<std::mutex> lock(guard);
+      entries.clear();
+    }
+
+    void file_info_cache::set_max_directories (std::size_t m) {
+      std::lock_guard<std::mutex> lock(guard);
+      max_directories = std::max<std::size_t>(m, 1);
+    }
+
+    std::size_t file_info_cache::get_max_directories () const {
+      std::lock_guard<std::mutex> lock(guard);
+      return max_directories;
+    }
+
+    namespace {
+
+      // --------------------------------------------------------------------------
+      ctrl::worker_pool& directory_workers () {
+        // the workers use the cache, it must be created first to outlive them.
+        file_info_cache::get();
+        // lazy create static
+        static ctrl::worker_pool workers;
+        return workers;
+      }
+
+    } // namespace
+
+    // --------------------------------------------------------------------------
+    struct directory_loader::state {
+      explicit state (const win::window& target, std::function<batch_fn>&& on_batch)
+        : target(&target)
+        , alive(true)
+        , finished(false)
+        , on_batch(std::move(on_batch))
+      {}
+
+      // guards alive while the worker posts to the main thread.
+      std::mutex guard;
+      const win::window* target;
+      std::atomic_bool alive;
+      bool finished;
+      // only called on the main thread.
+      std::function<batch_fn> on_batch;
+    };
+
+    void directory_loader::enumerate (std::shared_ptr<state> s,
+                                      const sys_fs::path& dir,
+                                      const std::function<filter_fn>& filter,
+                                      const std::function<accept_fn>& accept) {
+      if (!s->alive) {
+        // canceled while waiting for a worker.
+        return;
+      }
+      list_type batch;
+      batch.reserve(batch_size);
+
+      auto add = [&] (const file_info& fi) {
+        if (!accept || accept(fi)) {
+          batch.push_back(fi);
+          if (batch.size() >= batch_size) {
+            return post_batch(s, batch, false);
+          }
+        }
+        return true;
+      };
+
+      auto& cache = file_info_cache::get();
+      if (!filter) {
+        if (auto cached = cache.lookup(dir)) {
+          for (const auto& fi : *cached) {
+            if (!add(fi)) {
+              return;
+            }
+          }
+          post_batch(s, batch, true);
+          return;
+        }
+      }
+
+      std::error_code ec;
+      const auto dir_time = sys_fs::last_write_time(dir, ec);
+      auto all = std::make_shared<list_type>();
+      // a listing that ended with an error is incomplete and must not be cached.
+      bool completed = false;
+      try {
+        auto i = ctrl::path_tree::path_iterator(file_info(dir));
+        const sys_fs::directory_iterator end;
+        for (; i != end; ++i) {
+          if (!s->alive) {
+            return;
+          }
+          if (filter && filter(*i)) {
+            continue;
+          }
+          file_info fi(*i);
+          if (!filter) {
+            all->push_back(fi);
+          }
+          if (!add(fi)) {
+            return;
+          }
+        }
+        completed = true;
+      } catch (std::exception& ex) {
+        logging::warn() << ex;
+      }
+
+      if (completed && !filter && !ec) {
+        cache.store(dir, dir_time, all);
+      }
+      post_batch(s, batch, true);
+    }
+
+    bool directory_loader::post_batch (const std::shared_ptr<state>& s,
+                                       list_type& batch,
+                                       bool finished) {
+      std::lock_guard<std::mutex> lock(s->guard);
+      if (!s->alive) {
+        return false;
+      }
+      auto items = std::make_shared<list_type>(std::move(batch));
+      batch = list_type();
+      batch.reserve(batch_size);
+      win::run_on_main(*(s->target), [s, items, finished] () {
+        if (s->alive) {
+          s->finished = finished;
+          s->on_batch(std::move(*items), finished);
+        }
+      });
+      return true;
+    }
+
+    directory_loader::~directory_loader () {
+      cancel();
+    }
+
+    void directory_loader::load (const win::window& target,
+                                 const sys_fs::path& dir,
+                                 std::function<filter_fn> filter,
+                                 std::function<accept_fn> accept,
+                                 std::function<batch_fn> on_batch,
+                                 priority prio) {
+      cancel();
+      current = std::make_shared<state>(target, std::move(on_batch));
+      // the job keeps the state alive; it only runs as long as the load is not canceled.
+      auto s = current;
+      directory_workers().push([s, dir, filter, accept] () {
+        enumerate(s, dir, filter, accept);
+      }, prio == priority::low);
+    }
+
+    void directory_loader::cancel () {
+      if (current) {
+        std::lock_guard<std::mutex> lock(current->guard);
+        current->alive = false;
+      }
+      current.reset();
+    }
+
+    bool directory_loader::is_loading () const {
+      return current && !current->finished;
+    }
+
     std::vector<sys_fs::path> get_all_root_paths () {
       std::vector<sys_fs::path> roots;
 #if defined(GUIPP_X11) || defined(GUIPP_JS) || defined(GUIPP_SDL)
@@ -268,6 +502,30 @@ namespace gui {
         });
       }
 
+      bool unsorted_path_info::accept (type const& n) {
+        return !is_hidden(n.path);
+      }
+
+      bool unsorted_dir_info::accept (type const& n) {
+        return n.is_directory() && !is_hidden(n.path);
+      }
+
+      bool unsorted_file_info::accept (type const& n) {
+        return !n.is_directory() && !is_hidden(n.path);
+      }
+
+      bool sorted_path_info::accept (type const& n) {
+        return unsorted_path_info::accept(n);
+      }
+
+      bool sorted_dir_info::accept (type const& n) {
+        return unsorted_dir_info::accept(n);
+      }
+
+      bool sorted_file_info::accept (type const& n) {
+        return unsorted_file_info::accept(n);
+      }
+
       auto unsorted_path_info::sub_nodes (type const& n) const -> range {
         return range(unsorted_path_iterator(n, filter), fs::filtered_iterator(sys_fs::directory_iterator()));
       }
@@ -287,10 +545,14 @@ namespace gui {
         for (auto i = beg, e = end; i != e; ++i) {
               v.emplace_back(*i);
         }
-        std::sort(v.begin(), v.end(), comp_by_name_dirs_first());
+        sort(v);
         return v;
       }
 
+      void sorted_path_info::sort (list_type& v) {
+        std::sort(v.begin(), v.end(), comp_by_name_dirs_first());
+      }
+
       auto sorted_dir_info::sub_nodes(type const & n) const -> range {
         auto beg = unsorted_dir_iterator(n, filter);
         auto end = fs::filtered_iterator(sys_fs::directory_iterator());
@@ -298,10 +560,14 @@ namespace gui {
         for (auto i = beg, e = end; i != e; ++i) {
               v.emplace_back(*i);
         }
-        std::sort(v.begin(), v.end(), comp_by_name());
+        sort(v);
         return v;
       }
 
+      void sorted_dir_info::sort (list_type& v) {
+        std::sort(v.begin(), v.end(), comp_by_name());
+      }
+
       auto sorted_file_info::sub_nodes(type const & n) const -> range {
         auto beg = unsorted_file_iterator(n, filter);
         auto end = fs::filtered_iterator(sys_fs::directory_iterator());
@@ -309,10 +575,14 @@ namespace gui {
         for (auto i = beg, e = end; i != e; ++i) {
               v.emplace_back(*i);
         }
-        std::sort(v.begin(), v.end(), comp_by_name());
+        sort(v);
         return v;
       }
 
+      void sorted_file_info::sort (list_type& v) {
+        std::sort(v.begin(), v.end(), comp_by_name());
+      }
+
 
     } // path_tree
 
@@ -440,6 +710,40 @@ namespace gui {
       }
     }
 
+    namespace {
+
+      // [first, middle) is sorted, sort [middle, last) and merge both.
+      template<typename I, typename C>
+      void merge_tail (I first, I middle, I last, C comp) {
+        std::stable_sort(middle, last, comp);
+        std::inplace_merge(first, middle, last, comp);
+      }
+
+      // the descending orders sort the reversed list, there the new entries come first.
+      template<typename I, typename C>
+      void merge_head (I first, I middle, I last, C comp) {
+        std::stable_sort(first, middle, comp);
+        std::inplace_merge(first, middle, last, comp);
+      }
+
+    } // namespace
+
+    void merge_list_by (std::vector<fs::file_info>& list, std::size_t sorted, sort_order order) {
+      sorted = std::min(sorted, list.size());
+      const auto added = static_cast<std::ptrdiff_t>(list.size() - sorted);
+      const auto tail = list.begin() + static_cast<std::ptrdiff_t>(sorted);
+      const auto head = list.rbegin() + added;
+      switch (order) {
+        case sort_order::name_down: merge_head(list.rbegin(), head, list.rend(), path_tree::comp_by_name_dirs_last()); break;
+        case sort_order::name_up: merge_tail(list.begin(), tail, list.end(), path_tree::comp_by_name_dirs_first()); break;
+        case sort_order::size_down: merge_head(list.rbegin(), head, list.rend(), path_tree::comp_by_size_dirs_last()); break;
+        case sort_order::size_up: merge_tail(list.begin(), tail, list.end(), path_tree::comp_by_size_dirs_first()); break;
+        case sort_order::date_down: merge_head(list.rbegin(), head, list.rend(), path_tree::comp_by_date_dirs_last()); break;
+        case sort_order::date_up: merge_tail(list.begin(), tail, list.end(), path_tree::comp_by_date_dirs_first()); break;
+        default: break;
+      }
+    }
+
     void draw_arrow_up (draw::graphics& g, const core::rectangle& r, os::color col) {
       g.fill(draw::polygon({{r.center_x(), r.y()}, r.bottom_right(), r.bottom_left()}), col);
     }
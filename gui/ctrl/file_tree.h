@@ -21,6 +21,10 @@
 // Common includes
 //
 #include <functional>
+#include <map>
+#include <set>
+#include <memory>
+#include <mutex>
 #include <util/sys_fs.h>
 #include <util/string_util.h>
 
@@ -72,6 +76,8 @@ namespace gui {
 
     struct GUIPP_CTRL_EXPORT file_info {
       file_info (const sys_fs::path& path); // NOLINT(google-explicit-constructor)
+      /// Uses the attributes already cached in the entry where the platform provides them.
+      file_info (const sys_fs::directory_entry& entry); // NOLINT(google-explicit-constructor)
       file_info ();
 
       sys_fs::path path;
@@ -92,6 +98,98 @@ namespace gui {
       bool operator>= (const file_info& rhs) const;
     };
 
+    // --------------------------------------------------------------------------
+    /**
+     * Process wide cache of directory listings, keyed by the directory path.
+     * A listing stays valid as long as the last write time of the directory is
+     * unchanged, which covers added, removed and renamed entries.
+     * Files changed in place do not touch the directory, their cached size and
+     * last write time stay outdated until the directory is invalidated.
+     */
+    class GUIPP_CTRL_EXPORT file_info_cache {
+    public:
+      typedef std::vector<file_info> list_type;
+      typedef std::shared_ptr<const list_type> list_ptr;
+
+      static file_info_cache& get ();
+
+      /// Returns nullptr if the directory is not cached or has changed since.
+      list_ptr lookup (const sys_fs::path& dir);
+      void store (const sys_fs::path& dir, const sys_fs::file_time_type& dir_time, list_ptr list);
+
+      void invalidate (const sys_fs::path& dir);
+      void clear ();
+
+      void set_max_directories (std::size_t);
+      std::size_t get_max_directories () const;
+
+    private:
+      file_info_cache ();
+
+      struct entry {
+        sys_fs::file_time_type dir_time;
+        list_ptr list;
+        std::uint64_t last_use;
+      };
+
+      mutable std::mutex guard;
+      std::map<sys_fs::path, entry> entries;
+      std::size_t max_directories;
+      std::uint64_t use_counter;
+    };
+
+    // --------------------------------------------------------------------------
+    /**
+     * Enumerates a directory on a small pool of shared worker threads and
+     * delivers the entries in batches on the main thread of the target window.
+     * A new load or the destruction of the loader cancels a running load.
+     * Loads with low priority start after all waiting normal loads.
+     */
+    class GUIPP_CTRL_EXPORT directory_loader {
+    public:
+      typedef std::vector<file_info> list_type;
+      typedef bool (accept_fn)(const file_info&);
+      typedef void (batch_fn)(list_type&& batch, bool finished);
+
+      static constexpr std::size_t batch_size = 512;
+
+      enum class priority {
+        normal,
+        low
+      };
+
+      directory_loader () = default;
+      ~directory_loader ();
+
+      directory_loader (const directory_loader&) = delete;
+      directory_loader& operator= (const directory_loader&) = delete;
+
+      /// Entries matching filter are skipped, accept selects the delivered entries.
+      /// Listings without filter are served from and stored in the file_info_cache.
+      void load (const win::window& target,
+                 const sys_fs::path& dir,
+                 std::function<filter_fn> filter,
+                 std::function<accept_fn> accept,
+                 std::function<batch_fn> on_batch,
+                 priority prio = priority::normal);
+      void cancel ();
+
+      bool is_loading () const;
+
+    private:
+      struct state;
+
+      static void enumerate (std::shared_ptr<state> s,
+                             const sys_fs::path& dir,
+                             const std::function<filter_fn>& filter,
+                             const std::function<accept_fn>& accept);
+      static bool post_batch (const std::shared_ptr<state>& s,
+                              list_type& batch,
+                              bool finished);
+
+      std::shared_ptr<state> current;
+    };
+
     std::vector<sys_fs::path> GUIPP_CTRL_EXPORT get_all_root_paths ();
     std::vector<file_info> GUIPP_CTRL_EXPORT get_all_root_file_infos ();
 
@@ -111,6 +209,9 @@ namespace gui {
 
         bool has_sub_nodes (type const& n) const;
 
+        /// Order of the sub nodes, the unsorted infos keep the directory order.
+        static void sort (list_type&);
+
         static reference make_reference (type const& n);
         static type const& dereference (reference const& r);
         static std::string label (type const& n);
@@ -123,38 +224,97 @@ namespace gui {
         typedef core::range<iterator> range;
 
         range sub_nodes (type const& n) const;
+        static bool accept (type const& n);
       };
 
       struct GUIPP_CTRL_EXPORT unsorted_dir_info : public path_info {
         typedef core::range<iterator> range;
 
         range sub_nodes (type const& n) const;
+        static bool accept (type const& n);
       };
 
       struct GUIPP_CTRL_EXPORT unsorted_file_info : public path_info {
         typedef core::range<iterator> range;
 
         range sub_nodes (type const& n) const;
+        static bool accept (type const& n);
       };
 
       struct GUIPP_CTRL_EXPORT sorted_path_info : public path_info {
         typedef std::vector<type> range;
 
         range sub_nodes (type const& n) const;
+        static bool accept (type const& n);
+        static void sort (list_type&);
       };
 
       struct GUIPP_CTRL_EXPORT sorted_dir_info : public path_info {
         typedef std::vector<type> range;
 
         range sub_nodes (type const& n) const;
+        static bool accept (type const& n);
+        static void sort (list_type&);
       };
 
       struct GUIPP_CTRL_EXPORT sorted_file_info : public path_info {
         typedef std::vector<type> range;
 
         range sub_nodes (type const& n) const;
+        static bool accept (type const& n);
+        static void sort (list_type&);
       };
 
+      // --------------------------------------------------------------------------
+      /**
+       * Tree info that enumerates the sub directories of I with a directory_loader
+       * instead of on the main thread. The sub nodes of a directory are available
+       * once its load has finished. They are dropped when the directory is closed,
+       * invalidated or is the least recently used of more than max_directories.
+       * The sub nodes of pinned, i.e. open directories are never dropped for the limit.
+       */
+      template<typename I>
+      struct async_info : public I {
+        typedef I super;
+        typedef typename I::type type;
+        typedef typename I::list_type list_type;
+        typedef const list_type& range;
+
+        static constexpr bool async_loading = true;
+
+        bool is_loaded (type const& n) const;
+        range sub_nodes (type const& n) const;
+
+        void load_sub_nodes (const win::window& target,
+                             type const& n,
+                             std::function<void()> ready,
+                             bool prefetch);
+        void cancel_load (type const& n);
+        /// Keep the sub nodes of n until n is invalidated.
+        void pin (type const& n);
+
+        /// Drop the sub nodes of n, they are loaded again when they are needed next time.
+        void invalidate (type const& n);
+        /// Drop all sub nodes, e.g. to refresh the whole tree.
+        void clear ();
+
+        void set_max_directories (std::size_t);
+        std::size_t get_max_directories () const;
+
+      private:
+        struct entry {
+          list_type list;
+          std::uint64_t last_use;
+        };
+
+        void store (const sys_fs::path& dir, list_type&& list);
+
+        mutable std::map<sys_fs::path, entry> loaded;
+        std::map<sys_fs::path, std::unique_ptr<fs::directory_loader>> loading;
+        std::set<sys_fs::path> pinned;
+        std::size_t max_directories = 256;
+        mutable std::uint64_t use_counter = 0;
+      };
 
     } // path_tree
 
@@ -164,6 +324,11 @@ namespace gui {
     typedef tree::basic_tree<path_tree::sorted_path_info> sorted_file_tree;
     typedef tree::basic_tree<path_tree::sorted_dir_info> sorted_dir_tree;
 
+    typedef tree::basic_tree<path_tree::async_info<path_tree::unsorted_path_info>> async_file_tree;
+    typedef tree::basic_tree<path_tree::async_info<path_tree::unsorted_dir_info>> async_dir_tree;
+    typedef tree::basic_tree<path_tree::async_info<path_tree::sorted_path_info>> async_sorted_file_tree;
+    typedef tree::basic_tree<path_tree::async_info<path_tree::sorted_dir_info>> async_sorted_dir_tree;
+
     // --------------------------------------------------------------------------
     namespace detail {
 
@@ -260,6 +425,8 @@ namespace gui {
     };
 
     GUIPP_CTRL_EXPORT void sort_list_by (std::vector<fs::file_info>& list, sort_order);
+    /// The first sorted entries of list are in order, sorts the rest and merges them in.
+    GUIPP_CTRL_EXPORT void merge_list_by (std::vector<fs::file_info>& list, std::size_t sorted, sort_order);
 
     // --------------------------------------------------------------------------
     template<typename T = path_tree::sorted_file_info, typename S = core::selector::single>
@@ -280,6 +447,10 @@ namespace gui {
       file_column_list (file_column_list&& rhs) noexcept ;
 
       void set_path (const sys_fs::path& dir);
+      /// Enumerate dir in background, each arriving batch is merged into the sorted entries.
+      void set_path_async (const sys_fs::path& dir);
+      bool is_loading () const;
+
       sys_fs::path get_selected_path () const;
 
       void sort_by (sort_order order);
@@ -294,10 +465,12 @@ namespace gui {
       void handle_header_mouse_up (os::key_state, const core::native_point&);
 
       void init ();
+      void add_entries (std::vector<fs::file_info>&& batch, bool finished);
 
       core::point mouse_down_point;
       std::vector<fs::file_info> current_dir;
       sort_order order;
+      fs::directory_loader loader;
 
     };
 
@@ -99,6 +99,101 @@ namespace gui {
         return gui::tree::standard_icon_drawer(has_children, is_open, selected);
       }
 
+      inline void path_info::sort (list_type&)
+      {}
+
+      // --------------------------------------------------------------------------
+      template<typename I>
+      bool async_info<I>::is_loaded (type const& n) const {
+        return !super::has_sub_nodes(n) || (loaded.find(n.path) != loaded.end());
+      }
+
+      template<typename I>
+      auto async_info<I>::sub_nodes (type const& n) const -> range {
+        static const list_type empty;
+        auto i = loaded.find(n.path);
+        if (i == loaded.end()) {
+          return empty;
+        }
+        i->second.last_use = ++use_counter;
+        return i->second.list;
+      }
+
+      template<typename I>
+      void async_info<I>::load_sub_nodes (const win::window& target,
+                                          type const& n,
+                                          std::function<void()> ready,
+                                          bool prefetch) {
+        const sys_fs::path dir = n.path;
+        if ((loaded.find(dir) != loaded.end()) || (loading.find(dir) != loading.end())) {
+          return;
+        }
+        auto items = std::make_shared<list_type>();
+        auto& l = loading[dir];
+        l = std::make_unique<fs::directory_loader>();
+        l->load(target, dir, super::filter, &I::accept, [&, dir, items, ready] (list_type&& batch, bool finished) {
+          items->insert(items->end(), std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+          if (finished) {
+            I::sort(*items);
+            store(dir, std::move(*items));
+            // this call is owned by the loader, keep the callback until it is done.
+            auto done = ready;
+            loading.erase(dir);
+            done();
+          }
+        }, prefetch ? fs::directory_loader::priority::low : fs::directory_loader::priority::normal);
+      }
+
+      template<typename I>
+      void async_info<I>::cancel_load (type const& n) {
+        loading.erase(n.path);
+      }
+
+      template<typename I>
+      void async_info<I>::pin (type const& n) {
+        pinned.insert(n.path);
+      }
+
+      template<typename I>
+      void async_info<I>::invalidate (type const& n) {
+        pinned.erase(n.path);
+        loaded.erase(n.path);
+      }
+
+      template<typename I>
+      void async_info<I>::clear () {
+        loaded.clear();
+      }
+
+      template<typename I>
+      void async_info<I>::set_max_directories (std::size_t m) {
+        max_directories = std::max<std::size_t>(m, 1);
+      }
+
+      template<typename I>
+      std::size_t async_info<I>::get_max_directories () const {
+        return max_directories;
+      }
+
+      template<typename I>
+      void async_info<I>::store (const sys_fs::path& dir, list_type&& list) {
+        loaded[dir] = {std::move(list), ++use_counter};
+        while (loaded.size() > max_directories) {
+          // open directories and those waiting to be shown are not dropped.
+          auto oldest = loaded.end();
+          for (auto i = loaded.begin(), e = loaded.end(); i != e; ++i) {
+            if ((pinned.find(i->first) == pinned.end()) &&
+                ((oldest == loaded.end()) || (i->second.last_use < oldest->second.last_use))) {
+              oldest = i;
+            }
+          }
+          if (oldest == loaded.end()) {
+            break;
+          }
+          loaded.erase(oldest);
+        }
+      }
+
     } // path_tree
 
     // --------------------------------------------------------------------------
@@ -139,8 +234,9 @@ namespace gui {
       current_path = dir;
       current_dir = info.sub_nodes(current_path);
       super::clear_selection();
-      super::set_scroll_pos(core::point::zero);
+      // the rows changed, the painted ones must not be moved.
       super::invalidate();
+      super::set_scroll_pos(core::point::zero);
     }
 
     template<typename T, file_item_drawer D, typename S>
@@ -219,6 +315,8 @@ namespace gui {
     inline void file_column_list<T, S>::set_path (const sys_fs::path& dir) {
       current_dir = info.sub_nodes(dir);
       super::list->clear_selection();
+      // the rows changed, the painted ones must not be moved.
+      super::list->invalidate();
       super::list->set_scroll_pos(core::point::zero);
       if (order == sort_order::none) {
         order = sort_order::name_up;
@@ -230,6 +328,51 @@ namespace gui {
       super::header.invalidate();
     }
 
+    template<typename T, typename S>
+    void file_column_list<T, S>::set_path_async (const sys_fs::path& dir) {
+      current_dir.clear();
+      super::list->clear_selection();
+      super::list->invalidate();
+      super::list->set_scroll_pos(core::point::zero);
+      if (order == sort_order::none) {
+        order = sort_order::name_up;
+      }
+      loader.load(*this, dir, info.filter, &tree_info::accept, [&] (std::vector<fs::file_info>&& batch, bool finished) {
+        add_entries(std::move(batch), finished);
+      });
+      super::list.layout();
+      super::header.invalidate();
+    }
+
+    template<typename T, typename S>
+    inline bool file_column_list<T, S>::is_loading () const {
+      return loader.is_loading();
+    }
+
+    template<typename T, typename S>
+    void file_column_list<T, S>::add_entries (std::vector<fs::file_info>&& batch, bool /*finished*/) {
+      // the shown entries stay sorted, each batch is merged in.
+      const auto selected = get_selected_path();
+      const auto sorted = current_dir.size();
+      current_dir.insert(current_dir.end(),
+                         std::make_move_iterator(batch.begin()),
+                         std::make_move_iterator(batch.end()));
+      if (current_dir.size() > sorted) {
+        merge_list_by(current_dir, sorted, order);
+        // merging moves the entries, keep the selection on the selected file.
+        if (!selected.empty()) {
+          auto i = std::find_if(current_dir.begin(), current_dir.end(), [&] (const fs::file_info& f) {
+            return f.path == selected;
+          });
+          if (i != current_dir.end()) {
+            super::list->set_selection(static_cast<int>(std::distance(current_dir.begin(), i)), event_source::logic);
+          }
+        }
+        super::list.invalidate();
+      }
+      super::list.layout();
+    }
+
     template<typename T, typename S>
     inline sys_fs::path file_column_list<T, S>::get_selected_path () const {
       if (super::list->has_selection()) {
@@ -79,9 +79,15 @@ namespace gui {
 
       void list_base::set_scroll_pos (const core::point& pos) {
         if (data.offset != pos) {
+          const core::point delta = data.offset - pos;
           data.offset = pos;
           super::notify_selection_changed();
-          invalidate();
+          if (is_focused()) {
+            // keep the focus frame at the border in place.
+            scroll_content(client_geometry().shrinked(core::size::one), delta);
+          } else {
+            scroll_content(delta);
+          }
         }
       }
 
@@ -34,6 +34,7 @@
 #include "gui/core/selection_adjustment.h"
 #include "gui/draw/drawers.h"
 #include "gui/draw/brush.h"
+#include "gui/win/animation.h"
 #include "gui/ctrl/virtual_view.h"
 #include "gui/ctrl/edit.h"
 #include "gui/ctrl/item_state.h"
@@ -271,6 +272,8 @@ namespace gui {
 
         core::native_point get_last_mouse_point () const;
 
+        /// Moves the painted rows and paints only the exposed ones. Call
+        /// invalidate() before, if the rows changed.
         void set_scroll_pos (const core::point& pos);
         const core::point& get_scroll_pos () const;
 
@@ -332,6 +335,7 @@ namespace gui {
 
       protected:
         traits_type traits;
+        win::animation::kinetic scroller;
 
       };
 
@@ -163,6 +163,7 @@ namespace gui {
             auto delta = otraits::get_1(super::get_last_mouse_point()) - otraits::get_1(pt);
             set_scroll_offset(traits.get_list_dimension(*this),
                               get_scroll_offset() + core::global::scale_from_native<pos_t>(delta));
+            scroller.track(get_scroll_offset());
             if (!super::is_moved()) {
               super::capture_pointer();
               super::set_state().moved(true);
@@ -177,6 +178,20 @@ namespace gui {
       template<typename T, orientation_t O>
       void oriented_list<T, O>::init () {
         super::on_mouse_move(util::bind_method(this, &oriented_list::handle_mouse_move));
+        super::on_left_btn_down([&] (os::key_state, const core::native_point&) {
+          scroller.stop();
+        });
+        super::on_left_btn_up([&] (os::key_state, const core::native_point&) {
+          if (super::is_moved()) {
+            // a fast drag keeps on scrolling.
+            scroller.release();
+          }
+        });
+        scroller.set_scroll([&] (win::animation::kinetic::type d) {
+          const auto pos = get_scroll_offset() + static_cast<dim_type>(d);
+          set_scroll_offset(traits.get_list_dimension(*this), pos);
+          return get_scroll_offset() == pos;
+        });
       }
 
       template<typename T, orientation_t O>
@@ -31,87 +31,23 @@
 #include "gui/draw/font.h"
 #include "gui/draw/graphics.h"
 #include "gui/ctrl/look/button.h"
-#include "gui/io/pnm.h"
+#include "gui/ctrl/look/image_cache.h"
 
 
 namespace gui {
 
-  namespace pnm_data {
-
-#   include <gui/ctrl/look/res/button_frame.h>
-#   include <gui/ctrl/look/res/button_pressed_frame.h>
-#   include <gui/ctrl/look/res/button_rot_frame.h>
-#   include <gui/ctrl/look/res/button_pressed_rot_frame.h>
-#   include <gui/ctrl/look/res/simple_frame.h>
-
-#   include <gui/ctrl/look/res/metal_check_off.h>
-#   include <gui/ctrl/look/res/metal_check_on.h>
-#   include <gui/ctrl/look/res/metal_check_disabled.h>
-#   include <gui/ctrl/look/res/metal_check_disabled_on.h>
-
-#   include <gui/ctrl/look/res/metal_radio_off.h>
-#   include <gui/ctrl/look/res/metal_radio_on.h>
-#   include <gui/ctrl/look/res/metal_radio_disabled.h>
-#   include <gui/ctrl/look/res/metal_radio_disabled_on.h>
-
-#   include <gui/ctrl/look/res/osx_checkbox_off.h>
-#   include <gui/ctrl/look/res/osx_checkbox_on.h>
-#   include <gui/ctrl/look/res/osx_checkbox_disabled_off.h>
-#   include <gui/ctrl/look/res/osx_checkbox_disabled_on.h>
-
-#   include <gui/ctrl/look/res/osx_radio_off.h>
-#   include <gui/ctrl/look/res/osx_radio_on.h>
-#   include <gui/ctrl/look/res/osx_radio_disabled_off.h>
-#   include <gui/ctrl/look/res/osx_radio_disabled_on.h>
-
-#   include <gui/ctrl/look/res/osx_frame.h>
-#   include <gui/ctrl/look/res/osx_frame_disabled.h>
-#   include <gui/ctrl/look/res/osx_frame_default.h>
-#   include <gui/ctrl/look/res/osx_frame_pressed.h>
-
-  } // namespace pnm_data
-
   namespace detail {
 
-    template<typename T, size_t N>
-    inline std::string make_string (T(&t)[N]) {
-      return std::string((const char*)t, N);
-    }
-
-    draw::rgbmap build_gray_image (const std::string& data) {
-      draw::graymap bmp;
-      std::istringstream in(data);
-      io::load_pnm(in, bmp);
-      return bmp.convert<pixel_format_t::RGB>();
-    }
-
-    draw::rgbmap build_rgb_image (const std::string& data) {
-      draw::rgbmap bmp;
-      std::istringstream in(data);
-      io::load_pnm(in, bmp);
-      return bmp;
-    }
-
-    draw::rgbmap build_button_frame_image (bool pressed, bool rot) {
-      return build_rgb_image(pressed ? (rot ? make_string(pnm_data::button_pressed_rot_frame_bytes)
-                                            : make_string(pnm_data::button_pressed_frame_bytes))
-                                     : (rot ? make_string(pnm_data::button_rot_frame_bytes)
-                                            : make_string(pnm_data::button_frame_bytes)));
-    }
-
-    draw::rgbmap build_simple_frame_image () {
-      return build_rgb_image(make_string(pnm_data::simple_frame_bytes));
-    }
+    typedef look::image_cache::resource resource;
 
     template<bool rot, bool pressed>
-    const draw::rgbmap& get_button_frame () {
-      static draw::rgbmap image(detail::build_button_frame_image(pressed, rot));
-      return image;
+    const draw::rgbmap& get_button_frame (byte st = look::image_cache::normal) {
+      return look::image_cache::get().get_image(rot ? (pressed ? resource::button_pressed_rot_frame : resource::button_rot_frame)
+                           : (pressed ? resource::button_pressed_frame : resource::button_frame), st);
     }
 
-    const draw::rgbmap& get_simple_frame () {
-      static draw::rgbmap image(detail::build_simple_frame_image());
-      return image;
+    const draw::rgbmap& get_simple_frame (byte st = look::image_cache::normal) {
+      return look::image_cache::get().get_image(resource::simple_frame, st);
     }
 
     template<alignment_t A>
@@ -145,63 +81,20 @@ namespace gui {
       return pressed ? image_pressed : image;
     }
 
-    template<typename T>
-    T upscale (const T& img) {
-      if (core::global::get_scale_factor() != 1.0) {
-        T up(img.native_size() * core::global::get_scale_factor());
-        up.stretch_from(img);
-        return up;
-      }
-      return img;
-    }
-
-    template<typename T>
-    T downscale (const T& img) {
-      if (core::global::get_scale_factor() != 2.0) {
-        T up(img.native_size() * (core::global::get_scale_factor() / 2.0));
-        up.stretch_from(img);
-        return up;
-      }
-      return img;
-    }
-
-    template<typename T>
-    draw::masked_bitmap make_masked (const T& img) {
-      auto mask = img.get_mask({0x01});
-      return draw::masked_bitmap(img, std::move(mask));
-    }
-
-
-    const draw::masked_bitmap& get_osx_checkbox (bool active, bool disabled) {
-      static draw::masked_bitmap off      = make_masked(upscale(build_gray_image(make_string(pnm_data::osx_checkbox_off)).convert<pixel_format_t::RGB>()));
-      static draw::masked_bitmap on       = make_masked(upscale(build_rgb_image(make_string(pnm_data::osx_checkbox_on))));
-      static draw::masked_bitmap dis_off  = make_masked(upscale(build_gray_image(make_string(pnm_data::osx_checkbox_disabled_off)).convert<pixel_format_t::RGB>()));
-      static draw::masked_bitmap dis_on   = make_masked(upscale(build_gray_image(make_string(pnm_data::osx_checkbox_disabled_on)).convert<pixel_format_t::RGB>()));
-      return disabled ? (active ? dis_on : dis_off) : (active ? on : off);
+    draw::atlas_region get_osx_checkbox (bool active, bool disabled) {
+      return look::image_cache::get().get_region(resource::osx_checkbox, look::image_cache::check_state(active, disabled));
     }
 
-    const draw::masked_bitmap& get_osx_radio (bool active, bool disabled) {
-      static draw::masked_bitmap off      = make_masked(upscale(build_gray_image(make_string(pnm_data::osx_radio_off)).convert<pixel_format_t::RGB>()));
-      static draw::masked_bitmap on       = make_masked(upscale(build_rgb_image(make_string(pnm_data::osx_radio_on))));
-      static draw::masked_bitmap dis_off  = make_masked(upscale(build_gray_image(make_string(pnm_data::osx_radio_disabled_off)).convert<pixel_format_t::RGB>()));
-      static draw::masked_bitmap dis_on   = make_masked(upscale(build_gray_image(make_string(pnm_data::osx_radio_disabled_on)).convert<pixel_format_t::RGB>()));
-      return disabled ? (active ? dis_on : dis_off) : (active ? on : off);
+    draw::atlas_region get_osx_radio (bool active, bool disabled) {
+      return look::image_cache::get().get_region(resource::osx_radio, look::image_cache::check_state(active, disabled));
     }
 
-    const draw::masked_bitmap& get_metal_checkbox (bool active, bool disabled) {
-      static draw::masked_bitmap off      = make_masked(downscale(build_gray_image(make_string(pnm_data::metal_check_off))));
-      static draw::masked_bitmap on       = make_masked(downscale(build_gray_image(make_string(pnm_data::metal_check_on))));
-      static draw::masked_bitmap dis_off  = make_masked(downscale(build_gray_image(make_string(pnm_data::metal_check_disabled))));
-      static draw::masked_bitmap dis_on   = make_masked(downscale(build_gray_image(make_string(pnm_data::metal_check_disabled_on))));
-      return disabled ? (active ? dis_on : dis_off) : (active ? on : off);
+    draw::atlas_region get_metal_checkbox (bool active, bool disabled) {
+      return look::image_cache::get().get_region(resource::metal_checkbox, look::image_cache::check_state(active, disabled));
     }
 
-    const draw::masked_bitmap& get_metal_radio (bool active, bool disabled) {
-      static draw::masked_bitmap off = make_masked(downscale(build_gray_image(make_string(pnm_data::metal_radio_off))));
-      static draw::masked_bitmap on = make_masked(downscale(build_gray_image(make_string(pnm_data::metal_radio_on))));
-      static draw::masked_bitmap dis_off = make_masked(downscale(build_gray_image(make_string(pnm_data::metal_radio_disabled))));
-      static draw::masked_bitmap dis_on = make_masked(downscale(build_gray_image(make_string(pnm_data::metal_radio_disabled_on))));
-      return disabled ? (active ? dis_on : dis_off) : (active ? on : off);
+    draw::atlas_region get_metal_radio (bool active, bool disabled) {
+      return look::image_cache::get().get_region(resource::metal_radio, look::image_cache::check_state(active, disabled));
     }
 
   } // namespace detail
@@ -212,23 +105,19 @@ namespace gui {
     namespace osx {
 
       const draw::rgbmap& get_frame () {
-        static draw::rgbmap img = detail::build_gray_image(detail::make_string(pnm_data::osx_frame)).convert<pixel_format_t::RGB>();
-        return img;
+        return image_cache::get().get_image(image_cache::resource::osx_frame);
       }
 
       const draw::rgbmap& get_disabled_frame () {
-        static draw::rgbmap img = detail::build_gray_image(detail::make_string(pnm_data::osx_frame_disabled)).convert<pixel_format_t::RGB>();
-        return img;
+        return image_cache::get().get_image(image_cache::resource::osx_frame_disabled);
       }
 
       const draw::rgbmap& get_focused_frame () {
-        static draw::rgbmap img = detail::build_rgb_image(detail::make_string(pnm_data::osx_frame_default));
-        return img;
+        return image_cache::get().get_image(image_cache::resource::osx_frame_focused);
       }
 
       const draw::rgbmap& get_pressed_frame () {
-        static draw::rgbmap img = detail::build_rgb_image(detail::make_string(pnm_data::osx_frame_pressed));
-        return img;
+        return image_cache::get().get_image(image_cache::resource::osx_frame_pressed);
       }
 
     } // namespace osx
@@ -336,7 +225,7 @@ namespace gui {
                                                const core::button_state::is& st,
                                                os::color, os::color) {
       if (st.enabled() && st.hilited()) {
-        graph.copy(draw::frame_image(r, detail::get_button_frame<false, false>().brightness(1.025F), 4), r.top_left());
+        graph.copy(draw::frame_image(r, detail::get_button_frame<false, false>(image_cache::hilited), 4), r.top_left());
       } else {
         graph.copy(draw::frame_image(r, detail::get_button_frame<false, false>(), 4), r.top_left());
       }
@@ -393,8 +282,8 @@ namespace gui {
                        bool hilite,
                        uint32_t horizontal,
                        uint32_t vertical) {
-      graph.copy(draw::frame_image(r, hilite ? detail::get_simple_frame().brightness(1.025F)
-                                             : detail::get_simple_frame(),
+      graph.copy(draw::frame_image(r, detail::get_simple_frame(hilite ? image_cache::hilited
+                                                                   : image_cache::normal),
                                    horizontal, vertical), r.top_left());
     }
 
@@ -28,34 +28,17 @@
 #include "gui/ctrl/look/control.h"
 #include "gui/ctrl/look/button.h"
 #include "gui/ctrl/look/drop_down.h"
-#include "gui/io/pnm.h"
+#include "gui/ctrl/look/image_cache.h"
 
 
 namespace gui {
 
-  namespace pnm_data {
-
-#   include <gui/ctrl/look/res/osx_dropdown_button.h>
-#   include <gui/ctrl/look/res/osx_dropdown_disabled_button.h>
-
-  } // namespace pnm_data
-
   namespace detail {
 
-    template<typename T, size_t N>
-    inline std::string make_string (T(&t)[N]) {
-      return std::string((const char*)t, N);
-    }
-
-    draw::rgbmap build_rgb_image (const std::string& data);
-    draw::graymap build_gray_image (const std::string& data);
-    template<typename T>
-    T upscale (const T& img);
-
     const draw::rgbmap& get_osx_dropdown_button (bool enabled) {
-      static draw::rgbmap img = upscale(build_rgb_image(make_string(pnm_data::osx_dropdown_button)));
-      static draw::rgbmap dis = upscale(build_gray_image(make_string(pnm_data::osx_dropdown_disabled_button)).convert<pixel_format_t::RGB>());
-      return enabled ? img : dis;
+      typedef look::image_cache::resource resource;
+      return look::image_cache::get().get_image(enabled ? resource::osx_dropdown_button
+                                                        : resource::osx_dropdown_disabled_button);
     }
 
   }
@@ -0,0 +1,323 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     scale factor aware cache for the look images
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include "gui/core/guidefs.h"
+#include "gui/ctrl/look/image_cache.h"
+
+
+namespace gui {
+
+  namespace pixel_data {
+
+#   include <gui/ctrl/look/res/button_frame_raw.h>
+#   include <gui/ctrl/look/res/button_pressed_frame_raw.h>
+#   include <gui/ctrl/look/res/button_rot_frame_raw.h>
+#   include <gui/ctrl/look/res/button_pressed_rot_frame_raw.h>
+#   include <gui/ctrl/look/res/simple_frame_raw.h>
+
+#   include <gui/ctrl/look/res/metal_check_off_raw.h>
+#   include <gui/ctrl/look/res/metal_check_on_raw.h>
+#   include <gui/ctrl/look/res/metal_check_disabled_raw.h>
+#   include <gui/ctrl/look/res/metal_check_disabled_on_raw.h>
+
+#   include <gui/ctrl/look/res/metal_radio_off_raw.h>
+#   include <gui/ctrl/look/res/metal_radio_on_raw.h>
+#   include <gui/ctrl/look/res/metal_radio_disabled_raw.h>
+#   include <gui/ctrl/look/res/metal_radio_disabled_on_raw.h>
+
+#   include <gui/ctrl/look/res/osx_checkbox_off_raw.h>
+#   include <gui/ctrl/look/res/osx_checkbox_on_raw.h>
+#   include <gui/ctrl/look/res/osx_checkbox_disabled_off_raw.h>
+#   include <gui/ctrl/look/res/osx_checkbox_disabled_on_raw.h>
+
+#   include <gui/ctrl/look/res/osx_radio_off_raw.h>
+#   include <gui/ctrl/look/res/osx_radio_on_raw.h>
+#   include <gui/ctrl/look/res/osx_radio_disabled_off_raw.h>
+#   include <gui/ctrl/look/res/osx_radio_disabled_on_raw.h>
+
+#   include <gui/ctrl/look/res/osx_frame_raw.h>
+#   include <gui/ctrl/look/res/osx_frame_disabled_raw.h>
+#   include <gui/ctrl/look/res/osx_frame_default_raw.h>
+#   include <gui/ctrl/look/res/osx_frame_pressed_raw.h>
+
+#   include <gui/ctrl/look/res/osx_dropdown_button_raw.h>
+#   include <gui/ctrl/look/res/osx_dropdown_disabled_button_raw.h>
+
+  } // namespace pixel_data
+
+  namespace look {
+
+    namespace {
+
+      typedef image_cache::resource resource;
+      typedef draw::image_data<pixel_format_t::RGB> raw_image;
+
+      // pre decoded pixels, wrapped without parsing or copying.
+      const raw_image wrap (const unsigned char* data, const draw::bitmap_info& bmi) {
+        return raw_image(core::array_wrapper<byte>(const_cast<byte*>(data), bmi.mem_size()), bmi);
+      }
+
+      struct scaled_pair {
+        const unsigned char* x1;
+        const draw::bitmap_info& x1_info;
+        const unsigned char* x2;
+        const draw::bitmap_info& x2_info;
+      };
+
+#     define SCALED_PAIR(NAME) {pixel_data::NAME ## _1x_pixels, pixel_data::NAME ## _1x_info, \
+                                pixel_data::NAME ## _2x_pixels, pixel_data::NAME ## _2x_info}
+
+      // indexed by the checked and disabled state bits.
+      const scaled_pair osx_checkbox[] = {
+        SCALED_PAIR(osx_checkbox_off), SCALED_PAIR(osx_checkbox_on),
+        SCALED_PAIR(osx_checkbox_disabled_off), SCALED_PAIR(osx_checkbox_disabled_on)
+      };
+
+      const scaled_pair osx_radio[] = {
+        SCALED_PAIR(osx_radio_off), SCALED_PAIR(osx_radio_on),
+        SCALED_PAIR(osx_radio_disabled_off), SCALED_PAIR(osx_radio_disabled_on)
+      };
+
+      const scaled_pair metal_checkbox[] = {
+        SCALED_PAIR(metal_check_off), SCALED_PAIR(metal_check_on),
+        SCALED_PAIR(metal_check_disabled), SCALED_PAIR(metal_check_disabled_on)
+      };
+
+      const scaled_pair metal_radio[] = {
+        SCALED_PAIR(metal_radio_off), SCALED_PAIR(metal_radio_on),
+        SCALED_PAIR(metal_radio_disabled), SCALED_PAIR(metal_radio_disabled_on)
+      };
+
+      const scaled_pair osx_dropdown_button = SCALED_PAIR(osx_dropdown_button);
+      const scaled_pair osx_dropdown_disabled_button = SCALED_PAIR(osx_dropdown_disabled_button);
+
+#     undef SCALED_PAIR
+
+      // use the pre scaled variant, stretch the nearest one for uncommon scale factors.
+      draw::rgbmap build_scaled (const scaled_pair& p, double f) {
+        const auto x1 = wrap(p.x1, p.x1_info);
+        if (f == 1.0) {
+          return draw::rgbmap(x1);
+        }
+        const auto x2 = wrap(p.x2, p.x2_info);
+        if (f == 2.0) {
+          return draw::rgbmap(x2);
+        }
+        const draw::rgbmap src(f > 1.0 ? x2 : x1);
+        draw::rgbmap img(p.x1_info.size() * f);
+        img.stretch_from(src);
+        return img;
+      }
+
+      draw::rgbmap build_frame (resource r) {
+#       define FRAME(NAME) draw::rgbmap(wrap(pixel_data::NAME ## _1x_pixels, pixel_data::NAME ## _1x_info))
+        switch (r) {
+          case resource::button_frame:              return FRAME(button_frame);
+          case resource::button_pressed_frame:      return FRAME(button_pressed_frame);
+          case resource::button_rot_frame:          return FRAME(button_rot_frame);
+          case resource::button_pressed_rot_frame:  return FRAME(button_pressed_rot_frame);
+          case resource::simple_frame:              return FRAME(simple_frame);
+          case resource::osx_frame:                 return FRAME(osx_frame);
+          case resource::osx_frame_disabled:        return FRAME(osx_frame_disabled);
+          case resource::osx_frame_focused:         return FRAME(osx_frame_default);
+          case resource::osx_frame_pressed:         return FRAME(osx_frame_pressed);
+          default:                                  return draw::rgbmap();
+        }
+#       undef FRAME
+      }
+
+      // all entries known to be drawn by the looks.
+      const std::pair<resource, byte> prewarm_list[] = {
+        {resource::button_frame, image_cache::normal},
+        {resource::button_frame, image_cache::hilited},
+        {resource::button_pressed_frame, image_cache::normal},
+        {resource::button_rot_frame, image_cache::normal},
+        {resource::button_pressed_rot_frame, image_cache::normal},
+        {resource::simple_frame, image_cache::normal},
+        {resource::simple_frame, image_cache::hilited},
+        {resource::osx_frame, image_cache::normal},
+        {resource::osx_frame_disabled, image_cache::normal},
+        {resource::osx_frame_focused, image_cache::normal},
+        {resource::osx_frame_pressed, image_cache::normal},
+        {resource::osx_dropdown_button, image_cache::normal},
+        {resource::osx_dropdown_disabled_button, image_cache::normal},
+      };
+
+      const resource checkables[] = {
+        resource::osx_checkbox, resource::osx_radio,
+        resource::metal_checkbox, resource::metal_radio
+      };
+
+      struct scale_listener {
+        scale_listener () {
+          core::global::add_scale_factor_listener([] (double f) {
+            image_cache::get().prewarm(f);
+          });
+        }
+      } listener;
+
+    } // namespace
+
+    // --------------------------------------------------------------------------
+    byte image_cache::check_state (bool is_checked, bool is_disabled) {
+      return (is_checked ? checked : normal) | (is_disabled ? disabled : normal);
+    }
+
+    // lazy create static
+    image_cache& image_cache::get () {
+      static image_cache c;
+      return c;
+    }
+
+    image_cache::image_cache ()
+      : scale(0)
+      , cancel(false)
+    {}
+
+    image_cache::~image_cache () {
+      stop();
+    }
+
+    const draw::rgbmap& image_cache::get_image (resource r, byte st) {
+      return lookup(r, st).image;
+    }
+
+    draw::atlas_region image_cache::get_region (resource r, byte st) {
+      return lookup(r, st).region;
+    }
+
+    void image_cache::prewarm (double f) {
+      {
+        std::lock_guard<std::mutex> lock(guard);
+        if (scale == f) {
+          return;
+        }
+      }
+      stop();
+      {
+        std::lock_guard<std::mutex> lock(guard);
+        entries.clear();
+        atlas.clear();
+        scale = f;
+      }
+      worker = std::thread([&, f] () {
+        run(f);
+      });
+    }
+
+    void image_cache::wait () {
+      if (worker.joinable()) {
+        worker.join();
+      }
+    }
+
+    std::size_t image_cache::size () const {
+      std::lock_guard<std::mutex> lock(guard);
+      return entries.size();
+    }
+
+    double image_cache::get_scale () const {
+      std::lock_guard<std::mutex> lock(guard);
+      return scale;
+    }
+
+    std::size_t image_cache::atlas_pages () const {
+      return atlas.page_count();
+    }
+
+    // --------------------------------------------------------------------------
+    auto image_cache::make_key (resource r, byte st) -> key_type {
+      return (static_cast<key_type>(r) << 8) | st;
+    }
+
+    auto image_cache::build (resource r, byte st, double f) -> entry {
+      entry e;
+      const auto i = st & (checked | disabled);
+      switch (r) {
+        case resource::osx_checkbox:    e.image = build_scaled(osx_checkbox[i], f); break;
+        case resource::osx_radio:       e.image = build_scaled(osx_radio[i], f); break;
+        case resource::metal_checkbox:  e.image = build_scaled(metal_checkbox[i], f); break;
+        case resource::metal_radio:     e.image = build_scaled(metal_radio[i], f); break;
+        case resource::osx_dropdown_button:           e.image = build_scaled(osx_dropdown_button, f); return e;
+        case resource::osx_dropdown_disabled_button:  e.image = build_scaled(osx_dropdown_disabled_button, f); return e;
+        default:
+          e.image = build_frame(r);
+          if (st & hilited) {
+            e.image = e.image.brightness(1.025F);
+          }
+          return e;
+      }
+      e.mask = e.image.get_mask({0x01});
+      return e;
+    }
+
+    auto image_cache::lookup (resource r, byte st) -> entry& {
+      const auto f = core::global::get_scale_factor();
+      prewarm(f);
+
+      const auto key = make_key(r, st);
+      {
+        std::lock_guard<std::mutex> lock(guard);
+        auto i = entries.find(key);
+        if (i != entries.end()) {
+          return i->second;
+        }
+      }
+      return add(r, st, build(r, st, f));
+    }
+
+    auto image_cache::add (resource r, byte st, entry&& e) -> entry& {
+      std::lock_guard<std::mutex> lock(guard);
+      // keep an entry already built on demand, it may be referenced.
+      auto i = entries.emplace(make_key(r, st), std::move(e));
+      if (i.second && i.first->second.mask) {
+        i.first->second.region = atlas.add(i.first->second.image, i.first->second.mask);
+      }
+      return i.first->second;
+    }
+
+    void image_cache::run (double f) {
+      for (const auto& p : prewarm_list) {
+        if (cancel) {
+          return;
+        }
+        add(p.first, p.second, build(p.first, p.second, f));
+      }
+      for (const auto r : checkables) {
+        for (byte st = 0; st < 4; ++st) {
+          if (cancel) {
+            return;
+          }
+          add(r, st, build(r, st, f));
+        }
+      }
+    }
+
+    void image_cache::stop () {
+      cancel = true;
+      if (worker.joinable()) {
+        worker.join();
+      }
+      cancel = false;
+    }
+
+  } // namespace look
+
+} // namespace gui
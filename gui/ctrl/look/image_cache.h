@@ -0,0 +1,127 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     scale factor aware cache for the look images
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <thread>
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include "gui/draw/datamap.h"
+#include "gui/draw/bitmap.h"
+#include "gui/draw/pixmap_atlas.h"
+#include "gui/ctrl/look/gui++-look-export.h"
+
+
+namespace gui {
+
+  namespace look {
+
+    // --------------------------------------------------------------------------
+    /**
+     * Process wide cache of the images used by the looks, keyed by resource
+     * and state for the current scale factor.
+     * All entries are built on a worker thread as soon as the scale factor is
+     * set and rebuilt when it changes. A missing entry is built on demand.
+     * The masked images are packed into an atlas, its native pages are created
+     * on the main thread at first use.
+     */
+    class GUIPP_LOOK_EXPORT image_cache {
+    public:
+      enum class resource : byte {
+        button_frame,
+        button_pressed_frame,
+        button_rot_frame,
+        button_pressed_rot_frame,
+        simple_frame,
+        osx_frame,
+        osx_frame_disabled,
+        osx_frame_focused,
+        osx_frame_pressed,
+        osx_dropdown_button,
+        osx_dropdown_disabled_button,
+        osx_checkbox,
+        osx_radio,
+        metal_checkbox,
+        metal_radio
+      };
+
+      enum state : byte {
+        normal = 0,
+        checked = 1,
+        disabled = 2,
+        hilited = 4
+      };
+
+      static byte check_state (bool checked, bool disabled);
+
+      static image_cache& get ();
+
+      ~image_cache ();
+
+      /// Main thread only. References are valid until the scale factor changes.
+      const draw::rgbmap& get_image (resource, byte st = normal);
+      draw::atlas_region get_region (resource, byte st = normal);
+
+      /// Drop all entries and start building them for scale factor f on a worker thread.
+      void prewarm (double f);
+
+      /// Block until a running prewarm has finished.
+      void wait ();
+
+      std::size_t size () const;
+      double get_scale () const;
+      std::size_t atlas_pages () const;
+
+    private:
+      image_cache ();
+
+      struct entry {
+        draw::rgbmap image;
+        draw::bwmap mask;
+        draw::atlas_region region;
+      };
+
+      typedef uint32_t key_type;
+
+      static key_type make_key (resource, byte st);
+      static entry build (resource, byte st, double f);
+
+      entry& lookup (resource, byte st);
+      entry& add (resource, byte st, entry&&);
+      void run (double f);
+      void stop ();
+
+      mutable std::mutex guard;
+      std::map<key_type, entry> entries;
+      draw::pixmap_atlas atlas;
+      double scale;
+      std::thread worker;
+      std::atomic_bool cancel;
+    };
+
+  } // namespace look
+
+} // namespace gui
@@ -0,0 +1,60 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info button_frame_1x_info(9, 28, 27, gui::pixel_format_t::RGB);
+static const unsigned char button_frame_1x_pixels[] = {
+214, 214, 214, 214, 214, 214, 203, 203, 203, 186, 186, 186, 179, 179, 179, 186, 186, 186, 203, 203, 203, 214, 214, 214,
+214, 214, 214,
+214, 214, 214, 202, 202, 202, 190, 190, 190, 247, 247, 247, 254, 254, 254, 247, 247, 247, 191, 191, 191, 202, 202, 202,
+214, 214, 214,
+214, 214, 214, 182, 182, 182, 244, 244, 244, 248, 248, 248, 243, 243, 243, 248, 248, 248, 244, 244, 244, 182, 182, 182,
+214, 214, 214,
+214, 214, 214, 170, 170, 170, 252, 252, 252, 240, 240, 240, 240, 240, 240, 240, 240, 240, 252, 252, 252, 170, 170, 170,
+214, 214, 214,
+214, 214, 214, 169, 169, 169, 251, 251, 251, 239, 239, 239, 239, 239, 239, 239, 239, 239, 251, 251, 251, 169, 169, 169,
+214, 214, 214,
+214, 214, 214, 168, 168, 168, 251, 251, 251, 238, 238, 238, 238, 238, 238, 238, 238, 238, 251, 251, 251, 168, 168, 168,
+214, 214, 214,
+214, 214, 214, 166, 166, 166, 250, 250, 250, 237, 237, 237, 237, 237, 237, 237, 237, 237, 250, 250, 250, 166, 166, 166,
+214, 214, 214,
+214, 214, 214, 165, 165, 165, 249, 249, 249, 236, 236, 236, 236, 236, 236, 236, 236, 236, 249, 249, 249, 165, 165, 165,
+214, 214, 214,
+214, 214, 214, 164, 164, 164, 248, 248, 248, 235, 235, 235, 235, 235, 235, 235, 235, 235, 248, 248, 248, 164, 164, 164,
+214, 214, 214,
+214, 214, 214, 163, 163, 163, 248, 248, 248, 234, 234, 234, 234, 234, 234, 234, 234, 234, 248, 248, 248, 163, 163, 163,
+214, 214, 214,
+214, 214, 214, 162, 162, 162, 247, 247, 247, 233, 233, 233, 233, 233, 233, 233, 233, 233, 247, 247, 247, 162, 162, 162,
+214, 214, 214,
+214, 214, 214, 160, 160, 160, 245, 245, 245, 231, 231, 231, 231, 231, 231, 231, 231, 231, 245, 245, 245, 160, 160, 160,
+214, 214, 214,
+214, 214, 214, 159, 159, 159, 244, 244, 244, 230, 230, 230, 230, 230, 230, 230, 230, 230, 244, 244, 244, 159, 159, 159,
+214, 214, 214,
+213, 213, 213, 159, 159, 159, 243, 243, 243, 229, 229, 229, 229, 229, 229, 229, 229, 229, 243, 243, 243, 159, 159, 159,
+213, 213, 213,
+212, 212, 212, 158, 158, 158, 241, 241, 241, 227, 227, 227, 227, 227, 227, 227, 227, 227, 241, 241, 241, 158, 158, 158,
+212, 212, 212,
+211, 211, 211, 157, 157, 157, 240, 240, 240, 226, 226, 226, 226, 226, 226, 226, 226, 226, 240, 240, 240, 157, 157, 157,
+211, 211, 211,
+209, 209, 209, 156, 156, 156, 239, 239, 239, 225, 225, 225, 225, 225, 225, 225, 225, 225, 239, 239, 239, 156, 156, 156,
+209, 209, 209,
+207, 207, 207, 155, 155, 155, 238, 238, 238, 224, 224, 224, 224, 224, 224, 224, 224, 224, 238, 238, 238, 155, 155, 155,
+207, 207, 207,
+206, 206, 206, 153, 153, 153, 236, 236, 236, 222, 222, 222, 222, 222, 222, 222, 222, 222, 236, 236, 236, 153, 153, 153,
+206, 206, 206,
+205, 205, 205, 152, 152, 152, 234, 234, 234, 221, 221, 221, 221, 221, 221, 221, 221, 221, 234, 234, 234, 152, 152, 152,
+205, 205, 205,
+203, 203, 203, 151, 151, 151, 232, 232, 232, 220, 220, 220, 220, 220, 220, 220, 220, 220, 232, 232, 232, 151, 151, 151,
+203, 203, 203,
+201, 201, 201, 151, 151, 151, 230, 230, 230, 219, 219, 219, 219, 219, 219, 219, 219, 219, 230, 230, 230, 151, 151, 151,
+201, 201, 201,
+201, 201, 201, 150, 150, 150, 228, 228, 228, 218, 218, 218, 218, 218, 218, 218, 218, 218, 227, 227, 227, 150, 150, 150,
+201, 201, 201,
+200, 200, 200, 150, 150, 150, 228, 228, 228, 218, 218, 218, 218, 218, 218, 218, 218, 218, 227, 227, 227, 150, 150, 150,
+200, 200, 200,
+198, 198, 198, 160, 160, 160, 206, 206, 206, 219, 219, 219, 215, 215, 215, 219, 219, 219, 206, 206, 206, 160, 160, 160,
+198, 198, 198,
+203, 203, 203, 183, 183, 183, 154, 154, 154, 200, 200, 200, 216, 216, 216, 200, 200, 200, 154, 154, 154, 182, 182, 182,
+204, 204, 204,
+213, 213, 213, 194, 194, 194, 180, 180, 180, 156, 156, 156, 143, 143, 143, 156, 156, 156, 179, 179, 179, 195, 195, 195,
+214, 214, 214,
+214, 214, 214, 213, 213, 213, 201, 201, 201, 189, 189, 189, 185, 185, 185, 189, 189, 189, 201, 201, 201, 213, 213, 213,
+214, 214, 214
+};
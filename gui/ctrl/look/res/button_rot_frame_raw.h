@@ -0,0 +1,40 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info button_rot_frame_1x_info(28, 9, 84, gui::pixel_format_t::RGB);
+static const unsigned char button_rot_frame_1x_pixels[] = {
+214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 213, 213, 213, 212, 212, 212, 211, 211, 211,
+209, 209, 209, 207, 207, 207, 206, 206, 206, 205, 205, 205, 203, 203, 203, 201, 201, 201, 201, 201, 201, 200, 200, 200,
+198, 198, 198, 204, 204, 204, 214, 214, 214, 214, 214, 214,
+214, 214, 214, 202, 202, 202, 182, 182, 182, 170, 170, 170, 169, 169, 169, 168, 168, 168, 166, 166, 166, 165, 165, 165,
+164, 164, 164, 163, 163, 163, 162, 162, 162, 160, 160, 160, 159, 159, 159, 159, 159, 159, 158, 158, 158, 157, 157, 157,
+156, 156, 156, 155, 155, 155, 153, 153, 153, 152, 152, 152, 151, 151, 151, 151, 151, 151, 150, 150, 150, 150, 150, 150,
+160, 160, 160, 182, 182, 182, 195, 195, 195, 213, 213, 213,
+203, 203, 203, 191, 191, 191, 244, 244, 244, 252, 252, 252, 251, 251, 251, 251, 251, 251, 250, 250, 250, 249, 249, 249,
+248, 248, 248, 248, 248, 248, 247, 247, 247, 245, 245, 245, 244, 244, 244, 243, 243, 243, 241, 241, 241, 240, 240, 240,
+239, 239, 239, 238, 238, 238, 236, 236, 236, 234, 234, 234, 232, 232, 232, 230, 230, 230, 227, 227, 227, 227, 227, 227,
+206, 206, 206, 154, 154, 154, 179, 179, 179, 201, 201, 201,
+186, 186, 186, 247, 247, 247, 248, 248, 248, 240, 240, 240, 239, 239, 239, 238, 238, 238, 237, 237, 237, 236, 236, 236,
+235, 235, 235, 234, 234, 234, 233, 233, 233, 231, 231, 231, 230, 230, 230, 229, 229, 229, 227, 227, 227, 226, 226, 226,
+225, 225, 225, 224, 224, 224, 222, 222, 222, 221, 221, 221, 220, 220, 220, 219, 219, 219, 218, 218, 218, 218, 218, 218,
+219, 219, 219, 200, 200, 200, 156, 156, 156, 189, 189, 189,
+179, 179, 179, 254, 254, 254, 243, 243, 243, 240, 240, 240, 239, 239, 239, 238, 238, 238, 237, 237, 237, 236, 236, 236,
+235, 235, 235, 234, 234, 234, 233, 233, 233, 231, 231, 231, 230, 230, 230, 229, 229, 229, 227, 227, 227, 226, 226, 226,
+225, 225, 225, 224, 224, 224, 222, 222, 222, 221, 221, 221, 220, 220, 220, 219, 219, 219, 218, 218, 218, 218, 218, 218,
+219, 219, 219, 216, 216, 216, 143, 143, 143, 185, 185, 185,
+186, 186, 186, 247, 247, 247, 248, 248, 248, 240, 240, 240, 239, 239, 239, 238, 238, 238, 237, 237, 237, 236, 236, 236,
+235, 235, 235, 234, 234, 234, 233, 233, 233, 231, 231, 231, 230, 230, 230, 229, 229, 229, 227, 227, 227, 226, 226, 226,
+225, 225, 225, 224, 224, 224, 222, 222, 222, 221, 221, 221, 220, 220, 220, 219, 219, 219, 218, 218, 218, 218, 218, 218,
+219, 219, 219, 200, 200, 200, 156, 156, 156, 189, 189, 189,
+203, 203, 203, 190, 190, 190, 244, 244, 244, 252, 252, 252, 251, 251, 251, 251, 251, 251, 250, 250, 250, 249, 249, 249,
+248, 248, 248, 248, 248, 248, 247, 247, 247, 245, 245, 245, 244, 244, 244, 243, 243, 243, 241, 241, 241, 240, 240, 240,
+239, 239, 239, 238, 238, 238, 236, 236, 236, 234, 234, 234, 232, 232, 232, 230, 230, 230, 228, 228, 228, 228, 228, 228,
+206, 206, 206, 154, 154, 154, 180, 180, 180, 201, 201, 201,
+214, 214, 214, 202, 202, 202, 182, 182, 182, 170, 170, 170, 169, 169, 169, 168, 168, 168, 166, 166, 166, 165, 165, 165,
+164, 164, 164, 163, 163, 163, 162, 162, 162, 160, 160, 160, 159, 159, 159, 159, 159, 159, 158, 158, 158, 157, 157, 157,
+156, 156, 156, 155, 155, 155, 153, 153, 153, 152, 152, 152, 151, 151, 151, 151, 151, 151, 150, 150, 150, 150, 150, 150,
+160, 160, 160, 183, 183, 183, 194, 194, 194, 213, 213, 213,
+214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214, 213, 213, 213, 212, 212, 212, 211, 211, 211,
+209, 209, 209, 207, 207, 207, 206, 206, 206, 205, 205, 205, 203, 203, 203, 201, 201, 201, 201, 201, 201, 200, 200, 200,
+198, 198, 198, 203, 203, 203, 213, 213, 213, 214, 214, 214
+};
@@ -0,0 +1,167 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info metal_check_disabled_on_1x_info(16, 16, 48, gui::pixel_format_t::RGB);
+static const unsigned char metal_check_disabled_on_1x_pixels[] = {
+250, 250, 250, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 199, 199, 199,   0,   0,   0,
+171, 171, 171, 241, 241, 241, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 181, 181, 181, 225, 225, 225,
+171, 171, 171, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 219, 219, 219, 173, 173, 173,
+171, 171, 171, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 187, 187, 187, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 174, 174, 174, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 229, 229, 229, 239, 239, 239, 239, 239, 239,
+239, 239, 239, 239, 239, 239, 233, 233, 233, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 238, 238, 238, 238, 238, 238, 238, 238, 238, 224, 224, 224, 171, 171, 171, 211, 211, 211, 238, 238, 238,
+238, 238, 238, 205, 205, 205, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 217, 217, 217, 171, 171, 171,
+171, 171, 171, 236, 236, 236, 236, 236, 236, 224, 224, 224, 171, 171, 171, 171, 171, 171, 171, 171, 171, 210, 210, 210,
+216, 216, 216, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 221, 221, 221, 236, 236, 236, 171, 171, 171,
+171, 171, 171, 234, 234, 234, 234, 234, 234, 234, 234, 234, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 233, 233, 233, 234, 234, 234, 234, 234, 234, 171, 171, 171,
+171, 171, 171, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 177, 177, 177, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 171, 171, 171,
+171, 171, 171, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 197, 197, 197, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 171, 171, 171,
+171, 171, 171, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 171, 171, 171,
+220, 220, 220, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 171, 171, 171,
+171, 171, 171, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 171, 171, 171,
+171, 171, 171, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 213, 213, 213, 189, 189, 189,
+199, 199, 199, 182, 182, 182, 224, 224, 224, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 223, 223, 223, 171, 171, 171,   0,   0,   0,
+  0,   0,   0, 225, 225, 225, 173, 173, 173, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 189, 189, 189,   0,   0,   0, 255, 255, 255
+};
+static const gui::draw::bitmap_info metal_check_disabled_on_2x_info(32, 32, 96, gui::pixel_format_t::RGB);
+static const unsigned char metal_check_disabled_on_2x_pixels[] = {
+  0,   0,   0,   0,   0,   0,   0,   0,   0, 225, 225, 225, 189, 189, 189, 173, 173, 173, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 173, 173, 173, 189, 189, 189, 225, 225, 225,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0, 250, 250, 250, 198, 198, 198, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 199, 199, 199, 250, 250, 250,   0,   0,   0,
+  0,   0,   0, 198, 198, 198, 171, 171, 171, 182, 182, 182, 223, 223, 223, 241, 241, 241, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 241, 241, 241, 223, 223, 223, 182, 182, 182, 171, 171, 171, 199, 199, 199,   0,   0,   0,
+225, 225, 225, 171, 171, 171, 182, 182, 182, 241, 241, 241, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 240, 240, 240, 181, 181, 181, 171, 171, 171, 225, 225, 225,
+189, 189, 189, 171, 171, 171, 226, 226, 226, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 226, 226, 226, 171, 171, 171, 189, 189, 189,
+173, 173, 173, 171, 171, 171, 242, 242, 242, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 219, 219, 219, 171, 171, 171, 173, 173, 173,
+171, 171, 171, 171, 171, 171, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 238, 238, 238, 200, 200, 200, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 226, 226, 226, 187, 187, 187, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242, 242,
+242, 242, 242, 209, 209, 209, 178, 178, 178, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+217, 217, 217, 174, 174, 174, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 239, 239, 239, 217, 217, 217,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+239, 239, 239, 239, 239, 239, 239, 239, 239, 229, 229, 229, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 233, 233, 233, 199, 199, 199, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+239, 239, 239, 239, 239, 239, 224, 224, 224, 176, 176, 176, 212, 212, 212, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 222, 222, 222, 186, 186, 186, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238, 238,
+238, 238, 238, 224, 224, 224, 171, 171, 171, 171, 171, 171, 176, 176, 176, 211, 211, 211, 238, 238, 238, 238, 238, 238,
+238, 238, 238, 238, 238, 238, 238, 238, 238, 205, 205, 205, 177, 177, 177, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 175, 175, 175, 217, 217, 217, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+224, 224, 224, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 176, 176, 176, 211, 211, 211, 237, 237, 237,
+237, 237, 237, 237, 237, 237, 218, 218, 218, 174, 174, 174, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 178, 178, 178, 206, 206, 206, 237, 237, 237, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 224, 224, 224,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 176, 176, 176, 210, 210, 210,
+235, 235, 235, 216, 216, 216, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 187, 187, 187, 221, 221, 221, 236, 236, 236, 236, 236, 236, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 224, 224, 224,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 175, 175, 175,
+183, 183, 183, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 199, 199, 199, 230, 230, 230, 235, 235, 235, 235, 235, 235, 235, 235, 235, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+224, 224, 224, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+216, 216, 216, 233, 233, 233, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+234, 234, 234, 224, 224, 224, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 175, 175, 175, 218, 218, 218,
+234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+233, 233, 233, 233, 233, 233, 224, 224, 224, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 177, 177, 177, 204, 204, 204, 233, 233, 233,
+233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+232, 232, 232, 232, 232, 232, 232, 232, 232, 224, 224, 224, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 186, 186, 186, 217, 217, 217, 232, 232, 232, 232, 232, 232,
+232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 224, 224, 224, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 197, 197, 197, 226, 226, 226, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 224, 224, 224, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 215, 215, 215, 230, 230, 230, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 224, 224, 224, 171, 171, 171,
+175, 175, 175, 220, 220, 220, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 224, 224, 224,
+205, 205, 205, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 171, 171, 171, 171, 171, 171,
+173, 173, 173, 171, 171, 171, 226, 226, 226, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 226, 226, 226, 171, 171, 171, 173, 173, 173,
+189, 189, 189, 171, 171, 171, 213, 213, 213, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 213, 213, 213, 171, 171, 171, 189, 189, 189,
+225, 225, 225, 171, 171, 171, 182, 182, 182, 240, 240, 240, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 224, 224, 224, 181, 181, 181, 171, 171, 171, 225, 225, 225,
+  0,   0,   0, 199, 199, 199, 171, 171, 171, 182, 182, 182, 223, 223, 223, 224, 224, 224, 225, 225, 225, 225, 225, 225,
+225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+225, 225, 225, 225, 225, 225, 224, 224, 224, 223, 223, 223, 181, 181, 181, 171, 171, 171, 199, 199, 199,   0,   0,   0,
+  0,   0,   0, 250, 250, 250, 199, 199, 199, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 199, 199, 199, 250, 250, 250,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0, 225, 225, 225, 189, 189, 189, 173, 173, 173, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171, 171,
+171, 171, 171, 171, 171, 171, 173, 173, 173, 189, 189, 189, 225, 225, 225,   0,   0,   0,   0,   0,   0, 255, 255, 255
+};
@@ -0,0 +1,167 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info metal_check_on_1x_info(16, 16, 48, gui::pixel_format_t::RGB);
+static const unsigned char metal_check_on_1x_pixels[] = {
+249, 249, 249, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 196, 196, 196,   0,   0,   0,
+167, 167, 167, 235, 235, 235, 237, 237, 237, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 237, 237, 237, 177, 177, 177, 224, 224, 224,
+167, 167, 167, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 144, 144, 144, 169, 169, 169,
+167, 167, 167, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,  89,  89,  89,  51,  51,  51, 167, 167, 167,
+167, 167, 167, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,  57,  57,  57,  51,  51,  51,  51,  51,  51, 167, 167, 167,
+167, 167, 167, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 219, 219, 219, 230, 230, 230, 230, 230, 230,
+230, 230, 230, 230, 230, 230, 224, 224, 224,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51, 167, 167, 167,
+167, 167, 167, 229, 229, 229, 229, 229, 229, 229, 229, 229, 153, 153, 153,  51,  51,  51, 199, 199, 199, 229, 229, 229,
+229, 229, 229, 193, 193, 193,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51, 171, 171, 171, 167, 167, 167,
+167, 167, 167, 227, 227, 227, 227, 227, 227, 154, 154, 154,  51,  51,  51,  51,  51,  51,  51,  51,  51, 198, 198, 198,
+139, 139, 139,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51, 210, 210, 210, 227, 227, 227, 167, 167, 167,
+167, 167, 167, 225, 225, 225, 225, 225, 225, 225, 225, 225,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51, 224, 224, 224, 225, 225, 225, 225, 225, 225, 167, 167, 167,
+167, 167, 167, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51,  51,  51,  51,  69,  69,  69, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 167, 167, 167,
+167, 167, 167, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51, 110, 110, 110, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 167, 167, 167,
+167, 167, 167, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,  51,  51,  51,
+165, 165, 165, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 167, 167, 167,
+167, 167, 167, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 167, 167, 167,
+167, 167, 167, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 202, 202, 202, 186, 186, 186,
+196, 196, 196, 174, 174, 174, 214, 214, 214, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 201, 201, 201, 167, 167, 167,   0,   0,   0,
+  0,   0,   0, 224, 224, 224, 156, 156, 156, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 186, 186, 186,   0,   0,   0,   0,   0,   0
+};
+static const gui::draw::bitmap_info metal_check_on_2x_info(32, 32, 96, gui::pixel_format_t::RGB);
+static const unsigned char metal_check_on_2x_pixels[] = {
+  0,   0,   0,   0,   0,   0,   0,   0,   0, 224, 224, 224, 186, 186, 186, 169, 169, 169, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 169, 169, 169, 186, 186, 186, 224, 224, 224,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0, 249, 249, 249, 196, 196, 196, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 196, 196, 196, 249, 249, 249,   0,   0,   0,
+  0,   0,   0, 196, 196, 196, 167, 167, 167, 177, 177, 177, 217, 217, 217, 236, 236, 236, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 236, 236, 236, 217, 217, 217, 177, 177, 177, 167, 167, 167, 196, 196, 196,   0,   0,   0,
+224, 224, 224, 167, 167, 167, 177, 177, 177, 235, 235, 235, 237, 237, 237, 237, 237, 237, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 237, 237, 237, 237, 237, 237, 234, 234, 234, 177, 177, 177, 167, 167, 167, 224, 224, 224,
+186, 186, 186, 167, 167, 167, 216, 216, 216, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 216, 216, 216, 167, 167, 167, 186, 186, 186,
+169, 169, 169, 167, 167, 167, 233, 233, 233, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 234, 234, 234, 144, 144, 144, 167, 167, 167, 169, 169, 169,
+167, 167, 167, 167, 167, 167, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 229, 229, 229, 115, 115, 115,  51,  51,  51, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+234, 234, 234, 234, 234, 234, 216, 216, 216,  89,  89,  89,  51,  51,  51,  51,  51,  51, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+233, 233, 233, 197, 197, 197,  70,  70,  70,  51,  51,  51,  51,  51,  51,  51,  51,  51, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+173, 173, 173,  57,  57,  57,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 230, 230, 230, 142, 142, 142,
+ 51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+230, 230, 230, 230, 230, 230, 230, 230, 230, 219, 219, 219, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 224, 224, 224, 112, 112, 112,  51,  51,  51,
+ 51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+230, 230, 230, 230, 230, 230, 154, 154, 154,  67,  67,  67, 200, 200, 200, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 212, 212, 212,  88,  88,  88,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+229, 229, 229, 153, 153, 153,  51,  51,  51,  51,  51,  51,  66,  66,  66, 199, 199, 199, 229, 229, 229, 229, 229, 229,
+229, 229, 229, 229, 229, 229, 229, 229, 229, 193, 193, 193,  69,  69,  69,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  58,  58,  58, 171, 171, 171, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+153, 153, 153,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  66,  66,  66, 199, 199, 199, 228, 228, 228,
+228, 228, 228, 228, 228, 228, 169, 169, 169,  57,  57,  57,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51,  51,  51,  51,  51,  51,  51,  70,  70,  70, 194, 194, 194, 228, 228, 228, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 154, 154, 154,
+ 51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  66,  66,  66, 198, 198, 198,
+226, 226, 226, 139, 139, 139,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51,  51,  51,  51,  89,  89,  89, 210, 210, 210, 227, 227, 227, 227, 227, 227, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 153, 153, 153,
+ 51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  60,  60,  60,
+ 81,  81,  81,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51, 112, 112, 112, 220, 220, 220, 226, 226, 226, 226, 226, 226, 226, 226, 226, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+152, 152, 152,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+140, 140, 140, 224, 224, 224, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+225, 225, 225, 152, 152, 152,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  58,  58,  58, 169, 169, 169,
+225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+224, 224, 224, 224, 224, 224, 152, 152, 152,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  69,  69,  69, 190, 190, 190, 224, 224, 224,
+224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223,
+223, 223, 223, 223, 223, 223, 223, 223, 223, 151, 151, 151,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  51,  87,  87,  87, 206, 206, 206, 223, 223, 223, 223, 223, 223,
+223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 151, 151, 151,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51,  51,  51,  51,  51,  51,  51, 110, 110, 110, 216, 216, 216, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 150, 150, 150,  51,  51,  51,  51,  51,  51,
+ 51,  51,  51,  51,  51,  51, 138, 138, 138, 220, 220, 220, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 150, 150, 150,  51,  51,  51,
+ 58,  58,  58, 165, 165, 165, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 155, 155, 155,
+188, 188, 188, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 167, 167, 167, 167, 167, 167,
+169, 169, 169, 167, 167, 167, 216, 216, 216, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 216, 216, 216, 167, 167, 167, 169, 169, 169,
+186, 186, 186, 167, 167, 167, 202, 202, 202, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 202, 202, 202, 167, 167, 167, 186, 186, 186,
+224, 224, 224, 167, 167, 167, 174, 174, 174, 214, 214, 214, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 214, 214, 214, 174, 174, 174, 167, 167, 167, 224, 224, 224,
+  0,   0,   0, 196, 196, 196, 167, 167, 167, 174, 174, 174, 201, 201, 201, 214, 214, 214, 215, 215, 215, 215, 215, 215,
+215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+215, 215, 215, 215, 215, 215, 214, 214, 214, 201, 201, 201, 174, 174, 174, 167, 167, 167, 196, 196, 196,   0,   0,   0,
+  0,   0,   0, 249, 249, 249, 196, 196, 196, 167, 167, 167, 167, 167, 167, 155, 155, 155, 146, 146, 146, 146, 146, 146,
+146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+146, 146, 146, 146, 146, 146, 154, 154, 154, 167, 167, 167, 167, 167, 167, 196, 196, 196, 249, 249, 249,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0, 224, 224, 224, 186, 186, 186, 156, 156, 156, 146, 146, 146, 146, 146, 146,
+146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+146, 146, 146, 146, 146, 146, 155, 155, 155, 186, 186, 186, 224, 224, 224,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
@@ -0,0 +1,167 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info metal_radio_disabled_on_1x_info(16, 16, 48, gui::pixel_format_t::RGB);
+static const unsigned char metal_radio_disabled_on_1x_pixels[] = {
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 207, 207, 207, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 174, 174, 174, 249, 249, 249,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 249, 249, 249, 167, 167, 167, 194, 194, 194, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 168, 168, 168, 192, 192, 192,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0, 249, 249, 249, 167, 167, 167, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 189, 189, 189, 180, 180, 180,   0,   0,   0,   0,   0,   0,
+  0,   0,   0, 167, 167, 167, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 179, 179, 179, 216, 216, 216,   0,   0,   0,
+207, 207, 207, 192, 192, 192, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 167, 167, 167,   0,   0,   0,
+167, 167, 167, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 247, 247, 247, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 215, 215, 215, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 181, 181, 181, 233, 233, 233,
+167, 167, 167, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 249, 249, 249, 244, 244, 244, 244, 244, 244, 244, 244, 244, 225, 225, 225, 189, 189, 189,
+167, 167, 167, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 168, 168, 168, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 171, 171, 171,
+167, 167, 167, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 204, 204, 204, 244, 244, 244, 244, 244, 244, 244, 244, 244, 237, 237, 237, 180, 180, 180,
+167, 167, 167, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 214, 214, 214, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 245, 245, 245, 244, 244, 244, 244, 244, 244, 244, 244, 244, 197, 197, 197, 205, 205, 205,
+174, 174, 174, 233, 233, 233, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 249, 249, 249, 168, 168, 168,
+204, 204, 204, 245, 245, 245, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 167, 167, 167, 254, 254, 254,
+249, 249, 249, 168, 168, 168, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 214, 214, 214, 173, 173, 173,   0,   0,   0,
+  0,   0,   0, 192, 192, 192, 184, 184, 184, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 241, 241, 241, 167, 167, 167, 254, 254, 254,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 180, 180, 180, 176, 176, 176, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 209, 209, 209, 167, 167, 167, 244, 244, 244,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0, 216, 216, 216, 167, 167, 167, 178, 178, 178, 204, 204, 204, 225, 225, 225,
+209, 209, 209, 193, 193, 193, 167, 167, 167, 173, 173, 173, 254, 254, 254,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 233, 233, 233, 189, 189, 189, 171, 171, 171,
+180, 180, 180, 205, 205, 205, 254, 254, 254,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255
+};
+static const gui::draw::bitmap_info metal_radio_disabled_on_2x_info(32, 32, 96, gui::pixel_format_t::RGB);
+static const unsigned char metal_radio_disabled_on_2x_pixels[] = {
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 254, 254, 254, 233, 233, 233, 205, 205, 205, 189, 189, 189, 180, 180, 180, 171, 171, 171,
+171, 171, 171, 180, 180, 180, 189, 189, 189, 205, 205, 205, 233, 233, 233, 254, 254, 254,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+249, 249, 249, 207, 207, 207, 174, 174, 174, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 174, 174, 174, 207, 207, 207, 249, 249, 249,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 254, 254, 254, 215, 215, 215,
+173, 173, 173, 167, 167, 167, 167, 167, 167, 182, 182, 182, 204, 204, 204, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 204, 204, 204, 182, 182, 182, 167, 167, 167, 167, 167, 167, 173, 173, 173,
+215, 215, 215, 254, 254, 254,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 249, 249, 249, 191, 191, 191, 167, 167, 167,
+168, 168, 168, 194, 194, 194, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 194, 194, 194, 168, 168, 168,
+167, 167, 167, 192, 192, 192, 249, 249, 249,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 243, 243, 243, 180, 180, 180, 167, 167, 167, 180, 180, 180,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+180, 180, 180, 167, 167, 167, 180, 180, 180, 243, 243, 243,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0, 249, 249, 249, 180, 180, 180, 167, 167, 167, 189, 189, 189, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 189, 189, 189, 167, 167, 167, 180, 180, 180, 249, 249, 249,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 254, 254, 254, 192, 192, 192, 167, 167, 167, 189, 189, 189, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 189, 189, 189, 167, 167, 167, 192, 192, 192, 254, 254, 254,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 215, 215, 215, 167, 167, 167, 179, 179, 179, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 179, 179, 179, 167, 167, 167, 216, 216, 216,   0,   0,   0,   0,   0,   0,
+  0,   0,   0, 249, 249, 249, 173, 173, 173, 168, 168, 168, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 168, 168, 168, 173, 173, 173, 249, 249, 249,   0,   0,   0,
+  0,   0,   0, 207, 207, 207, 167, 167, 167, 192, 192, 192, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 191, 191, 191, 167, 167, 167, 207, 207, 207,   0,   0,   0,
+254, 254, 254, 174, 174, 174, 167, 167, 167, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 245, 245, 245, 249, 249, 249, 205, 205, 205, 169, 169, 169,
+169, 169, 169, 205, 205, 205, 249, 249, 249, 245, 245, 245, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 167, 167, 167, 174, 174, 174, 254, 254, 254,
+233, 233, 233, 167, 167, 167, 181, 181, 181, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 247, 247, 247, 215, 215, 215, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 163, 163, 215, 215, 215, 247, 247, 247, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 181, 181, 181, 167, 167, 167, 233, 233, 233,
+205, 205, 205, 167, 167, 167, 199, 199, 199, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 245, 245, 245, 214, 214, 214, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 214, 214, 214, 245, 245, 245, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 199, 199, 199, 167, 167, 167, 205, 205, 205,
+189, 189, 189, 167, 167, 167, 225, 225, 225, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 249, 249, 249, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 249, 249, 249, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 225, 225, 225, 167, 167, 167, 189, 189, 189,
+180, 180, 180, 167, 167, 167, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 205, 205, 205, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 205, 205, 205, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 167, 167, 167, 180, 180, 180,
+171, 171, 171, 167, 167, 167, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 168, 168, 168, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 168, 168, 168, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 167, 167, 167, 171, 171, 171,
+171, 171, 171, 167, 167, 167, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 168, 168, 168, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 168, 168, 168, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 167, 167, 167, 171, 171, 171,
+180, 180, 180, 167, 167, 167, 237, 237, 237, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 204, 204, 204, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 204, 204, 204, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 237, 237, 237, 167, 167, 167, 180, 180, 180,
+189, 189, 189, 167, 167, 167, 211, 211, 211, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 249, 249, 249, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 249, 249, 249, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 211, 211, 211, 167, 167, 167, 189, 189, 189,
+205, 205, 205, 167, 167, 167, 197, 197, 197, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 245, 245, 245, 214, 214, 214, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 214, 214, 214, 245, 245, 245, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 197, 197, 197, 167, 167, 167, 205, 205, 205,
+233, 233, 233, 167, 167, 167, 179, 179, 179, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 247, 247, 247, 214, 214, 214, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+163, 163, 163, 163, 163, 163, 163, 163, 163, 214, 214, 214, 247, 247, 247, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 179, 179, 179, 167, 167, 167, 233, 233, 233,
+254, 254, 254, 174, 174, 174, 167, 167, 167, 233, 233, 233, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 245, 245, 245, 249, 249, 249, 204, 204, 204, 168, 168, 168,
+168, 168, 168, 204, 204, 204, 249, 249, 249, 245, 245, 245, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 233, 233, 233, 167, 167, 167, 174, 174, 174, 254, 254, 254,
+  0,   0,   0, 207, 207, 207, 167, 167, 167, 188, 188, 188, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 187, 187, 187, 167, 167, 167, 207, 207, 207,   0,   0,   0,
+  0,   0,   0, 249, 249, 249, 173, 173, 173, 168, 168, 168, 220, 220, 220, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 214, 214, 214, 168, 168, 168, 173, 173, 173, 249, 249, 249,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 215, 215, 215, 167, 167, 167, 177, 177, 177, 241, 241, 241, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 241, 241, 241, 177, 177, 177, 167, 167, 167, 216, 216, 216,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 254, 254, 254, 192, 192, 192, 167, 167, 167, 184, 184, 184, 241, 241, 241, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+244, 244, 244, 241, 241, 241, 183, 183, 183, 167, 167, 167, 192, 192, 192, 254, 254, 254,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0, 249, 249, 249, 180, 180, 180, 167, 167, 167, 184, 184, 184, 233, 233, 233,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+233, 233, 233, 183, 183, 183, 167, 167, 167, 181, 181, 181, 250, 250, 250,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 243, 243, 243, 180, 180, 180, 167, 167, 167, 176, 176, 176,
+209, 209, 209, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 209, 209, 209,
+176, 176, 176, 167, 167, 167, 180, 180, 180, 244, 244, 244,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 249, 249, 249, 192, 192, 192, 167, 167, 167,
+168, 168, 168, 186, 186, 186, 211, 211, 211, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 211, 211, 211, 186, 186, 186, 168, 168, 168,
+167, 167, 167, 192, 192, 192, 249, 249, 249,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 254, 254, 254, 216, 216, 216,
+173, 173, 173, 167, 167, 167, 167, 167, 167, 178, 178, 178, 193, 193, 193, 204, 204, 204, 209, 209, 209, 225, 225, 225,
+225, 225, 225, 209, 209, 209, 204, 204, 204, 193, 193, 193, 178, 178, 178, 167, 167, 167, 167, 167, 167, 173, 173, 173,
+216, 216, 216, 254, 254, 254,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+249, 249, 249, 207, 207, 207, 174, 174, 174, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 174, 174, 174, 207, 207, 207, 249, 249, 249,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 254, 254, 254, 233, 233, 233, 205, 205, 205, 189, 189, 189, 180, 180, 180, 171, 171, 171,
+171, 171, 171, 180, 180, 180, 189, 189, 189, 205, 205, 205, 233, 233, 233, 254, 254, 254,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255
+};
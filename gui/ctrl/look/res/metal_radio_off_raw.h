@@ -0,0 +1,167 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info metal_radio_off_1x_info(16, 16, 48, gui::pixel_format_t::RGB);
+static const unsigned char metal_radio_off_1x_pixels[] = {
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 207, 207, 207, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 174, 174, 174, 249, 249, 249,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 249, 249, 249, 167, 167, 167, 194, 194, 194, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+236, 236, 236, 236, 236, 236, 228, 228, 228, 168, 168, 168, 192, 192, 192,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0, 249, 249, 249, 167, 167, 167, 232, 232, 232, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 189, 189, 189, 180, 180, 180,   0,   0,   0,   0,   0,   0,
+  0,   0,   0, 167, 167, 167, 230, 230, 230, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 179, 179, 179, 216, 216, 216,   0,   0,   0,
+207, 207, 207, 192, 192, 192, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 167, 167, 167,   0,   0,   0,
+167, 167, 167, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 181, 181, 181, 233, 233, 233,
+167, 167, 167, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 214, 214, 214, 189, 189, 189,
+167, 167, 167, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 224, 224, 224, 171, 171, 171,
+167, 167, 167, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 217, 217, 217, 180, 180, 180,
+167, 167, 167, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 197, 197, 197, 205, 205, 205,
+174, 174, 174, 216, 216, 216, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 167, 167, 167, 254, 254, 254,
+249, 249, 249, 168, 168, 168, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 212, 212, 212, 173, 173, 173,   0,   0,   0,
+  0,   0,   0, 192, 192, 192, 184, 184, 184, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 218, 218, 218, 167, 167, 167, 254, 254, 254,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 180, 180, 180, 176, 176, 176, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+218, 218, 218, 218, 218, 218, 218, 218, 218, 209, 209, 209, 167, 167, 167, 244, 244, 244,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0, 216, 216, 216, 167, 167, 167, 178, 178, 178, 204, 204, 204, 214, 214, 214,
+209, 209, 209, 193, 193, 193, 167, 167, 167, 173, 173, 173, 254, 254, 254,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 233, 233, 233, 189, 189, 189, 171, 171, 171,
+180, 180, 180, 205, 205, 205, 254, 254, 254,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255
+};
+static const gui::draw::bitmap_info metal_radio_off_2x_info(32, 32, 96, gui::pixel_format_t::RGB);
+static const unsigned char metal_radio_off_2x_pixels[] = {
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 254, 254, 254, 233, 233, 233, 205, 205, 205, 189, 189, 189, 180, 180, 180, 171, 171, 171,
+171, 171, 171, 180, 180, 180, 189, 189, 189, 205, 205, 205, 233, 233, 233, 254, 254, 254,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+249, 249, 249, 207, 207, 207, 174, 174, 174, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 174, 174, 174, 207, 207, 207, 249, 249, 249,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 254, 254, 254, 215, 215, 215,
+173, 173, 173, 167, 167, 167, 167, 167, 167, 182, 182, 182, 204, 204, 204, 220, 220, 220, 227, 227, 227, 234, 234, 234,
+234, 234, 234, 227, 227, 227, 220, 220, 220, 204, 204, 204, 182, 182, 182, 167, 167, 167, 167, 167, 167, 173, 173, 173,
+215, 215, 215, 254, 254, 254,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 249, 249, 249, 191, 191, 191, 167, 167, 167,
+168, 168, 168, 194, 194, 194, 228, 228, 228, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 228, 228, 228, 194, 194, 194, 168, 168, 168,
+167, 167, 167, 192, 192, 192, 249, 249, 249,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 243, 243, 243, 180, 180, 180, 167, 167, 167, 180, 180, 180,
+225, 225, 225, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236,
+236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 224, 224, 224,
+180, 180, 180, 167, 167, 167, 180, 180, 180, 243, 243, 243,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0, 249, 249, 249, 180, 180, 180, 167, 167, 167, 189, 189, 189, 232, 232, 232,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+232, 232, 232, 189, 189, 189, 167, 167, 167, 180, 180, 180, 249, 249, 249,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 254, 254, 254, 192, 192, 192, 167, 167, 167, 189, 189, 189, 233, 233, 233, 234, 234, 234,
+234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+234, 234, 234, 233, 233, 233, 189, 189, 189, 167, 167, 167, 192, 192, 192, 254, 254, 254,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 215, 215, 215, 167, 167, 167, 179, 179, 179, 230, 230, 230, 233, 233, 233, 233, 233, 233,
+233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+233, 233, 233, 233, 233, 233, 230, 230, 230, 179, 179, 179, 167, 167, 167, 216, 216, 216,   0,   0,   0,   0,   0,   0,
+  0,   0,   0, 249, 249, 249, 173, 173, 173, 168, 168, 168, 223, 223, 223, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+233, 233, 233, 233, 233, 233, 233, 233, 233, 222, 222, 222, 168, 168, 168, 173, 173, 173, 249, 249, 249,   0,   0,   0,
+  0,   0,   0, 207, 207, 207, 167, 167, 167, 192, 192, 192, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232,
+232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 232, 191, 191, 191, 167, 167, 167, 207, 207, 207,   0,   0,   0,
+254, 254, 254, 174, 174, 174, 167, 167, 167, 224, 224, 224, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231,
+231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 231, 224, 224, 224, 167, 167, 167, 174, 174, 174, 254, 254, 254,
+233, 233, 233, 167, 167, 167, 181, 181, 181, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 181, 181, 181, 167, 167, 167, 233, 233, 233,
+205, 205, 205, 167, 167, 167, 199, 199, 199, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 199, 199, 199, 167, 167, 167, 205, 205, 205,
+189, 189, 189, 167, 167, 167, 214, 214, 214, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229,
+229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 229, 214, 214, 214, 167, 167, 167, 189, 189, 189,
+180, 180, 180, 167, 167, 167, 219, 219, 219, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228,
+228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 228, 219, 219, 219, 167, 167, 167, 180, 180, 180,
+171, 171, 171, 167, 167, 167, 224, 224, 224, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227,
+227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 227, 224, 224, 224, 167, 167, 167, 171, 171, 171,
+171, 171, 171, 167, 167, 167, 223, 223, 223, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 223, 223, 223, 167, 167, 167, 171, 171, 171,
+180, 180, 180, 167, 167, 167, 217, 217, 217, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 217, 217, 217, 167, 167, 167, 180, 180, 180,
+189, 189, 189, 167, 167, 167, 211, 211, 211, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225,
+225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 225, 211, 211, 211, 167, 167, 167, 189, 189, 189,
+205, 205, 205, 167, 167, 167, 197, 197, 197, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224,
+224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 224, 197, 197, 197, 167, 167, 167, 205, 205, 205,
+233, 233, 233, 167, 167, 167, 179, 179, 179, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223,
+223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223,
+223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223,
+223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 223, 179, 179, 179, 167, 167, 167, 233, 233, 233,
+254, 254, 254, 174, 174, 174, 167, 167, 167, 216, 216, 216, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 216, 216, 216, 167, 167, 167, 174, 174, 174, 254, 254, 254,
+  0,   0,   0, 207, 207, 207, 167, 167, 167, 188, 188, 188, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222,
+222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 222, 187, 187, 187, 167, 167, 167, 207, 207, 207,   0,   0,   0,
+  0,   0,   0, 249, 249, 249, 173, 173, 173, 168, 168, 168, 213, 213, 213, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221, 221,
+221, 221, 221, 221, 221, 221, 221, 221, 221, 212, 212, 212, 168, 168, 168, 173, 173, 173, 249, 249, 249,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 215, 215, 215, 167, 167, 167, 177, 177, 177, 218, 218, 218, 220, 220, 220, 220, 220, 220,
+220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220, 220,
+220, 220, 220, 220, 220, 220, 218, 218, 218, 177, 177, 177, 167, 167, 167, 216, 216, 216,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 254, 254, 254, 192, 192, 192, 167, 167, 167, 184, 184, 184, 218, 218, 218, 219, 219, 219,
+219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219, 219,
+219, 219, 219, 218, 218, 218, 183, 183, 183, 167, 167, 167, 192, 192, 192, 254, 254, 254,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0, 249, 249, 249, 180, 180, 180, 167, 167, 167, 184, 184, 184, 216, 216, 216,
+218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+216, 216, 216, 183, 183, 183, 167, 167, 167, 181, 181, 181, 250, 250, 250,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 243, 243, 243, 180, 180, 180, 167, 167, 167, 176, 176, 176,
+209, 209, 209, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218,
+218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 218, 209, 209, 209,
+176, 176, 176, 167, 167, 167, 180, 180, 180, 244, 244, 244,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 249, 249, 249, 192, 192, 192, 167, 167, 167,
+168, 168, 168, 186, 186, 186, 211, 211, 211, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217,
+217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 217, 211, 211, 211, 186, 186, 186, 168, 168, 168,
+167, 167, 167, 192, 192, 192, 249, 249, 249,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 254, 254, 254, 216, 216, 216,
+173, 173, 173, 167, 167, 167, 167, 167, 167, 178, 178, 178, 193, 193, 193, 204, 204, 204, 209, 209, 209, 214, 214, 214,
+214, 214, 214, 209, 209, 209, 204, 204, 204, 193, 193, 193, 178, 178, 178, 167, 167, 167, 167, 167, 167, 173, 173, 173,
+216, 216, 216, 254, 254, 254,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+249, 249, 249, 207, 207, 207, 174, 174, 174, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167,
+167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 167, 174, 174, 174, 207, 207, 207, 249, 249, 249,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 254, 254, 254, 233, 233, 233, 205, 205, 205, 189, 189, 189, 180, 180, 180, 171, 171, 171,
+171, 171, 171, 180, 180, 180, 189, 189, 189, 205, 205, 205, 233, 233, 233, 254, 254, 254,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255
+};
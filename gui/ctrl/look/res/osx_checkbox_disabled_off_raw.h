@@ -0,0 +1,147 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info osx_checkbox_disabled_off_1x_info(14, 14, 42, gui::pixel_format_t::RGB);
+static const unsigned char osx_checkbox_disabled_off_1x_pixels[] = {
+  0,   0,   0, 207, 207, 207, 193, 193, 193, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+187, 187, 187, 187, 187, 187, 187, 187, 187, 193, 193, 193, 207, 207, 207,   0,   0,   0,
+207, 207, 207, 208, 208, 208, 225, 225, 225, 234, 234, 234, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 234, 234, 234, 225, 225, 225, 208, 208, 208, 207, 207, 207,
+197, 197, 197, 230, 230, 230, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 230, 230, 230, 197, 197, 197,
+194, 194, 194, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 194, 194, 194,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+200, 200, 200, 231, 231, 231, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 231, 231, 231, 200, 200, 200,
+211, 211, 211, 215, 215, 215, 231, 231, 231, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+240, 240, 240, 240, 240, 240, 240, 240, 240, 231, 231, 231, 215, 215, 215, 211, 211, 211,
+  0,   0,   0, 211, 211, 211, 200, 200, 200, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 195, 195, 195, 200, 200, 200, 211, 211, 211,   0,   0,   0
+};
+static const gui::draw::bitmap_info osx_checkbox_disabled_off_2x_info(28, 28, 84, gui::pixel_format_t::RGB);
+static const unsigned char osx_checkbox_disabled_off_2x_pixels[] = {
+  0,   0,   0,   0,   0,   0, 207, 207, 207, 207, 207, 207, 193, 193, 193, 193, 193, 193, 187, 187, 187, 187, 187, 187,
+187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 193, 193, 193, 193, 193, 193,
+207, 207, 207, 207, 207, 207,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 207, 207, 207, 207, 207, 207, 193, 193, 193, 193, 193, 193, 187, 187, 187, 187, 187, 187,
+187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 193, 193, 193, 193, 193, 193,
+207, 207, 207, 207, 207, 207,   0,   0,   0,   0,   0,   0,
+207, 207, 207, 207, 207, 207, 208, 208, 208, 208, 208, 208, 225, 225, 225, 225, 225, 225, 234, 234, 234, 234, 234, 234,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 234, 234, 234, 234, 234, 234, 225, 225, 225, 225, 225, 225,
+208, 208, 208, 208, 208, 208, 207, 207, 207, 207, 207, 207,
+207, 207, 207, 207, 207, 207, 208, 208, 208, 208, 208, 208, 225, 225, 225, 225, 225, 225, 234, 234, 234, 234, 234, 234,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 234, 234, 234, 234, 234, 234, 225, 225, 225, 225, 225, 225,
+208, 208, 208, 208, 208, 208, 207, 207, 207, 207, 207, 207,
+197, 197, 197, 197, 197, 197, 230, 230, 230, 230, 230, 230, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 240, 240, 240,
+230, 230, 230, 230, 230, 230, 197, 197, 197, 197, 197, 197,
+197, 197, 197, 197, 197, 197, 230, 230, 230, 230, 230, 230, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 240, 240, 240,
+230, 230, 230, 230, 230, 230, 197, 197, 197, 197, 197, 197,
+194, 194, 194, 194, 194, 194, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 194, 194, 194, 194, 194, 194,
+194, 194, 194, 194, 194, 194, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 194, 194, 194, 194, 194, 194,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+200, 200, 200, 200, 200, 200, 231, 231, 231, 231, 231, 231, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+231, 231, 231, 231, 231, 231, 200, 200, 200, 200, 200, 200,
+200, 200, 200, 200, 200, 200, 231, 231, 231, 231, 231, 231, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+231, 231, 231, 231, 231, 231, 200, 200, 200, 200, 200, 200,
+211, 211, 211, 211, 211, 211, 215, 215, 215, 215, 215, 215, 231, 231, 231, 231, 231, 231, 240, 240, 240, 240, 240, 240,
+240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 231, 231, 231, 231, 231, 231,
+215, 215, 215, 215, 215, 215, 211, 211, 211, 211, 211, 211,
+211, 211, 211, 211, 211, 211, 215, 215, 215, 215, 215, 215, 231, 231, 231, 231, 231, 231, 240, 240, 240, 240, 240, 240,
+240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 231, 231, 231, 231, 231, 231,
+215, 215, 215, 215, 215, 215, 211, 211, 211, 211, 211, 211,
+  0,   0,   0,   0,   0,   0, 211, 211, 211, 211, 211, 211, 200, 200, 200, 200, 200, 200, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 200, 200, 200, 200, 200, 200,
+211, 211, 211, 211, 211, 211,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 211, 211, 211, 211, 211, 211, 200, 200, 200, 200, 200, 200, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 200, 200, 200, 200, 200, 200,
+211, 211, 211, 211, 211, 211,   0,   0,   0,   0,   0,   0
+};
@@ -0,0 +1,147 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info osx_checkbox_disabled_on_1x_info(14, 14, 42, gui::pixel_format_t::RGB);
+static const unsigned char osx_checkbox_disabled_on_1x_pixels[] = {
+  0,   0,   0, 207, 207, 207, 193, 193, 193, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+187, 187, 187, 187, 187, 187, 187, 187, 187, 193, 193, 193, 207, 207, 207,   0,   0,   0,
+207, 207, 207, 208, 208, 208, 225, 225, 225, 234, 234, 234, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 234, 234, 234, 225, 225, 225, 208, 208, 208, 207, 207, 207,
+197, 197, 197, 230, 230, 230, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 230, 230, 230, 197, 197, 197,
+194, 194, 194, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 189, 189, 189, 164, 164, 164, 241, 241, 241, 240, 240, 240, 194, 194, 194,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+218, 218, 218, 145, 145, 145, 177, 177, 177, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 236, 236, 236,
+162, 162, 162, 152, 152, 152, 229, 229, 229, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 237, 237, 237, 241, 241, 241, 241, 241, 241, 241, 241, 241, 193, 193, 193,
+145, 145, 145, 206, 206, 206, 241, 241, 241, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 160, 160, 160, 180, 180, 180, 241, 241, 241, 223, 223, 223, 146, 146, 146,
+175, 175, 175, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 185, 185, 185, 145, 145, 145, 193, 193, 193, 171, 171, 171, 152, 152, 152,
+226, 226, 226, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 238, 238, 238, 176, 176, 176, 145, 145, 145, 145, 145, 145, 201, 201, 201,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+195, 195, 195, 240, 240, 240, 241, 241, 241, 241, 241, 241, 233, 233, 233, 165, 165, 165, 174, 174, 174, 240, 240, 240,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 195, 195, 195,
+200, 200, 200, 231, 231, 231, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 231, 231, 231, 200, 200, 200,
+211, 211, 211, 215, 215, 215, 231, 231, 231, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+240, 240, 240, 240, 240, 240, 240, 240, 240, 231, 231, 231, 215, 215, 215, 211, 211, 211,
+  0,   0,   0, 211, 211, 211, 200, 200, 200, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 195, 195, 195, 200, 200, 200, 211, 211, 211,   0,   0,   0
+};
+static const gui::draw::bitmap_info osx_checkbox_disabled_on_2x_info(28, 28, 84, gui::pixel_format_t::RGB);
+static const unsigned char osx_checkbox_disabled_on_2x_pixels[] = {
+  0,   0,   0,   0,   0,   0, 207, 207, 207, 207, 207, 207, 193, 193, 193, 193, 193, 193, 187, 187, 187, 187, 187, 187,
+187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 193, 193, 193, 193, 193, 193,
+207, 207, 207, 207, 207, 207,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 207, 207, 207, 207, 207, 207, 193, 193, 193, 193, 193, 193, 187, 187, 187, 187, 187, 187,
+187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187,
+187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 187, 193, 193, 193, 193, 193, 193,
+207, 207, 207, 207, 207, 207,   0,   0,   0,   0,   0,   0,
+207, 207, 207, 207, 207, 207, 208, 208, 208, 208, 208, 208, 225, 225, 225, 225, 225, 225, 234, 234, 234, 234, 234, 234,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 234, 234, 234, 234, 234, 234, 225, 225, 225, 225, 225, 225,
+208, 208, 208, 208, 208, 208, 207, 207, 207, 207, 207, 207,
+207, 207, 207, 207, 207, 207, 208, 208, 208, 208, 208, 208, 225, 225, 225, 225, 225, 225, 234, 234, 234, 234, 234, 234,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235,
+235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 234, 234, 234, 234, 234, 234, 225, 225, 225, 225, 225, 225,
+208, 208, 208, 208, 208, 208, 207, 207, 207, 207, 207, 207,
+197, 197, 197, 197, 197, 197, 230, 230, 230, 230, 230, 230, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 240, 240, 240,
+230, 230, 230, 230, 230, 230, 197, 197, 197, 197, 197, 197,
+197, 197, 197, 197, 197, 197, 230, 230, 230, 230, 230, 230, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 240, 240, 240, 240, 240, 240,
+230, 230, 230, 230, 230, 230, 197, 197, 197, 197, 197, 197,
+194, 194, 194, 194, 194, 194, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 189, 189, 189, 189, 189, 189, 164, 164, 164, 164, 164, 164, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 194, 194, 194, 194, 194, 194,
+194, 194, 194, 194, 194, 194, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 189, 189, 189, 189, 189, 189, 164, 164, 164, 164, 164, 164, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 194, 194, 194, 194, 194, 194,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+218, 218, 218, 218, 218, 218, 145, 145, 145, 145, 145, 145, 177, 177, 177, 177, 177, 177, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+218, 218, 218, 218, 218, 218, 145, 145, 145, 145, 145, 145, 177, 177, 177, 177, 177, 177, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 236, 236, 236, 236, 236, 236,
+162, 162, 162, 162, 162, 162, 152, 152, 152, 152, 152, 152, 229, 229, 229, 229, 229, 229, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 236, 236, 236, 236, 236, 236,
+162, 162, 162, 162, 162, 162, 152, 152, 152, 152, 152, 152, 229, 229, 229, 229, 229, 229, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 237, 237, 237, 237, 237, 237,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 193, 193, 193, 193, 193, 193,
+145, 145, 145, 145, 145, 145, 206, 206, 206, 206, 206, 206, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 237, 237, 237, 237, 237, 237,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 193, 193, 193, 193, 193, 193,
+145, 145, 145, 145, 145, 145, 206, 206, 206, 206, 206, 206, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 160, 160, 160, 160, 160, 160,
+180, 180, 180, 180, 180, 180, 241, 241, 241, 241, 241, 241, 223, 223, 223, 223, 223, 223, 146, 146, 146, 146, 146, 146,
+175, 175, 175, 175, 175, 175, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 160, 160, 160, 160, 160, 160,
+180, 180, 180, 180, 180, 180, 241, 241, 241, 241, 241, 241, 223, 223, 223, 223, 223, 223, 146, 146, 146, 146, 146, 146,
+175, 175, 175, 175, 175, 175, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 185, 185, 185, 185, 185, 185,
+145, 145, 145, 145, 145, 145, 193, 193, 193, 193, 193, 193, 171, 171, 171, 171, 171, 171, 152, 152, 152, 152, 152, 152,
+226, 226, 226, 226, 226, 226, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 185, 185, 185, 185, 185, 185,
+145, 145, 145, 145, 145, 145, 193, 193, 193, 193, 193, 193, 171, 171, 171, 171, 171, 171, 152, 152, 152, 152, 152, 152,
+226, 226, 226, 226, 226, 226, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 238, 238, 238, 238, 238, 238,
+176, 176, 176, 176, 176, 176, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 201, 201, 201, 201, 201, 201,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 238, 238, 238, 238, 238, 238,
+176, 176, 176, 176, 176, 176, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 201, 201, 201, 201, 201, 201,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+233, 233, 233, 233, 233, 233, 165, 165, 165, 165, 165, 165, 174, 174, 174, 174, 174, 174, 240, 240, 240, 240, 240, 240,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+233, 233, 233, 233, 233, 233, 165, 165, 165, 165, 165, 165, 174, 174, 174, 174, 174, 174, 240, 240, 240, 240, 240, 240,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+240, 240, 240, 240, 240, 240, 195, 195, 195, 195, 195, 195,
+200, 200, 200, 200, 200, 200, 231, 231, 231, 231, 231, 231, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+231, 231, 231, 231, 231, 231, 200, 200, 200, 200, 200, 200,
+200, 200, 200, 200, 200, 200, 231, 231, 231, 231, 231, 231, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+231, 231, 231, 231, 231, 231, 200, 200, 200, 200, 200, 200,
+211, 211, 211, 211, 211, 211, 215, 215, 215, 215, 215, 215, 231, 231, 231, 231, 231, 231, 240, 240, 240, 240, 240, 240,
+240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 231, 231, 231, 231, 231, 231,
+215, 215, 215, 215, 215, 215, 211, 211, 211, 211, 211, 211,
+211, 211, 211, 211, 211, 211, 215, 215, 215, 215, 215, 215, 231, 231, 231, 231, 231, 231, 240, 240, 240, 240, 240, 240,
+240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 231, 231, 231, 231, 231, 231,
+215, 215, 215, 215, 215, 215, 211, 211, 211, 211, 211, 211,
+  0,   0,   0,   0,   0,   0, 211, 211, 211, 211, 211, 211, 200, 200, 200, 200, 200, 200, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 200, 200, 200, 200, 200, 200,
+211, 211, 211, 211, 211, 211,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 211, 211, 211, 211, 211, 211, 200, 200, 200, 200, 200, 200, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 200, 200, 200, 200, 200, 200,
+211, 211, 211, 211, 211, 211,   0,   0,   0,   0,   0,   0
+};
@@ -0,0 +1,147 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info osx_checkbox_off_1x_info(14, 14, 42, gui::pixel_format_t::RGB);
+static const unsigned char osx_checkbox_off_1x_pixels[] = {
+  0,   0,   0, 196, 196, 196, 175, 175, 175, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+165, 165, 165, 165, 165, 165, 165, 165, 165, 175, 175, 175, 196, 196, 196,   0,   0,   0,
+197, 197, 197, 204, 204, 204, 229, 229, 229, 242, 242, 242, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 242, 242, 242, 229, 229, 229, 204, 204, 204, 197, 197, 197,
+182, 182, 182, 238, 238, 238, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 238, 238, 238, 182, 182, 182,
+181, 181, 181, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 181, 181, 181,
+183, 183, 183, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 183, 183, 183,
+184, 184, 184, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 184, 184, 184,
+184, 184, 184, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 184, 184, 184,
+184, 184, 184, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 184, 184, 184,
+184, 184, 184, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 184, 184, 184,
+184, 184, 184, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 184, 184, 184,
+184, 184, 184, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 184, 184, 184,
+191, 191, 191, 242, 242, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 242, 242, 242, 191, 191, 191,
+205, 205, 205, 219, 219, 219, 242, 242, 242, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+254, 254, 254, 254, 254, 254, 254, 254, 254, 242, 242, 242, 219, 219, 219, 205, 205, 205,
+  0,   0,   0, 205, 205, 205, 191, 191, 191, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 184, 184, 184, 191, 191, 191, 205, 205, 205,   0,   0,   0
+};
+static const gui::draw::bitmap_info osx_checkbox_off_2x_info(28, 28, 84, gui::pixel_format_t::RGB);
+static const unsigned char osx_checkbox_off_2x_pixels[] = {
+  0,   0,   0,   0,   0,   0, 196, 196, 196, 196, 196, 196, 175, 175, 175, 175, 175, 175, 165, 165, 165, 165, 165, 165,
+165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 175, 175, 175, 175, 175, 175,
+196, 196, 196, 196, 196, 196,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 196, 196, 196, 196, 196, 196, 175, 175, 175, 175, 175, 175, 165, 165, 165, 165, 165, 165,
+165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165,
+165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 165, 175, 175, 175, 175, 175, 175,
+196, 196, 196, 196, 196, 196,   0,   0,   0,   0,   0,   0,
+197, 197, 197, 197, 197, 197, 204, 204, 204, 204, 204, 204, 229, 229, 229, 229, 229, 229, 242, 242, 242, 242, 242, 242,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 242, 242, 242, 242, 242, 242, 229, 229, 229, 229, 229, 229,
+204, 204, 204, 204, 204, 204, 197, 197, 197, 197, 197, 197,
+197, 197, 197, 197, 197, 197, 204, 204, 204, 204, 204, 204, 229, 229, 229, 229, 229, 229, 242, 242, 242, 242, 242, 242,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243,
+243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 243, 242, 242, 242, 242, 242, 242, 229, 229, 229, 229, 229, 229,
+204, 204, 204, 204, 204, 204, 197, 197, 197, 197, 197, 197,
+182, 182, 182, 182, 182, 182, 238, 238, 238, 238, 238, 238, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 254, 254, 254,
+238, 238, 238, 238, 238, 238, 182, 182, 182, 182, 182, 182,
+182, 182, 182, 182, 182, 182, 238, 238, 238, 238, 238, 238, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 254, 254, 254,
+238, 238, 238, 238, 238, 238, 182, 182, 182, 182, 182, 182,
+181, 181, 181, 181, 181, 181, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 181, 181, 181, 181, 181, 181,
+181, 181, 181, 181, 181, 181, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 181, 181, 181, 181, 181, 181,
+183, 183, 183, 183, 183, 183, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 183, 183, 183, 183, 183, 183,
+183, 183, 183, 183, 183, 183, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 183, 183, 183, 183, 183, 183,
+184, 184, 184, 184, 184, 184, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+254, 254, 254, 254, 254, 254, 184, 184, 184, 184, 184, 184,
+191, 191, 191, 191, 191, 191, 242, 242, 242, 242, 242, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+242, 242, 242, 242, 242, 242, 191, 191, 191, 191, 191, 191,
+191, 191, 191, 191, 191, 191, 242, 242, 242, 242, 242, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+242, 242, 242, 242, 242, 242, 191, 191, 191, 191, 191, 191,
+205, 205, 205, 205, 205, 205, 219, 219, 219, 219, 219, 219, 242, 242, 242, 242, 242, 242, 254, 254, 254, 254, 254, 254,
+254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 242, 242, 242, 242, 242, 242,
+219, 219, 219, 219, 219, 219, 205, 205, 205, 205, 205, 205,
+205, 205, 205, 205, 205, 205, 219, 219, 219, 219, 219, 219, 242, 242, 242, 242, 242, 242, 254, 254, 254, 254, 254, 254,
+254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254,
+254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 254, 242, 242, 242, 242, 242, 242,
+219, 219, 219, 219, 219, 219, 205, 205, 205, 205, 205, 205,
+  0,   0,   0,   0,   0,   0, 205, 205, 205, 205, 205, 205, 191, 191, 191, 191, 191, 191, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 191, 191, 191, 191, 191, 191,
+205, 205, 205, 205, 205, 205,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 205, 205, 205, 205, 205, 205, 191, 191, 191, 191, 191, 191, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184,
+184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 184, 191, 191, 191, 191, 191, 191,
+205, 205, 205, 205, 205, 205,   0,   0,   0,   0,   0,   0
+};
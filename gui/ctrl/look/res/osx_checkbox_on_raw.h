@@ -0,0 +1,147 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info osx_checkbox_on_1x_info(14, 14, 42, gui::pixel_format_t::RGB);
+static const unsigned char osx_checkbox_on_1x_pixels[] = {
+  0,   0,   0, 128, 171, 239,  69, 139, 248,  43, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  43, 127, 253,  69, 139, 248, 128, 171, 239,   0,   0,   0,
+128, 171, 239,  48, 130, 253,  56, 134, 253,  58, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  58, 136, 253,  56, 134, 253,  48, 130, 253, 128, 171, 239,
+ 69, 139, 248,  56, 134, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  55, 132, 249,  55, 132, 249,  57, 134, 251,  56, 134, 253,  69, 139, 248,
+ 43, 127, 253,  58, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 55, 132, 249, 159, 194, 247, 213, 228, 251,  55, 132, 249,  58, 136, 253,  43, 127, 253,
+ 44, 127, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,
+ 98, 156, 245, 255, 255, 255, 173, 199, 238,  55, 132, 249,  59, 136, 253,  44, 127, 253,
+ 44, 127, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,  63, 136, 247,
+215, 229, 249, 236, 242, 250,  53, 121, 223,  57, 134, 251,  59, 136, 253,  44, 127, 253,
+ 44, 127, 253,  59, 136, 253,  57, 134, 251,  62, 137, 249,  55, 132, 249,  57, 134, 251,  55, 132, 249, 148, 187, 245,
+255, 255, 255, 100, 149, 222,  49, 127, 244,  59, 136, 253,  59, 136, 253,  44, 127, 253,
+ 44, 127, 253,  59, 136, 253,  55, 132, 249, 221, 233, 252, 179, 207, 248,  52, 128, 245,  86, 149, 244, 252, 253, 254,
+176, 200, 236,  39, 116, 233,  59, 136, 253,  59, 136, 253,  59, 136, 253,  44, 127, 253,
+ 44, 127, 253,  59, 136, 253,  55, 132, 249, 155, 187, 234, 255, 255, 255, 148, 186, 244, 195, 216, 247, 237, 243, 251,
+ 59, 125, 224,  57, 134, 251,  59, 136, 253,  59, 136, 253,  59, 136, 253,  44, 127, 253,
+ 44, 127, 253,  59, 136, 253,  57, 134, 251,  36, 112, 226, 175, 199, 236, 255, 255, 255, 255, 255, 255, 110, 156, 224,
+ 48, 126, 243,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  44, 127, 253,
+ 43, 127, 253,  58, 136, 253,  59, 136, 253,  56, 133, 250,  44, 115, 223, 202, 218, 243, 178, 202, 237,  40, 116, 231,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  58, 136, 253,  43, 127, 253,
+ 69, 139, 248,  56, 134, 253,  59, 136, 253,  59, 136, 253,  54, 131, 248,  25, 102, 219,  29, 106, 223,  57, 134, 251,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  56, 134, 253,  69, 139, 248,
+128, 171, 239,  48, 130, 253,  56, 134, 253,  58, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  58, 136, 253,  56, 134, 253,  48, 130, 253, 128, 171, 239,
+  0,   0,   0, 128, 171, 239,  69, 139, 248,  43, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  43, 127, 253,  69, 139, 248, 128, 171, 239,   0,   0,   0
+};
+static const gui::draw::bitmap_info osx_checkbox_on_2x_info(28, 28, 84, gui::pixel_format_t::RGB);
+static const unsigned char osx_checkbox_on_2x_pixels[] = {
+  0,   0,   0,   0,   0,   0, 128, 171, 239, 128, 171, 239,  69, 139, 248,  69, 139, 248,  43, 127, 253,  43, 127, 253,
+ 44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  43, 127, 253,  43, 127, 253,  69, 139, 248,  69, 139, 248,
+128, 171, 239, 128, 171, 239,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 128, 171, 239, 128, 171, 239,  69, 139, 248,  69, 139, 248,  43, 127, 253,  43, 127, 253,
+ 44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  43, 127, 253,  43, 127, 253,  69, 139, 248,  69, 139, 248,
+128, 171, 239, 128, 171, 239,   0,   0,   0,   0,   0,   0,
+128, 171, 239, 128, 171, 239,  48, 130, 253,  48, 130, 253,  56, 134, 253,  56, 134, 253,  58, 136, 253,  58, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  58, 136, 253,  58, 136, 253,  56, 134, 253,  56, 134, 253,
+ 48, 130, 253,  48, 130, 253, 128, 171, 239, 128, 171, 239,
+128, 171, 239, 128, 171, 239,  48, 130, 253,  48, 130, 253,  56, 134, 253,  56, 134, 253,  58, 136, 253,  58, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  58, 136, 253,  58, 136, 253,  56, 134, 253,  56, 134, 253,
+ 48, 130, 253,  48, 130, 253, 128, 171, 239, 128, 171, 239,
+ 69, 139, 248,  69, 139, 248,  56, 134, 253,  56, 134, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  55, 132, 249,  55, 132, 249,  55, 132, 249,  55, 132, 249,  57, 134, 251,  57, 134, 251,
+ 56, 134, 253,  56, 134, 253,  69, 139, 248,  69, 139, 248,
+ 69, 139, 248,  69, 139, 248,  56, 134, 253,  56, 134, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  55, 132, 249,  55, 132, 249,  55, 132, 249,  55, 132, 249,  57, 134, 251,  57, 134, 251,
+ 56, 134, 253,  56, 134, 253,  69, 139, 248,  69, 139, 248,
+ 43, 127, 253,  43, 127, 253,  58, 136, 253,  58, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 55, 132, 249,  55, 132, 249, 159, 194, 247, 159, 194, 247, 213, 228, 251, 213, 228, 251,  55, 132, 249,  55, 132, 249,
+ 58, 136, 253,  58, 136, 253,  43, 127, 253,  43, 127, 253,
+ 43, 127, 253,  43, 127, 253,  58, 136, 253,  58, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 55, 132, 249,  55, 132, 249, 159, 194, 247, 159, 194, 247, 213, 228, 251, 213, 228, 251,  55, 132, 249,  55, 132, 249,
+ 58, 136, 253,  58, 136, 253,  43, 127, 253,  43, 127, 253,
+ 44, 127, 253,  44, 127, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,  57, 134, 251,
+ 98, 156, 245,  98, 156, 245, 255, 255, 255, 255, 255, 255, 173, 199, 238, 173, 199, 238,  55, 132, 249,  55, 132, 249,
+ 59, 136, 253,  59, 136, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,  57, 134, 251,
+ 98, 156, 245,  98, 156, 245, 255, 255, 255, 255, 255, 255, 173, 199, 238, 173, 199, 238,  55, 132, 249,  55, 132, 249,
+ 59, 136, 253,  59, 136, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,  57, 134, 251,  63, 136, 247,  63, 136, 247,
+215, 229, 249, 215, 229, 249, 236, 242, 250, 236, 242, 250,  53, 121, 223,  53, 121, 223,  57, 134, 251,  57, 134, 251,
+ 59, 136, 253,  59, 136, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,  57, 134, 251,  63, 136, 247,  63, 136, 247,
+215, 229, 249, 215, 229, 249, 236, 242, 250, 236, 242, 250,  53, 121, 223,  53, 121, 223,  57, 134, 251,  57, 134, 251,
+ 59, 136, 253,  59, 136, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,  57, 134, 251,  62, 137, 249,  62, 137, 249,
+ 55, 132, 249,  55, 132, 249,  57, 134, 251,  57, 134, 251,  55, 132, 249,  55, 132, 249, 148, 187, 245, 148, 187, 245,
+255, 255, 255, 255, 255, 255, 100, 149, 222, 100, 149, 222,  49, 127, 244,  49, 127, 244,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,  57, 134, 251,  62, 137, 249,  62, 137, 249,
+ 55, 132, 249,  55, 132, 249,  57, 134, 251,  57, 134, 251,  55, 132, 249,  55, 132, 249, 148, 187, 245, 148, 187, 245,
+255, 255, 255, 255, 255, 255, 100, 149, 222, 100, 149, 222,  49, 127, 244,  49, 127, 244,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  59, 136, 253,  59, 136, 253,  55, 132, 249,  55, 132, 249, 221, 233, 252, 221, 233, 252,
+179, 207, 248, 179, 207, 248,  52, 128, 245,  52, 128, 245,  86, 149, 244,  86, 149, 244, 252, 253, 254, 252, 253, 254,
+176, 200, 236, 176, 200, 236,  39, 116, 233,  39, 116, 233,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  59, 136, 253,  59, 136, 253,  55, 132, 249,  55, 132, 249, 221, 233, 252, 221, 233, 252,
+179, 207, 248, 179, 207, 248,  52, 128, 245,  52, 128, 245,  86, 149, 244,  86, 149, 244, 252, 253, 254, 252, 253, 254,
+176, 200, 236, 176, 200, 236,  39, 116, 233,  39, 116, 233,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  59, 136, 253,  59, 136, 253,  55, 132, 249,  55, 132, 249, 155, 187, 234, 155, 187, 234,
+255, 255, 255, 255, 255, 255, 148, 186, 244, 148, 186, 244, 195, 216, 247, 195, 216, 247, 237, 243, 251, 237, 243, 251,
+ 59, 125, 224,  59, 125, 224,  57, 134, 251,  57, 134, 251,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  59, 136, 253,  59, 136, 253,  55, 132, 249,  55, 132, 249, 155, 187, 234, 155, 187, 234,
+255, 255, 255, 255, 255, 255, 148, 186, 244, 148, 186, 244, 195, 216, 247, 195, 216, 247, 237, 243, 251, 237, 243, 251,
+ 59, 125, 224,  59, 125, 224,  57, 134, 251,  57, 134, 251,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,  57, 134, 251,  36, 112, 226,  36, 112, 226,
+175, 199, 236, 175, 199, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 110, 156, 224, 110, 156, 224,
+ 48, 126, 243,  48, 126, 243,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,  57, 134, 251,  36, 112, 226,  36, 112, 226,
+175, 199, 236, 175, 199, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 110, 156, 224, 110, 156, 224,
+ 48, 126, 243,  48, 126, 243,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  44, 127, 253,  44, 127, 253,
+ 43, 127, 253,  43, 127, 253,  58, 136, 253,  58, 136, 253,  59, 136, 253,  59, 136, 253,  56, 133, 250,  56, 133, 250,
+ 44, 115, 223,  44, 115, 223, 202, 218, 243, 202, 218, 243, 178, 202, 237, 178, 202, 237,  40, 116, 231,  40, 116, 231,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 58, 136, 253,  58, 136, 253,  43, 127, 253,  43, 127, 253,
+ 43, 127, 253,  43, 127, 253,  58, 136, 253,  58, 136, 253,  59, 136, 253,  59, 136, 253,  56, 133, 250,  56, 133, 250,
+ 44, 115, 223,  44, 115, 223, 202, 218, 243, 202, 218, 243, 178, 202, 237, 178, 202, 237,  40, 116, 231,  40, 116, 231,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 58, 136, 253,  58, 136, 253,  43, 127, 253,  43, 127, 253,
+ 69, 139, 248,  69, 139, 248,  56, 134, 253,  56, 134, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 54, 131, 248,  54, 131, 248,  25, 102, 219,  25, 102, 219,  29, 106, 223,  29, 106, 223,  57, 134, 251,  57, 134, 251,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 56, 134, 253,  56, 134, 253,  69, 139, 248,  69, 139, 248,
+ 69, 139, 248,  69, 139, 248,  56, 134, 253,  56, 134, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 54, 131, 248,  54, 131, 248,  25, 102, 219,  25, 102, 219,  29, 106, 223,  29, 106, 223,  57, 134, 251,  57, 134, 251,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 56, 134, 253,  56, 134, 253,  69, 139, 248,  69, 139, 248,
+128, 171, 239, 128, 171, 239,  48, 130, 253,  48, 130, 253,  56, 134, 253,  56, 134, 253,  58, 136, 253,  58, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  58, 136, 253,  58, 136, 253,  56, 134, 253,  56, 134, 253,
+ 48, 130, 253,  48, 130, 253, 128, 171, 239, 128, 171, 239,
+128, 171, 239, 128, 171, 239,  48, 130, 253,  48, 130, 253,  56, 134, 253,  56, 134, 253,  58, 136, 253,  58, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  58, 136, 253,  58, 136, 253,  56, 134, 253,  56, 134, 253,
+ 48, 130, 253,  48, 130, 253, 128, 171, 239, 128, 171, 239,
+  0,   0,   0,   0,   0,   0, 128, 171, 239, 128, 171, 239,  69, 139, 248,  69, 139, 248,  43, 127, 253,  43, 127, 253,
+ 44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  43, 127, 253,  43, 127, 253,  69, 139, 248,  69, 139, 248,
+128, 171, 239, 128, 171, 239,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 128, 171, 239, 128, 171, 239,  69, 139, 248,  69, 139, 248,  43, 127, 253,  43, 127, 253,
+ 44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,
+ 44, 127, 253,  44, 127, 253,  44, 127, 253,  44, 127, 253,  43, 127, 253,  43, 127, 253,  69, 139, 248,  69, 139, 248,
+128, 171, 239, 128, 171, 239,   0,   0,   0,   0,   0,   0
+};
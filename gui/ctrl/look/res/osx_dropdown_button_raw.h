@@ -0,0 +1,280 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info osx_dropdown_button_1x_info(17, 21, 51, gui::pixel_format_t::RGB);
+static const unsigned char osx_dropdown_button_1x_pixels[] = {
+ 75, 144, 250,  75, 145, 251,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,
+ 74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  94, 157, 249, 138, 179, 243, 197, 213, 239,
+236, 236, 236,
+107, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 164, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251,
+105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 101, 161, 251,  92, 155, 251, 106, 160, 247,
+195, 212, 239,
+103, 162, 252, 102, 161, 251, 102, 162, 251, 102, 162, 251, 101, 161, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251,
+102, 161, 251, 102, 162, 251, 101, 161, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251,  89, 154, 251,
+135, 178, 244,
+ 99, 160, 252,  98, 160, 252,  98, 159, 251,  97, 159, 251,  98, 159, 251,  98, 159, 251,  98, 160, 252,  98, 160, 252,
+ 97, 159, 251,  98, 160, 252,  98, 159, 251,  98, 159, 251,  97, 159, 251,  97, 159, 251,  97, 159, 251,  94, 157, 251,
+ 87, 151, 250,
+ 94, 156, 252,  94, 157, 252,  94, 157, 252,  94, 157, 252,  93, 156, 251,  93, 156, 252,  93, 156, 252,  93, 156, 251,
+ 93, 156, 251,  93, 156, 251,  94, 157, 252,  93, 156, 252,  93, 156, 251,  93, 156, 251,  94, 157, 252,  94, 157, 252,
+ 63, 137, 251,
+ 90, 154, 252,  88, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  88, 153, 252,  89, 154, 252, 148, 190, 252,
+252, 253, 255, 148, 190, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,
+ 60, 135, 251,
+ 85, 151, 253,  83, 150, 252,  84, 151, 252,  83, 150, 252,  83, 150, 252,  84, 151, 252, 141, 186, 252, 254, 254, 255,
+227, 238, 254, 254, 254, 255, 141, 186, 252,  83, 150, 252,  84, 151, 253,  84, 151, 253,  84, 151, 253,  83, 150, 252,
+ 56, 132, 251,
+ 79, 148, 253,  78, 148, 253,  78, 147, 252,  78, 147, 252,  78, 148, 253, 131, 180, 252, 252, 253, 255, 183, 211, 254,
+ 79, 148, 252, 183, 211, 253, 252, 253, 255, 132, 180, 253,  78, 147, 252,  78, 147, 252,  77, 147, 252,  77, 147, 252,
+ 53, 131, 252,
+ 73, 144, 252,  72, 144, 253,  72, 144, 252,  72, 144, 253,  72, 144, 253, 250, 253, 255, 189, 215, 254,  73, 145, 253,
+ 72, 144, 253,  73, 144, 252, 188, 214, 254, 250, 252, 255,  73, 144, 253,  72, 144, 253,  72, 144, 252,  72, 144, 253,
+ 48, 128, 253,
+ 67, 141, 253,  66, 141, 253,  66, 141, 253,  67, 141, 254,  66, 141, 253,  68, 142, 253,  66, 141, 253,  66, 141, 253,
+ 66, 141, 253,  67, 141, 254,  66, 141, 253,  68, 142, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,  67, 141, 254,
+ 45, 126, 253,
+ 61, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 254,  61, 138, 254,  60, 137, 253,  60, 137, 253,  60, 137, 253,
+ 60, 137, 253,  60, 137, 253,  61, 138, 254,  60, 137, 254,  60, 137, 253,  60, 137, 254,  60, 137, 254,  60, 137, 254,
+ 40, 122, 253,
+ 56, 134, 254,  55, 133, 253,  55, 133, 253,  55, 133, 253,  54, 134, 254,  56, 134, 253,  54, 134, 254,  55, 133, 253,
+ 54, 134, 254,  54, 134, 254,  54, 134, 254,  55, 135, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,
+ 36, 120, 254,
+ 49, 131, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254, 248, 251, 255, 173, 205, 254,  49, 130, 254,
+ 48, 130, 254,  49, 130, 254, 172, 205, 254, 249, 251, 255,  49, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,
+ 32, 117, 254,
+ 43, 127, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 127, 255, 107, 166, 255, 250, 253, 255, 168, 202, 254,
+ 44, 128, 254, 168, 203, 255, 251, 253, 255, 108, 166, 255,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 127, 255,
+ 28, 115, 254,
+ 38, 125, 255,  36, 123, 255,  36, 123, 255,  36, 123, 255,  36, 123, 254,  36, 123, 254, 113, 169, 255, 252, 254, 255,
+220, 234, 255, 253, 254, 255, 115, 170, 255,  36, 123, 255,  36, 123, 254,  37, 124, 255,  36, 123, 255,  36, 123, 255,
+ 24, 112, 254,
+ 30, 120, 254,  31, 120, 255,  31, 120, 255,  29, 120, 254,  31, 120, 255,  29, 120, 254,  31, 120, 255, 110, 168, 255,
+250, 253, 255, 112, 168, 255,  31, 120, 255,  31, 120, 255,  29, 120, 254,  31, 120, 255,  31, 120, 255,  31, 120, 255,
+ 20, 110, 255,
+ 27, 118, 255,  25, 116, 255,  25, 116, 255,  26, 117, 255,  26, 117, 255,  25, 116, 255,  26, 117, 255,  26, 117, 255,
+ 25, 116, 255,  26, 117, 255,  25, 116, 255,  26, 117, 255,  25, 116, 255,  26, 117, 255,  26, 117, 255,  25, 116, 255,
+ 16, 107, 254,
+ 21, 115, 255,  20, 113, 255,  21, 114, 255,  20, 113, 255,  21, 114, 255,  20, 113, 255,  21, 114, 255,  21, 114, 255,
+ 21, 114, 255,  20, 113, 255,  20, 114, 255,  21, 114, 255,  20, 113, 255,  20, 113, 255,  21, 114, 255,  19, 112, 255,
+ 40, 119, 252,
+ 16, 112, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  18, 112, 255,  15, 111, 255,  15, 111, 255,  18, 112, 255,
+ 15, 111, 255,  15, 111, 255,  15, 111, 255,  18, 112, 255,  15, 111, 255,  18, 112, 255,  15, 111, 255,  13, 108, 255,
+ 99, 151, 247,
+ 14, 111, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,
+ 12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  11, 108, 255,  10, 106, 255,  50, 122, 248,
+179, 200, 240,
+  5, 100, 255,   4,  99, 255,   5, 100, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,
+  5, 100, 255,   5, 100, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,  29, 111, 250,  92, 144, 241, 175, 196, 236,
+236, 236, 236
+};
+static const gui::draw::bitmap_info osx_dropdown_button_2x_info(34, 42, 102, gui::pixel_format_t::RGB);
+static const unsigned char osx_dropdown_button_2x_pixels[] = {
+ 75, 144, 250,  75, 144, 250,  75, 145, 251,  75, 145, 251,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,
+ 74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,
+ 74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,
+ 74, 144, 250,  74, 144, 250,  94, 157, 249,  94, 157, 249, 138, 179, 243, 138, 179, 243, 197, 213, 239, 197, 213, 239,
+236, 236, 236, 236, 236, 236,
+ 75, 144, 250,  75, 144, 250,  75, 145, 251,  75, 145, 251,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,
+ 74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,
+ 74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,  74, 144, 250,
+ 74, 144, 250,  74, 144, 250,  94, 157, 249,  94, 157, 249, 138, 179, 243, 138, 179, 243, 197, 213, 239, 197, 213, 239,
+236, 236, 236, 236, 236, 236,
+107, 163, 251, 107, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251,
+105, 164, 251, 105, 164, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251,
+105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251,
+105, 163, 251, 105, 163, 251, 101, 161, 251, 101, 161, 251,  92, 155, 251,  92, 155, 251, 106, 160, 247, 106, 160, 247,
+195, 212, 239, 195, 212, 239,
+107, 163, 251, 107, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251,
+105, 164, 251, 105, 164, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251,
+105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251, 105, 163, 251,
+105, 163, 251, 105, 163, 251, 101, 161, 251, 101, 161, 251,  92, 155, 251,  92, 155, 251, 106, 160, 247, 106, 160, 247,
+195, 212, 239, 195, 212, 239,
+103, 162, 252, 103, 162, 252, 102, 161, 251, 102, 161, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251,
+101, 161, 251, 101, 161, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251,
+102, 161, 251, 102, 161, 251, 102, 162, 251, 102, 162, 251, 101, 161, 251, 101, 161, 251, 102, 162, 251, 102, 162, 251,
+102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251,  89, 154, 251,  89, 154, 251,
+135, 178, 244, 135, 178, 244,
+103, 162, 252, 103, 162, 252, 102, 161, 251, 102, 161, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251,
+101, 161, 251, 101, 161, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251,
+102, 161, 251, 102, 161, 251, 102, 162, 251, 102, 162, 251, 101, 161, 251, 101, 161, 251, 102, 162, 251, 102, 162, 251,
+102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251, 102, 162, 251,  89, 154, 251,  89, 154, 251,
+135, 178, 244, 135, 178, 244,
+ 99, 160, 252,  99, 160, 252,  98, 160, 252,  98, 160, 252,  98, 159, 251,  98, 159, 251,  97, 159, 251,  97, 159, 251,
+ 98, 159, 251,  98, 159, 251,  98, 159, 251,  98, 159, 251,  98, 160, 252,  98, 160, 252,  98, 160, 252,  98, 160, 252,
+ 97, 159, 251,  97, 159, 251,  98, 160, 252,  98, 160, 252,  98, 159, 251,  98, 159, 251,  98, 159, 251,  98, 159, 251,
+ 97, 159, 251,  97, 159, 251,  97, 159, 251,  97, 159, 251,  97, 159, 251,  97, 159, 251,  94, 157, 251,  94, 157, 251,
+ 87, 151, 250,  87, 151, 250,
+ 99, 160, 252,  99, 160, 252,  98, 160, 252,  98, 160, 252,  98, 159, 251,  98, 159, 251,  97, 159, 251,  97, 159, 251,
+ 98, 159, 251,  98, 159, 251,  98, 159, 251,  98, 159, 251,  98, 160, 252,  98, 160, 252,  98, 160, 252,  98, 160, 252,
+ 97, 159, 251,  97, 159, 251,  98, 160, 252,  98, 160, 252,  98, 159, 251,  98, 159, 251,  98, 159, 251,  98, 159, 251,
+ 97, 159, 251,  97, 159, 251,  97, 159, 251,  97, 159, 251,  97, 159, 251,  97, 159, 251,  94, 157, 251,  94, 157, 251,
+ 87, 151, 250,  87, 151, 250,
+ 94, 156, 252,  94, 156, 252,  94, 157, 252,  94, 157, 252,  94, 157, 252,  94, 157, 252,  94, 157, 252,  94, 157, 252,
+ 93, 156, 251,  93, 156, 251,  93, 156, 252,  93, 156, 252,  93, 156, 252,  93, 156, 252,  93, 156, 251,  93, 156, 251,
+ 93, 156, 251,  93, 156, 251,  93, 156, 251,  93, 156, 251,  94, 157, 252,  94, 157, 252,  93, 156, 252,  93, 156, 252,
+ 93, 156, 251,  93, 156, 251,  93, 156, 251,  93, 156, 251,  94, 157, 252,  94, 157, 252,  94, 157, 252,  94, 157, 252,
+ 63, 137, 251,  63, 137, 251,
+ 94, 156, 252,  94, 156, 252,  94, 157, 252,  94, 157, 252,  94, 157, 252,  94, 157, 252,  94, 157, 252,  94, 157, 252,
+ 93, 156, 251,  93, 156, 251,  93, 156, 252,  93, 156, 252,  93, 156, 252,  93, 156, 252,  93, 156, 251,  93, 156, 251,
+ 93, 156, 251,  93, 156, 251,  93, 156, 251,  93, 156, 251,  94, 157, 252,  94, 157, 252,  93, 156, 252,  93, 156, 252,
+ 93, 156, 251,  93, 156, 251,  93, 156, 251,  93, 156, 251,  94, 157, 252,  94, 157, 252,  94, 157, 252,  94, 157, 252,
+ 63, 137, 251,  63, 137, 251,
+ 90, 154, 252,  90, 154, 252,  88, 154, 252,  88, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,
+ 89, 154, 252,  89, 154, 252,  88, 153, 252,  88, 153, 252,  89, 154, 252,  89, 154, 252, 148, 190, 252, 148, 190, 252,
+252, 253, 255, 252, 253, 255, 148, 190, 252, 148, 190, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,
+ 89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,
+ 60, 135, 251,  60, 135, 251,
+ 90, 154, 252,  90, 154, 252,  88, 154, 252,  88, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,
+ 89, 154, 252,  89, 154, 252,  88, 153, 252,  88, 153, 252,  89, 154, 252,  89, 154, 252, 148, 190, 252, 148, 190, 252,
+252, 253, 255, 252, 253, 255, 148, 190, 252, 148, 190, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,
+ 89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,  89, 154, 252,
+ 60, 135, 251,  60, 135, 251,
+ 85, 151, 253,  85, 151, 253,  83, 150, 252,  83, 150, 252,  84, 151, 252,  84, 151, 252,  83, 150, 252,  83, 150, 252,
+ 83, 150, 252,  83, 150, 252,  84, 151, 252,  84, 151, 252, 141, 186, 252, 141, 186, 252, 254, 254, 255, 254, 254, 255,
+227, 238, 254, 227, 238, 254, 254, 254, 255, 254, 254, 255, 141, 186, 252, 141, 186, 252,  83, 150, 252,  83, 150, 252,
+ 84, 151, 253,  84, 151, 253,  84, 151, 253,  84, 151, 253,  84, 151, 253,  84, 151, 253,  83, 150, 252,  83, 150, 252,
+ 56, 132, 251,  56, 132, 251,
+ 85, 151, 253,  85, 151, 253,  83, 150, 252,  83, 150, 252,  84, 151, 252,  84, 151, 252,  83, 150, 252,  83, 150, 252,
+ 83, 150, 252,  83, 150, 252,  84, 151, 252,  84, 151, 252, 141, 186, 252, 141, 186, 252, 254, 254, 255, 254, 254, 255,
+227, 238, 254, 227, 238, 254, 254, 254, 255, 254, 254, 255, 141, 186, 252, 141, 186, 252,  83, 150, 252,  83, 150, 252,
+ 84, 151, 253,  84, 151, 253,  84, 151, 253,  84, 151, 253,  84, 151, 253,  84, 151, 253,  83, 150, 252,  83, 150, 252,
+ 56, 132, 251,  56, 132, 251,
+ 79, 148, 253,  79, 148, 253,  78, 148, 253,  78, 148, 253,  78, 147, 252,  78, 147, 252,  78, 147, 252,  78, 147, 252,
+ 78, 148, 253,  78, 148, 253, 131, 180, 252, 131, 180, 252, 252, 253, 255, 252, 253, 255, 183, 211, 254, 183, 211, 254,
+ 79, 148, 252,  79, 148, 252, 183, 211, 253, 183, 211, 253, 252, 253, 255, 252, 253, 255, 132, 180, 253, 132, 180, 253,
+ 78, 147, 252,  78, 147, 252,  78, 147, 252,  78, 147, 252,  77, 147, 252,  77, 147, 252,  77, 147, 252,  77, 147, 252,
+ 53, 131, 252,  53, 131, 252,
+ 79, 148, 253,  79, 148, 253,  78, 148, 253,  78, 148, 253,  78, 147, 252,  78, 147, 252,  78, 147, 252,  78, 147, 252,
+ 78, 148, 253,  78, 148, 253, 131, 180, 252, 131, 180, 252, 252, 253, 255, 252, 253, 255, 183, 211, 254, 183, 211, 254,
+ 79, 148, 252,  79, 148, 252, 183, 211, 253, 183, 211, 253, 252, 253, 255, 252, 253, 255, 132, 180, 253, 132, 180, 253,
+ 78, 147, 252,  78, 147, 252,  78, 147, 252,  78, 147, 252,  77, 147, 252,  77, 147, 252,  77, 147, 252,  77, 147, 252,
+ 53, 131, 252,  53, 131, 252,
+ 73, 144, 252,  73, 144, 252,  72, 144, 253,  72, 144, 253,  72, 144, 252,  72, 144, 252,  72, 144, 253,  72, 144, 253,
+ 72, 144, 253,  72, 144, 253, 250, 253, 255, 250, 253, 255, 189, 215, 254, 189, 215, 254,  73, 145, 253,  73, 145, 253,
+ 72, 144, 253,  72, 144, 253,  73, 144, 252,  73, 144, 252, 188, 214, 254, 188, 214, 254, 250, 252, 255, 250, 252, 255,
+ 73, 144, 253,  73, 144, 253,  72, 144, 253,  72, 144, 253,  72, 144, 252,  72, 144, 252,  72, 144, 253,  72, 144, 253,
+ 48, 128, 253,  48, 128, 253,
+ 73, 144, 252,  73, 144, 252,  72, 144, 253,  72, 144, 253,  72, 144, 252,  72, 144, 252,  72, 144, 253,  72, 144, 253,
+ 72, 144, 253,  72, 144, 253, 250, 253, 255, 250, 253, 255, 189, 215, 254, 189, 215, 254,  73, 145, 253,  73, 145, 253,
+ 72, 144, 253,  72, 144, 253,  73, 144, 252,  73, 144, 252, 188, 214, 254, 188, 214, 254, 250, 252, 255, 250, 252, 255,
+ 73, 144, 253,  73, 144, 253,  72, 144, 253,  72, 144, 253,  72, 144, 252,  72, 144, 252,  72, 144, 253,  72, 144, 253,
+ 48, 128, 253,  48, 128, 253,
+ 67, 141, 253,  67, 141, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,  67, 141, 254,  67, 141, 254,
+ 66, 141, 253,  66, 141, 253,  68, 142, 253,  68, 142, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,
+ 66, 141, 253,  66, 141, 253,  67, 141, 254,  67, 141, 254,  66, 141, 253,  66, 141, 253,  68, 142, 253,  68, 142, 253,
+ 66, 141, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,  67, 141, 254,  67, 141, 254,
+ 45, 126, 253,  45, 126, 253,
+ 67, 141, 253,  67, 141, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,  67, 141, 254,  67, 141, 254,
+ 66, 141, 253,  66, 141, 253,  68, 142, 253,  68, 142, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,
+ 66, 141, 253,  66, 141, 253,  67, 141, 254,  67, 141, 254,  66, 141, 253,  66, 141, 253,  68, 142, 253,  68, 142, 253,
+ 66, 141, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,  66, 141, 253,  67, 141, 254,  67, 141, 254,
+ 45, 126, 253,  45, 126, 253,
+ 61, 137, 253,  61, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 254,  60, 137, 254,
+ 61, 138, 254,  61, 138, 254,  60, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 253,
+ 60, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 253,  61, 138, 254,  61, 138, 254,  60, 137, 254,  60, 137, 254,
+ 60, 137, 253,  60, 137, 253,  60, 137, 254,  60, 137, 254,  60, 137, 254,  60, 137, 254,  60, 137, 254,  60, 137, 254,
+ 40, 122, 253,  40, 122, 253,
+ 61, 137, 253,  61, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 254,  60, 137, 254,
+ 61, 138, 254,  61, 138, 254,  60, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 253,
+ 60, 137, 253,  60, 137, 253,  60, 137, 253,  60, 137, 253,  61, 138, 254,  61, 138, 254,  60, 137, 254,  60, 137, 254,
+ 60, 137, 253,  60, 137, 253,  60, 137, 254,  60, 137, 254,  60, 137, 254,  60, 137, 254,  60, 137, 254,  60, 137, 254,
+ 40, 122, 253,  40, 122, 253,
+ 56, 134, 254,  56, 134, 254,  55, 133, 253,  55, 133, 253,  55, 133, 253,  55, 133, 253,  55, 133, 253,  55, 133, 253,
+ 54, 134, 254,  54, 134, 254,  56, 134, 253,  56, 134, 253,  54, 134, 254,  54, 134, 254,  55, 133, 253,  55, 133, 253,
+ 54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  55, 135, 254,  55, 135, 254,
+ 54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,
+ 36, 120, 254,  36, 120, 254,
+ 56, 134, 254,  56, 134, 254,  55, 133, 253,  55, 133, 253,  55, 133, 253,  55, 133, 253,  55, 133, 253,  55, 133, 253,
+ 54, 134, 254,  54, 134, 254,  56, 134, 253,  56, 134, 253,  54, 134, 254,  54, 134, 254,  55, 133, 253,  55, 133, 253,
+ 54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  55, 135, 254,  55, 135, 254,
+ 54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,  54, 134, 254,
+ 36, 120, 254,  36, 120, 254,
+ 49, 131, 254,  49, 131, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,
+ 48, 130, 254,  48, 130, 254, 248, 251, 255, 248, 251, 255, 173, 205, 254, 173, 205, 254,  49, 130, 254,  49, 130, 254,
+ 48, 130, 254,  48, 130, 254,  49, 130, 254,  49, 130, 254, 172, 205, 254, 172, 205, 254, 249, 251, 255, 249, 251, 255,
+ 49, 130, 254,  49, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,
+ 32, 117, 254,  32, 117, 254,
+ 49, 131, 254,  49, 131, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,
+ 48, 130, 254,  48, 130, 254, 248, 251, 255, 248, 251, 255, 173, 205, 254, 173, 205, 254,  49, 130, 254,  49, 130, 254,
+ 48, 130, 254,  48, 130, 254,  49, 130, 254,  49, 130, 254, 172, 205, 254, 172, 205, 254, 249, 251, 255, 249, 251, 255,
+ 49, 130, 254,  49, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,  48, 130, 254,
+ 32, 117, 254,  32, 117, 254,
+ 43, 127, 254,  43, 127, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,
+ 42, 127, 255,  42, 127, 255, 107, 166, 255, 107, 166, 255, 250, 253, 255, 250, 253, 255, 168, 202, 254, 168, 202, 254,
+ 44, 128, 254,  44, 128, 254, 168, 203, 255, 168, 203, 255, 251, 253, 255, 251, 253, 255, 108, 166, 255, 108, 166, 255,
+ 42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 127, 255,  42, 127, 255,
+ 28, 115, 254,  28, 115, 254,
+ 43, 127, 254,  43, 127, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,
+ 42, 127, 255,  42, 127, 255, 107, 166, 255, 107, 166, 255, 250, 253, 255, 250, 253, 255, 168, 202, 254, 168, 202, 254,
+ 44, 128, 254,  44, 128, 254, 168, 203, 255, 168, 203, 255, 251, 253, 255, 251, 253, 255, 108, 166, 255, 108, 166, 255,
+ 42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 126, 254,  42, 127, 255,  42, 127, 255,
+ 28, 115, 254,  28, 115, 254,
+ 38, 125, 255,  38, 125, 255,  36, 123, 255,  36, 123, 255,  36, 123, 255,  36, 123, 255,  36, 123, 255,  36, 123, 255,
+ 36, 123, 254,  36, 123, 254,  36, 123, 254,  36, 123, 254, 113, 169, 255, 113, 169, 255, 252, 254, 255, 252, 254, 255,
+220, 234, 255, 220, 234, 255, 253, 254, 255, 253, 254, 255, 115, 170, 255, 115, 170, 255,  36, 123, 255,  36, 123, 255,
+ 36, 123, 254,  36, 123, 254,  37, 124, 255,  37, 124, 255,  36, 123, 255,  36, 123, 255,  36, 123, 255,  36, 123, 255,
+ 24, 112, 254,  24, 112, 254,
+ 38, 125, 255,  38, 125, 255,  36, 123, 255,  36, 123, 255,  36, 123, 255,  36, 123, 255,  36, 123, 255,  36, 123, 255,
+ 36, 123, 254,  36, 123, 254,  36, 123, 254,  36, 123, 254, 113, 169, 255, 113, 169, 255, 252, 254, 255, 252, 254, 255,
+220, 234, 255, 220, 234, 255, 253, 254, 255, 253, 254, 255, 115, 170, 255, 115, 170, 255,  36, 123, 255,  36, 123, 255,
+ 36, 123, 254,  36, 123, 254,  37, 124, 255,  37, 124, 255,  36, 123, 255,  36, 123, 255,  36, 123, 255,  36, 123, 255,
+ 24, 112, 254,  24, 112, 254,
+ 30, 120, 254,  30, 120, 254,  31, 120, 255,  31, 120, 255,  31, 120, 255,  31, 120, 255,  29, 120, 254,  29, 120, 254,
+ 31, 120, 255,  31, 120, 255,  29, 120, 254,  29, 120, 254,  31, 120, 255,  31, 120, 255, 110, 168, 255, 110, 168, 255,
+250, 253, 255, 250, 253, 255, 112, 168, 255, 112, 168, 255,  31, 120, 255,  31, 120, 255,  31, 120, 255,  31, 120, 255,
+ 29, 120, 254,  29, 120, 254,  31, 120, 255,  31, 120, 255,  31, 120, 255,  31, 120, 255,  31, 120, 255,  31, 120, 255,
+ 20, 110, 255,  20, 110, 255,
+ 30, 120, 254,  30, 120, 254,  31, 120, 255,  31, 120, 255,  31, 120, 255,  31, 120, 255,  29, 120, 254,  29, 120, 254,
+ 31, 120, 255,  31, 120, 255,  29, 120, 254,  29, 120, 254,  31, 120, 255,  31, 120, 255, 110, 168, 255, 110, 168, 255,
+250, 253, 255, 250, 253, 255, 112, 168, 255, 112, 168, 255,  31, 120, 255,  31, 120, 255,  31, 120, 255,  31, 120, 255,
+ 29, 120, 254,  29, 120, 254,  31, 120, 255,  31, 120, 255,  31, 120, 255,  31, 120, 255,  31, 120, 255,  31, 120, 255,
+ 20, 110, 255,  20, 110, 255,
+ 27, 118, 255,  27, 118, 255,  25, 116, 255,  25, 116, 255,  25, 116, 255,  25, 116, 255,  26, 117, 255,  26, 117, 255,
+ 26, 117, 255,  26, 117, 255,  25, 116, 255,  25, 116, 255,  26, 117, 255,  26, 117, 255,  26, 117, 255,  26, 117, 255,
+ 25, 116, 255,  25, 116, 255,  26, 117, 255,  26, 117, 255,  25, 116, 255,  25, 116, 255,  26, 117, 255,  26, 117, 255,
+ 25, 116, 255,  25, 116, 255,  26, 117, 255,  26, 117, 255,  26, 117, 255,  26, 117, 255,  25, 116, 255,  25, 116, 255,
+ 16, 107, 254,  16, 107, 254,
+ 27, 118, 255,  27, 118, 255,  25, 116, 255,  25, 116, 255,  25, 116, 255,  25, 116, 255,  26, 117, 255,  26, 117, 255,
+ 26, 117, 255,  26, 117, 255,  25, 116, 255,  25, 116, 255,  26, 117, 255,  26, 117, 255,  26, 117, 255,  26, 117, 255,
+ 25, 116, 255,  25, 116, 255,  26, 117, 255,  26, 117, 255,  25, 116, 255,  25, 116, 255,  26, 117, 255,  26, 117, 255,
+ 25, 116, 255,  25, 116, 255,  26, 117, 255,  26, 117, 255,  26, 117, 255,  26, 117, 255,  25, 116, 255,  25, 116, 255,
+ 16, 107, 254,  16, 107, 254,
+ 21, 115, 255,  21, 115, 255,  20, 113, 255,  20, 113, 255,  21, 114, 255,  21, 114, 255,  20, 113, 255,  20, 113, 255,
+ 21, 114, 255,  21, 114, 255,  20, 113, 255,  20, 113, 255,  21, 114, 255,  21, 114, 255,  21, 114, 255,  21, 114, 255,
+ 21, 114, 255,  21, 114, 255,  20, 113, 255,  20, 113, 255,  20, 114, 255,  20, 114, 255,  21, 114, 255,  21, 114, 255,
+ 20, 113, 255,  20, 113, 255,  20, 113, 255,  20, 113, 255,  21, 114, 255,  21, 114, 255,  19, 112, 255,  19, 112, 255,
+ 40, 119, 252,  40, 119, 252,
+ 21, 115, 255,  21, 115, 255,  20, 113, 255,  20, 113, 255,  21, 114, 255,  21, 114, 255,  20, 113, 255,  20, 113, 255,
+ 21, 114, 255,  21, 114, 255,  20, 113, 255,  20, 113, 255,  21, 114, 255,  21, 114, 255,  21, 114, 255,  21, 114, 255,
+ 21, 114, 255,  21, 114, 255,  20, 113, 255,  20, 113, 255,  20, 114, 255,  20, 114, 255,  21, 114, 255,  21, 114, 255,
+ 20, 113, 255,  20, 113, 255,  20, 113, 255,  20, 113, 255,  21, 114, 255,  21, 114, 255,  19, 112, 255,  19, 112, 255,
+ 40, 119, 252,  40, 119, 252,
+ 16, 112, 255,  16, 112, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,
+ 18, 112, 255,  18, 112, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  18, 112, 255,  18, 112, 255,
+ 15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  18, 112, 255,  18, 112, 255,
+ 15, 111, 255,  15, 111, 255,  18, 112, 255,  18, 112, 255,  15, 111, 255,  15, 111, 255,  13, 108, 255,  13, 108, 255,
+ 99, 151, 247,  99, 151, 247,
+ 16, 112, 255,  16, 112, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,
+ 18, 112, 255,  18, 112, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  18, 112, 255,  18, 112, 255,
+ 15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  15, 111, 255,  18, 112, 255,  18, 112, 255,
+ 15, 111, 255,  15, 111, 255,  18, 112, 255,  18, 112, 255,  15, 111, 255,  15, 111, 255,  13, 108, 255,  13, 108, 255,
+ 99, 151, 247,  99, 151, 247,
+ 14, 111, 255,  14, 111, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,
+ 12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,
+ 12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,
+ 12, 109, 255,  12, 109, 255,  11, 108, 255,  11, 108, 255,  10, 106, 255,  10, 106, 255,  50, 122, 248,  50, 122, 248,
+179, 200, 240, 179, 200, 240,
+ 14, 111, 255,  14, 111, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,
+ 12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,
+ 12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,  12, 109, 255,
+ 12, 109, 255,  12, 109, 255,  11, 108, 255,  11, 108, 255,  10, 106, 255,  10, 106, 255,  50, 122, 248,  50, 122, 248,
+179, 200, 240, 179, 200, 240,
+  5, 100, 255,   5, 100, 255,   4,  99, 255,   4,  99, 255,   5, 100, 255,   5, 100, 255,   4,  99, 255,   4,  99, 255,
+  4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,
+  5, 100, 255,   5, 100, 255,   5, 100, 255,   5, 100, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,
+  4,  99, 255,   4,  99, 255,  29, 111, 250,  29, 111, 250,  92, 144, 241,  92, 144, 241, 175, 196, 236, 175, 196, 236,
+236, 236, 236, 236, 236, 236,
+  5, 100, 255,   5, 100, 255,   4,  99, 255,   4,  99, 255,   5, 100, 255,   5, 100, 255,   4,  99, 255,   4,  99, 255,
+  4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,
+  5, 100, 255,   5, 100, 255,   5, 100, 255,   5, 100, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,   4,  99, 255,
+  4,  99, 255,   4,  99, 255,  29, 111, 250,  29, 111, 250,  92, 144, 241,  92, 144, 241, 175, 196, 236, 175, 196, 236,
+236, 236, 236, 236, 236, 236
+};
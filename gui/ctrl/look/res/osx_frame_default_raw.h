@@ -0,0 +1,46 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info osx_frame_default_1x_info(9, 21, 27, gui::pixel_format_t::RGB);
+static const unsigned char osx_frame_default_1x_pixels[] = {
+237, 237, 237, 198, 214, 241, 140, 178, 244,  96, 153, 249,  76, 139, 250,  96, 153, 249, 140, 178, 244, 198, 214, 241,
+237, 237, 237,
+197, 213, 240, 106, 158, 247,  94, 151, 250, 103, 158, 251, 107, 161, 251, 104, 159, 252,  94, 151, 251, 107, 158, 248,
+196, 212, 240,
+138, 178, 245,  91, 150, 251, 104, 159, 251, 104, 159, 252, 104, 159, 252, 104, 159, 252, 104, 159, 251,  91, 150, 251,
+137, 176, 244,
+ 90, 148, 250,  96, 153, 251, 100, 156, 251, 100, 156, 251,  99, 156, 251, 100, 156, 251, 100, 157, 252,  96, 153, 252,
+ 89, 147, 249,
+ 66, 132, 251,  95, 152, 252,  95, 152, 252,  95, 152, 252,  95, 152, 252,  95, 152, 252,  96, 153, 252,  95, 152, 251,
+ 65, 132, 251,
+ 63, 129, 251,  90, 150, 252,  91, 150, 252,  91, 150, 252,  90, 149, 252,  91, 150, 252,  90, 149, 252,  91, 150, 252,
+ 62, 129, 251,
+ 59, 127, 251,  86, 147, 252,  85, 146, 252,  85, 146, 252,  85, 146, 252,  85, 146, 252,  85, 146, 252,  85, 146, 252,
+ 58, 127, 252,
+ 56, 125, 252,  80, 144, 253,  80, 144, 253,  80, 143, 252,  80, 144, 253,  80, 143, 252,  80, 144, 253,  80, 144, 253,
+ 55, 124, 251,
+ 51, 122, 252,  74, 139, 252,  74, 139, 252,  74, 139, 253,  74, 139, 252,  74, 139, 252,  74, 139, 253,  74, 139, 253,
+ 50, 121, 252,
+ 49, 120, 253,  68, 136, 253,  68, 136, 253,  68, 136, 253,  68, 136, 253,  69, 136, 254,  68, 136, 253,  68, 136, 253,
+ 48, 119, 253,
+ 44, 116, 253,  62, 132, 253,  62, 132, 254,  62, 132, 253,  62, 132, 253,  62, 132, 253,  62, 132, 253,  62, 132, 253,
+ 43, 116, 253,
+ 40, 114, 253,  57, 127, 253,  57, 128, 254,  57, 128, 254,  57, 128, 254,  57, 128, 254,  57, 128, 254,  57, 128, 254,
+ 39, 113, 253,
+ 36, 110, 254,  51, 124, 254,  51, 124, 254,  51, 124, 254,  51, 124, 254,  51, 124, 254,  51, 124, 254,  51, 124, 254,
+ 35, 109, 253,
+ 31, 107, 254,  45, 119, 254,  45, 119, 254,  45, 119, 254,  45, 120, 255,  45, 120, 255,  45, 120, 255,  45, 119, 254,
+ 31, 107, 254,
+ 28, 104, 254,  39, 116, 255,  39, 116, 254,  39, 116, 255,  40, 117, 255,  39, 116, 254,  39, 116, 254,  39, 116, 254,
+ 27, 103, 254,
+ 25, 101, 254,  34, 112, 255,  33, 112, 254,  34, 112, 255,  34, 112, 255,  34, 112, 255,  34, 112, 255,  34, 112, 255,
+ 24, 100, 254,
+ 22, 100, 255,  29, 108, 255,  30, 109, 255,  30, 109, 255,  30, 109, 255,  30, 109, 255,  30, 109, 255,  29, 108, 255,
+ 21,  99, 255,
+ 43, 112, 252,  24, 104, 255,  25, 106, 255,  24, 104, 255,  24, 104, 255,  25, 106, 255,  25, 106, 255,  23, 103, 255,
+ 42, 111, 252,
+103, 150, 247,  17,  97, 255,  20, 102, 255,  20, 102, 255,  22, 103, 255,  22, 103, 255,  20, 102, 255,  17,  99, 255,
+100, 147, 247,
+181, 201, 241,  53, 116, 248,  14,  95, 255,  16,  99, 255,  17, 100, 255,  16,  99, 255,  15,  96, 255,  52, 115, 248,
+180, 200, 241,
+237, 237, 237, 176, 196, 237,  93, 140, 241,  32, 102, 250,   8,  88, 255,  32, 103, 250,  93, 140, 241, 176, 196, 237,
+237, 237, 237
+};
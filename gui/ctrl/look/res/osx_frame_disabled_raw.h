@@ -0,0 +1,46 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info osx_frame_disabled_1x_info(9, 21, 27, gui::pixel_format_t::RGB);
+static const unsigned char osx_frame_disabled_1x_pixels[] = {
+226, 226, 226, 223, 223, 223, 218, 218, 218, 214, 214, 214, 210, 210, 210, 214, 214, 214, 218, 218, 218, 223, 223, 223,
+226, 226, 226,
+223, 223, 223, 215, 215, 215, 218, 218, 218, 232, 232, 232, 241, 241, 241, 232, 232, 232, 218, 218, 218, 215, 215, 215,
+223, 223, 223,
+218, 218, 218, 217, 217, 217, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 217, 217, 217,
+218, 218, 218,
+213, 213, 213, 232, 232, 232, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 232, 232, 232,
+213, 213, 213,
+208, 208, 208, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+209, 209, 209,
+207, 207, 207, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+208, 208, 208,
+207, 207, 207, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+208, 208, 208,
+207, 207, 207, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+208, 208, 208,
+207, 207, 207, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+208, 208, 208,
+207, 207, 207, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+208, 208, 208,
+207, 207, 207, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+208, 208, 208,
+207, 207, 207, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+208, 208, 208,
+207, 207, 207, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+208, 208, 208,
+207, 207, 207, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+208, 208, 208,
+207, 207, 207, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+208, 208, 208,
+207, 207, 207, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+208, 208, 208,
+207, 207, 207, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+208, 208, 208,
+211, 211, 211, 231, 231, 231, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 231, 231, 231,
+211, 211, 211,
+216, 216, 216, 214, 214, 214, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 214, 214, 214,
+216, 216, 216,
+223, 223, 223, 208, 208, 208, 212, 212, 212, 231, 231, 231, 241, 241, 241, 231, 231, 231, 212, 212, 212, 208, 208, 208,
+223, 223, 223,
+226, 226, 226, 221, 221, 221, 210, 210, 210, 201, 201, 201, 197, 197, 197, 201, 201, 201, 210, 210, 210, 221, 221, 221,
+226, 226, 226
+};
@@ -0,0 +1,46 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info osx_frame_pressed_1x_info(9, 21, 27, gui::pixel_format_t::RGB);
+static const unsigned char osx_frame_pressed_1x_pixels[] = {
+237, 237, 237, 188, 207, 242, 117, 165, 248,  60, 135, 253,  35, 120, 255,  60, 135, 253, 118, 167, 248, 188, 207, 242,
+237, 237, 237,
+188, 207, 241,  76, 143, 251,  58, 134, 254,  69, 141, 254,  74, 144, 254,  69, 141, 254,  58, 134, 254,  75, 142, 250,
+187, 206, 241,
+116, 164, 247,  56, 132, 253,  71, 142, 253,  72, 143, 254,  72, 142, 253,  72, 142, 253,  72, 142, 253,  56, 132, 253,
+116, 164, 247,
+ 59, 131, 250,  64, 137, 252,  69, 140, 252,  69, 140, 252,  69, 140, 252,  69, 140, 252,  69, 140, 252,  64, 137, 252,
+ 57, 129, 250,
+ 31, 115, 250,  66, 138, 251,  66, 138, 251,  66, 138, 251,  66, 138, 251,  65, 137, 251,  65, 137, 251,  66, 138, 251,
+ 29, 113, 249,
+ 29, 113, 248,  63, 136, 250,  62, 135, 249,  62, 135, 250,  62, 135, 250,  62, 135, 250,  63, 136, 250,  62, 135, 249,
+ 29, 113, 249,
+ 28, 112, 247,  59, 133, 249,  59, 133, 249,  59, 133, 249,  59, 133, 249,  59, 133, 249,  58, 132, 248,  59, 133, 249,
+ 26, 110, 246,
+ 26, 109, 245,  54, 129, 247,  55, 130, 247,  55, 130, 247,  55, 130, 247,  54, 129, 247,  55, 130, 247,  55, 130, 247,
+ 25, 108, 245,
+ 23, 106, 242,  50, 126, 245,  51, 127, 246,  51, 127, 246,  50, 126, 245,  50, 126, 245,  50, 126, 245,  51, 127, 246,
+ 23, 106, 243,
+ 22, 105, 241,  45, 123, 243,  46, 124, 244,  46, 124, 244,  45, 123, 244,  45, 123, 244,  46, 124, 244,  45, 123, 244,
+ 21, 104, 241,
+ 20, 103, 239,  43, 121, 243,  42, 120, 242,  42, 120, 242,  43, 121, 243,  43, 120, 243,  43, 121, 243,  42, 120, 242,
+ 19, 102, 239,
+ 18, 100, 237,  38, 117, 241,  38, 117, 241,  38, 117, 241,  38, 117, 241,  37, 116, 240,  38, 117, 241,  38, 117, 241,
+ 17,  99, 237,
+ 17,  99, 236,  34, 114, 239,  34, 114, 239,  34, 114, 239,  33, 113, 239,  34, 114, 239,  33, 113, 239,  34, 114, 240,
+ 16,  98, 236,
+ 14,  96, 233,  29, 110, 237,  30, 111, 238,  29, 110, 237,  29, 110, 237,  29, 110, 237,  29, 110, 237,  29, 110, 237,
+ 13,  95, 233,
+ 13,  94, 231,  25, 107, 236,  26, 108, 236,  25, 107, 236,  26, 108, 236,  25, 107, 236,  26, 108, 236,  25, 107, 236,
+ 12,  93, 232,
+ 10,  91, 229,  22, 105, 235,  21, 104, 234,  22, 105, 235,  22, 105, 235,  21, 104, 234,  21, 104, 235,  21, 104, 235,
+  9,  90, 229,
+  9,  90, 228,  19, 102, 233,  19, 102, 234,  19, 102, 233,  19, 102, 233,  18, 101, 233,  19, 102, 233,  18, 101, 233,
+  8,  89, 228,
+ 36, 104, 228,  12,  97, 231,  14,  99, 232,  15,  99, 232,  14,  99, 232,  15,  99, 232,  14,  99, 232,  14,  98, 231,
+ 33, 102, 227,
+ 97, 142, 228,   9,  92, 228,  11,  97, 231,  11,  97, 231,  11,  97, 231,  11,  97, 231,  11,  97, 231,   9,  92, 228,
+ 96, 142, 228,
+180, 198, 233,  46, 110, 224,   5,  90, 227,   8,  93, 229,   8,  94, 230,   7,  93, 229,   5,  90, 227,  45, 109, 223,
+179, 197, 232,
+237, 237, 237, 175, 192, 229,  89, 134, 221,  27,  96, 220,   2,  82, 222,  27,  96, 220,  89, 134, 221, 175, 192, 229,
+237, 237, 237
+};
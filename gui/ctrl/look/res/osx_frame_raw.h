@@ -0,0 +1,46 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info osx_frame_1x_info(9, 21, 27, gui::pixel_format_t::RGB);
+static const unsigned char osx_frame_1x_pixels[] = {
+236, 236, 236, 230, 230, 230, 219, 219, 219, 209, 209, 209, 203, 203, 203, 209, 209, 209, 219, 219, 219, 230, 230, 230,
+236, 236, 236,
+230, 230, 230, 211, 211, 211, 213, 213, 213, 240, 240, 240, 255, 255, 255, 240, 240, 240, 213, 213, 213, 211, 211, 211,
+230, 230, 230,
+219, 219, 219, 213, 213, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212, 212, 212,
+219, 219, 219,
+208, 208, 208, 238, 238, 238, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 238, 238, 238,
+208, 208, 208,
+199, 199, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+199, 199, 199,
+196, 196, 196, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+196, 196, 196,
+195, 195, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+195, 195, 195,
+195, 195, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+195, 195, 195,
+195, 195, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+195, 195, 195,
+195, 195, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+195, 195, 195,
+195, 195, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+195, 195, 195,
+195, 195, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+195, 195, 195,
+195, 195, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+195, 195, 195,
+195, 195, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+195, 195, 195,
+195, 195, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+195, 195, 195,
+195, 195, 195, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+195, 195, 195,
+196, 196, 196, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+196, 196, 196,
+204, 204, 204, 235, 235, 235, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 235, 235, 235,
+204, 204, 204,
+215, 215, 215, 204, 204, 204, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 203, 203, 203,
+215, 215, 215,
+230, 230, 230, 197, 197, 197, 200, 200, 200, 235, 235, 235, 255, 255, 255, 235, 235, 235, 200, 200, 200, 197, 197, 197,
+230, 230, 230,
+236, 236, 236, 225, 225, 225, 202, 202, 202, 184, 184, 184, 175, 175, 175, 184, 184, 184, 202, 202, 202, 225, 225, 225,
+236, 236, 236
+};
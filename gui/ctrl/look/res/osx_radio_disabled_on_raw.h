@@ -0,0 +1,167 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info osx_radio_disabled_on_1x_info(16, 16, 48, gui::pixel_format_t::RGB);
+static const unsigned char osx_radio_disabled_on_1x_pixels[] = {
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 214, 214, 214, 201, 201, 201, 191, 191, 191, 183, 183, 183,
+183, 183, 183, 191, 191, 191, 201, 201, 201, 214, 214, 214,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 221, 221, 221, 202, 202, 202, 192, 192, 192, 206, 206, 206, 219, 219, 219, 228, 228, 228,
+228, 228, 228, 219, 219, 219, 206, 206, 206, 192, 192, 192, 202, 202, 202, 221, 221, 221,   0,   0,   0,   0,   0,   0,
+  0,   0,   0, 221, 221, 221, 199, 199, 199, 202, 202, 202, 228, 228, 228, 239, 239, 239, 240, 240, 240, 241, 241, 241,
+241, 241, 241, 240, 240, 240, 239, 239, 239, 228, 228, 228, 202, 202, 202, 199, 199, 199, 221, 221, 221,   0,   0,   0,
+  0,   0,   0, 203, 203, 203, 205, 205, 205, 236, 236, 236, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 236, 236, 236, 205, 205, 205, 203, 203, 203,   0,   0,   0,
+215, 215, 215, 198, 198, 198, 232, 232, 232, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 232, 232, 232, 198, 198, 198, 215, 215, 215,
+204, 204, 204, 214, 214, 214, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 214, 214, 214, 175, 175, 175,
+177, 177, 177, 213, 213, 213, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 214, 214, 214, 204, 204, 204,
+198, 198, 198, 229, 229, 229, 241, 241, 241, 241, 241, 241, 241, 241, 241, 215, 215, 215, 146, 146, 146, 145, 145, 145,
+145, 145, 145, 146, 146, 146, 215, 215, 215, 241, 241, 241, 241, 241, 241, 241, 241, 241, 229, 229, 229, 198, 198, 198,
+193, 193, 193, 237, 237, 237, 241, 241, 241, 241, 241, 241, 241, 241, 241, 177, 177, 177, 145, 145, 145, 145, 145, 145,
+145, 145, 145, 145, 145, 145, 174, 174, 174, 241, 241, 241, 241, 241, 241, 241, 241, 241, 237, 237, 237, 193, 193, 193,
+194, 194, 194, 237, 237, 237, 241, 241, 241, 241, 241, 241, 241, 241, 241, 177, 177, 177, 145, 145, 145, 145, 145, 145,
+145, 145, 145, 145, 145, 145, 174, 174, 174, 241, 241, 241, 241, 241, 241, 241, 241, 241, 237, 237, 237, 194, 194, 194,
+200, 200, 200, 229, 229, 229, 241, 241, 241, 241, 241, 241, 241, 241, 241, 215, 215, 215, 146, 146, 146, 145, 145, 145,
+145, 145, 145, 146, 146, 146, 215, 215, 215, 241, 241, 241, 241, 241, 241, 241, 241, 241, 229, 229, 229, 200, 200, 200,
+207, 207, 207, 216, 216, 216, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 213, 213, 213, 174, 174, 174,
+177, 177, 177, 213, 213, 213, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 216, 216, 216, 207, 207, 207,
+217, 217, 217, 203, 203, 203, 233, 233, 233, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 233, 233, 233, 203, 203, 203, 217, 217, 217,
+  0,   0,   0, 208, 208, 208, 211, 211, 211, 238, 238, 238, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 238, 238, 238, 211, 211, 211, 208, 208, 208,   0,   0,   0,
+  0,   0,   0, 223, 223, 223, 205, 205, 205, 211, 211, 211, 233, 233, 233, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 233, 233, 233, 211, 211, 211, 205, 205, 205, 223, 223, 223,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 223, 223, 223, 208, 208, 208, 203, 203, 203, 216, 216, 216, 229, 229, 229, 237, 237, 237,
+237, 237, 237, 229, 229, 229, 216, 216, 216, 203, 203, 203, 208, 208, 208, 223, 223, 223,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 217, 217, 217, 207, 207, 207, 200, 200, 200, 195, 195, 195,
+195, 195, 195, 200, 200, 200, 207, 207, 207, 217, 217, 217,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+static const gui::draw::bitmap_info osx_radio_disabled_on_2x_info(32, 32, 96, gui::pixel_format_t::RGB);
+static const unsigned char osx_radio_disabled_on_2x_pixels[] = {
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+214, 214, 214, 214, 214, 214, 201, 201, 201, 201, 201, 201, 191, 191, 191, 191, 191, 191, 183, 183, 183, 183, 183, 183,
+183, 183, 183, 183, 183, 183, 191, 191, 191, 191, 191, 191, 201, 201, 201, 201, 201, 201, 214, 214, 214, 214, 214, 214,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+214, 214, 214, 214, 214, 214, 201, 201, 201, 201, 201, 201, 191, 191, 191, 191, 191, 191, 183, 183, 183, 183, 183, 183,
+183, 183, 183, 183, 183, 183, 191, 191, 191, 191, 191, 191, 201, 201, 201, 201, 201, 201, 214, 214, 214, 214, 214, 214,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 221, 221, 221, 221, 221, 221, 202, 202, 202, 202, 202, 202,
+192, 192, 192, 192, 192, 192, 206, 206, 206, 206, 206, 206, 219, 219, 219, 219, 219, 219, 228, 228, 228, 228, 228, 228,
+228, 228, 228, 228, 228, 228, 219, 219, 219, 219, 219, 219, 206, 206, 206, 206, 206, 206, 192, 192, 192, 192, 192, 192,
+202, 202, 202, 202, 202, 202, 221, 221, 221, 221, 221, 221,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 221, 221, 221, 221, 221, 221, 202, 202, 202, 202, 202, 202,
+192, 192, 192, 192, 192, 192, 206, 206, 206, 206, 206, 206, 219, 219, 219, 219, 219, 219, 228, 228, 228, 228, 228, 228,
+228, 228, 228, 228, 228, 228, 219, 219, 219, 219, 219, 219, 206, 206, 206, 206, 206, 206, 192, 192, 192, 192, 192, 192,
+202, 202, 202, 202, 202, 202, 221, 221, 221, 221, 221, 221,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 221, 221, 221, 221, 221, 221, 199, 199, 199, 199, 199, 199, 202, 202, 202, 202, 202, 202,
+228, 228, 228, 228, 228, 228, 239, 239, 239, 239, 239, 239, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 240, 240, 240, 240, 240, 240, 239, 239, 239, 239, 239, 239, 228, 228, 228, 228, 228, 228,
+202, 202, 202, 202, 202, 202, 199, 199, 199, 199, 199, 199, 221, 221, 221, 221, 221, 221,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 221, 221, 221, 221, 221, 221, 199, 199, 199, 199, 199, 199, 202, 202, 202, 202, 202, 202,
+228, 228, 228, 228, 228, 228, 239, 239, 239, 239, 239, 239, 240, 240, 240, 240, 240, 240, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 240, 240, 240, 240, 240, 240, 239, 239, 239, 239, 239, 239, 228, 228, 228, 228, 228, 228,
+202, 202, 202, 202, 202, 202, 199, 199, 199, 199, 199, 199, 221, 221, 221, 221, 221, 221,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 203, 203, 203, 203, 203, 203, 205, 205, 205, 205, 205, 205, 236, 236, 236, 236, 236, 236,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+236, 236, 236, 236, 236, 236, 205, 205, 205, 205, 205, 205, 203, 203, 203, 203, 203, 203,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 203, 203, 203, 203, 203, 203, 205, 205, 205, 205, 205, 205, 236, 236, 236, 236, 236, 236,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+236, 236, 236, 236, 236, 236, 205, 205, 205, 205, 205, 205, 203, 203, 203, 203, 203, 203,   0,   0,   0,   0,   0,   0,
+215, 215, 215, 215, 215, 215, 198, 198, 198, 198, 198, 198, 232, 232, 232, 232, 232, 232, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 232, 232, 232, 232, 232, 232, 198, 198, 198, 198, 198, 198, 215, 215, 215, 215, 215, 215,
+215, 215, 215, 215, 215, 215, 198, 198, 198, 198, 198, 198, 232, 232, 232, 232, 232, 232, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 232, 232, 232, 232, 232, 232, 198, 198, 198, 198, 198, 198, 215, 215, 215, 215, 215, 215,
+204, 204, 204, 204, 204, 204, 214, 214, 214, 214, 214, 214, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 214, 214, 214, 214, 214, 214, 175, 175, 175, 175, 175, 175,
+177, 177, 177, 177, 177, 177, 213, 213, 213, 213, 213, 213, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 214, 214, 214, 214, 214, 214, 204, 204, 204, 204, 204, 204,
+204, 204, 204, 204, 204, 204, 214, 214, 214, 214, 214, 214, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 214, 214, 214, 214, 214, 214, 175, 175, 175, 175, 175, 175,
+177, 177, 177, 177, 177, 177, 213, 213, 213, 213, 213, 213, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 214, 214, 214, 214, 214, 214, 204, 204, 204, 204, 204, 204,
+198, 198, 198, 198, 198, 198, 229, 229, 229, 229, 229, 229, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 215, 215, 215, 215, 215, 215, 146, 146, 146, 146, 146, 146, 145, 145, 145, 145, 145, 145,
+145, 145, 145, 145, 145, 145, 146, 146, 146, 146, 146, 146, 215, 215, 215, 215, 215, 215, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 229, 229, 229, 229, 229, 229, 198, 198, 198, 198, 198, 198,
+198, 198, 198, 198, 198, 198, 229, 229, 229, 229, 229, 229, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 215, 215, 215, 215, 215, 215, 146, 146, 146, 146, 146, 146, 145, 145, 145, 145, 145, 145,
+145, 145, 145, 145, 145, 145, 146, 146, 146, 146, 146, 146, 215, 215, 215, 215, 215, 215, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 229, 229, 229, 229, 229, 229, 198, 198, 198, 198, 198, 198,
+193, 193, 193, 193, 193, 193, 237, 237, 237, 237, 237, 237, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 177, 177, 177, 177, 177, 177, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 174, 174, 174, 174, 174, 174, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 237, 237, 237, 237, 237, 237, 193, 193, 193, 193, 193, 193,
+193, 193, 193, 193, 193, 193, 237, 237, 237, 237, 237, 237, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 177, 177, 177, 177, 177, 177, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 174, 174, 174, 174, 174, 174, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 237, 237, 237, 237, 237, 237, 193, 193, 193, 193, 193, 193,
+194, 194, 194, 194, 194, 194, 237, 237, 237, 237, 237, 237, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 177, 177, 177, 177, 177, 177, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 174, 174, 174, 174, 174, 174, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 237, 237, 237, 237, 237, 237, 194, 194, 194, 194, 194, 194,
+194, 194, 194, 194, 194, 194, 237, 237, 237, 237, 237, 237, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 177, 177, 177, 177, 177, 177, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145,
+145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 145, 174, 174, 174, 174, 174, 174, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 237, 237, 237, 237, 237, 237, 194, 194, 194, 194, 194, 194,
+200, 200, 200, 200, 200, 200, 229, 229, 229, 229, 229, 229, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 215, 215, 215, 215, 215, 215, 146, 146, 146, 146, 146, 146, 145, 145, 145, 145, 145, 145,
+145, 145, 145, 145, 145, 145, 146, 146, 146, 146, 146, 146, 215, 215, 215, 215, 215, 215, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 229, 229, 229, 229, 229, 229, 200, 200, 200, 200, 200, 200,
+200, 200, 200, 200, 200, 200, 229, 229, 229, 229, 229, 229, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 215, 215, 215, 215, 215, 215, 146, 146, 146, 146, 146, 146, 145, 145, 145, 145, 145, 145,
+145, 145, 145, 145, 145, 145, 146, 146, 146, 146, 146, 146, 215, 215, 215, 215, 215, 215, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 229, 229, 229, 229, 229, 229, 200, 200, 200, 200, 200, 200,
+207, 207, 207, 207, 207, 207, 216, 216, 216, 216, 216, 216, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 213, 213, 213, 213, 213, 213, 174, 174, 174, 174, 174, 174,
+177, 177, 177, 177, 177, 177, 213, 213, 213, 213, 213, 213, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 216, 216, 216, 216, 216, 216, 207, 207, 207, 207, 207, 207,
+207, 207, 207, 207, 207, 207, 216, 216, 216, 216, 216, 216, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 213, 213, 213, 213, 213, 213, 174, 174, 174, 174, 174, 174,
+177, 177, 177, 177, 177, 177, 213, 213, 213, 213, 213, 213, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 216, 216, 216, 216, 216, 216, 207, 207, 207, 207, 207, 207,
+217, 217, 217, 217, 217, 217, 203, 203, 203, 203, 203, 203, 233, 233, 233, 233, 233, 233, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 233, 233, 233, 233, 233, 233, 203, 203, 203, 203, 203, 203, 217, 217, 217, 217, 217, 217,
+217, 217, 217, 217, 217, 217, 203, 203, 203, 203, 203, 203, 233, 233, 233, 233, 233, 233, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 233, 233, 233, 233, 233, 233, 203, 203, 203, 203, 203, 203, 217, 217, 217, 217, 217, 217,
+  0,   0,   0,   0,   0,   0, 208, 208, 208, 208, 208, 208, 211, 211, 211, 211, 211, 211, 238, 238, 238, 238, 238, 238,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+238, 238, 238, 238, 238, 238, 211, 211, 211, 211, 211, 211, 208, 208, 208, 208, 208, 208,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 208, 208, 208, 208, 208, 208, 211, 211, 211, 211, 211, 211, 238, 238, 238, 238, 238, 238,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+238, 238, 238, 238, 238, 238, 211, 211, 211, 211, 211, 211, 208, 208, 208, 208, 208, 208,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 223, 223, 223, 223, 223, 223, 205, 205, 205, 205, 205, 205, 211, 211, 211, 211, 211, 211,
+233, 233, 233, 233, 233, 233, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 233, 233, 233, 233, 233, 233,
+211, 211, 211, 211, 211, 211, 205, 205, 205, 205, 205, 205, 223, 223, 223, 223, 223, 223,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 223, 223, 223, 223, 223, 223, 205, 205, 205, 205, 205, 205, 211, 211, 211, 211, 211, 211,
+233, 233, 233, 233, 233, 233, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241, 233, 233, 233, 233, 233, 233,
+211, 211, 211, 211, 211, 211, 205, 205, 205, 205, 205, 205, 223, 223, 223, 223, 223, 223,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 223, 223, 223, 223, 223, 223, 208, 208, 208, 208, 208, 208,
+203, 203, 203, 203, 203, 203, 216, 216, 216, 216, 216, 216, 229, 229, 229, 229, 229, 229, 237, 237, 237, 237, 237, 237,
+237, 237, 237, 237, 237, 237, 229, 229, 229, 229, 229, 229, 216, 216, 216, 216, 216, 216, 203, 203, 203, 203, 203, 203,
+208, 208, 208, 208, 208, 208, 223, 223, 223, 223, 223, 223,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 223, 223, 223, 223, 223, 223, 208, 208, 208, 208, 208, 208,
+203, 203, 203, 203, 203, 203, 216, 216, 216, 216, 216, 216, 229, 229, 229, 229, 229, 229, 237, 237, 237, 237, 237, 237,
+237, 237, 237, 237, 237, 237, 229, 229, 229, 229, 229, 229, 216, 216, 216, 216, 216, 216, 203, 203, 203, 203, 203, 203,
+208, 208, 208, 208, 208, 208, 223, 223, 223, 223, 223, 223,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+217, 217, 217, 217, 217, 217, 207, 207, 207, 207, 207, 207, 200, 200, 200, 200, 200, 200, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 200, 200, 200, 200, 200, 200, 207, 207, 207, 207, 207, 207, 217, 217, 217, 217, 217, 217,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+217, 217, 217, 217, 217, 217, 207, 207, 207, 207, 207, 207, 200, 200, 200, 200, 200, 200, 195, 195, 195, 195, 195, 195,
+195, 195, 195, 195, 195, 195, 200, 200, 200, 200, 200, 200, 207, 207, 207, 207, 207, 207, 217, 217, 217, 217, 217, 217,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
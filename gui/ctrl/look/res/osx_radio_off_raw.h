@@ -0,0 +1,167 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info osx_radio_off_1x_info(16, 16, 48, gui::pixel_format_t::RGB);
+static const unsigned char osx_radio_off_1x_pixels[] = {
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 212, 212, 212, 189, 189, 189, 170, 170, 170, 156, 156, 156,
+156, 156, 156, 170, 170, 170, 189, 189, 189, 212, 212, 212,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 225, 225, 225, 190, 190, 190, 173, 173, 173, 195, 195, 195, 217, 217, 217, 232, 232, 232,
+232, 232, 232, 217, 217, 217, 195, 195, 195, 173, 173, 173, 190, 190, 190, 225, 225, 225,   0,   0,   0,   0,   0,   0,
+  0,   0,   0, 225, 225, 225, 184, 184, 184, 190, 190, 190, 233, 233, 233, 251, 251, 251, 254, 254, 254, 255, 255, 255,
+255, 255, 255, 254, 254, 254, 251, 251, 251, 233, 233, 233, 190, 190, 190, 184, 184, 184, 225, 225, 225,   0,   0,   0,
+  0,   0,   0, 192, 192, 192, 195, 195, 195, 247, 247, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 247, 247, 195, 195, 195, 192, 192, 192,   0,   0,   0,
+214, 214, 214, 183, 183, 183, 240, 240, 240, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 240, 240, 240, 183, 183, 183, 214, 214, 214,
+196, 196, 196, 214, 214, 214, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 214, 214, 214, 196, 196, 196,
+185, 185, 185, 236, 236, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 236, 236, 185, 185, 185,
+179, 179, 179, 250, 250, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 250, 250, 179, 179, 179,
+181, 181, 181, 250, 250, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 250, 250, 181, 181, 181,
+191, 191, 191, 236, 236, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 236, 236, 191, 191, 191,
+204, 204, 204, 217, 217, 217, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 217, 217, 217, 204, 204, 204,
+220, 220, 220, 196, 196, 196, 242, 242, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 242, 242, 242, 196, 196, 196, 220, 220, 220,
+  0,   0,   0, 204, 204, 204, 209, 209, 209, 251, 251, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 251, 251, 209, 209, 209, 204, 204, 204,   0,   0,   0,
+  0,   0,   0, 228, 228, 228, 199, 199, 199, 209, 209, 209, 242, 242, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 242, 242, 242, 209, 209, 209, 199, 199, 199, 228, 228, 228,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 228, 228, 228, 204, 204, 204, 196, 196, 196, 217, 217, 217, 236, 236, 236, 250, 250, 250,
+250, 250, 250, 236, 236, 236, 217, 217, 217, 196, 196, 196, 204, 204, 204, 228, 228, 228,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 220, 220, 220, 204, 204, 204, 191, 191, 191, 182, 182, 182,
+182, 182, 182, 191, 191, 191, 204, 204, 204, 220, 220, 220,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+static const gui::draw::bitmap_info osx_radio_off_2x_info(32, 32, 96, gui::pixel_format_t::RGB);
+static const unsigned char osx_radio_off_2x_pixels[] = {
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+212, 212, 212, 212, 212, 212, 189, 189, 189, 189, 189, 189, 170, 170, 170, 170, 170, 170, 156, 156, 156, 156, 156, 156,
+156, 156, 156, 156, 156, 156, 170, 170, 170, 170, 170, 170, 189, 189, 189, 189, 189, 189, 212, 212, 212, 212, 212, 212,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+212, 212, 212, 212, 212, 212, 189, 189, 189, 189, 189, 189, 170, 170, 170, 170, 170, 170, 156, 156, 156, 156, 156, 156,
+156, 156, 156, 156, 156, 156, 170, 170, 170, 170, 170, 170, 189, 189, 189, 189, 189, 189, 212, 212, 212, 212, 212, 212,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 225, 225, 225, 225, 225, 225, 190, 190, 190, 190, 190, 190,
+173, 173, 173, 173, 173, 173, 195, 195, 195, 195, 195, 195, 217, 217, 217, 217, 217, 217, 232, 232, 232, 232, 232, 232,
+232, 232, 232, 232, 232, 232, 217, 217, 217, 217, 217, 217, 195, 195, 195, 195, 195, 195, 173, 173, 173, 173, 173, 173,
+190, 190, 190, 190, 190, 190, 225, 225, 225, 225, 225, 225,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 225, 225, 225, 225, 225, 225, 190, 190, 190, 190, 190, 190,
+173, 173, 173, 173, 173, 173, 195, 195, 195, 195, 195, 195, 217, 217, 217, 217, 217, 217, 232, 232, 232, 232, 232, 232,
+232, 232, 232, 232, 232, 232, 217, 217, 217, 217, 217, 217, 195, 195, 195, 195, 195, 195, 173, 173, 173, 173, 173, 173,
+190, 190, 190, 190, 190, 190, 225, 225, 225, 225, 225, 225,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 225, 225, 225, 225, 225, 225, 184, 184, 184, 184, 184, 184, 190, 190, 190, 190, 190, 190,
+233, 233, 233, 233, 233, 233, 251, 251, 251, 251, 251, 251, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 254, 254, 254, 254, 254, 254, 251, 251, 251, 251, 251, 251, 233, 233, 233, 233, 233, 233,
+190, 190, 190, 190, 190, 190, 184, 184, 184, 184, 184, 184, 225, 225, 225, 225, 225, 225,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 225, 225, 225, 225, 225, 225, 184, 184, 184, 184, 184, 184, 190, 190, 190, 190, 190, 190,
+233, 233, 233, 233, 233, 233, 251, 251, 251, 251, 251, 251, 254, 254, 254, 254, 254, 254, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 254, 254, 254, 254, 254, 254, 251, 251, 251, 251, 251, 251, 233, 233, 233, 233, 233, 233,
+190, 190, 190, 190, 190, 190, 184, 184, 184, 184, 184, 184, 225, 225, 225, 225, 225, 225,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 192, 192, 192, 192, 192, 192, 195, 195, 195, 195, 195, 195, 247, 247, 247, 247, 247, 247,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+247, 247, 247, 247, 247, 247, 195, 195, 195, 195, 195, 195, 192, 192, 192, 192, 192, 192,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 192, 192, 192, 192, 192, 192, 195, 195, 195, 195, 195, 195, 247, 247, 247, 247, 247, 247,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+247, 247, 247, 247, 247, 247, 195, 195, 195, 195, 195, 195, 192, 192, 192, 192, 192, 192,   0,   0,   0,   0,   0,   0,
+214, 214, 214, 214, 214, 214, 183, 183, 183, 183, 183, 183, 240, 240, 240, 240, 240, 240, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 240, 240, 240, 240, 240, 240, 183, 183, 183, 183, 183, 183, 214, 214, 214, 214, 214, 214,
+214, 214, 214, 214, 214, 214, 183, 183, 183, 183, 183, 183, 240, 240, 240, 240, 240, 240, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 240, 240, 240, 240, 240, 240, 183, 183, 183, 183, 183, 183, 214, 214, 214, 214, 214, 214,
+196, 196, 196, 196, 196, 196, 214, 214, 214, 214, 214, 214, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 214, 214, 214, 214, 214, 214, 196, 196, 196, 196, 196, 196,
+196, 196, 196, 196, 196, 196, 214, 214, 214, 214, 214, 214, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 214, 214, 214, 214, 214, 214, 196, 196, 196, 196, 196, 196,
+185, 185, 185, 185, 185, 185, 236, 236, 236, 236, 236, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 236, 236, 236, 236, 236, 185, 185, 185, 185, 185, 185,
+185, 185, 185, 185, 185, 185, 236, 236, 236, 236, 236, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 236, 236, 236, 236, 236, 185, 185, 185, 185, 185, 185,
+179, 179, 179, 179, 179, 179, 250, 250, 250, 250, 250, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 250, 250, 250, 250, 250, 179, 179, 179, 179, 179, 179,
+179, 179, 179, 179, 179, 179, 250, 250, 250, 250, 250, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 250, 250, 250, 250, 250, 179, 179, 179, 179, 179, 179,
+181, 181, 181, 181, 181, 181, 250, 250, 250, 250, 250, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 250, 250, 250, 250, 250, 181, 181, 181, 181, 181, 181,
+181, 181, 181, 181, 181, 181, 250, 250, 250, 250, 250, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 250, 250, 250, 250, 250, 181, 181, 181, 181, 181, 181,
+191, 191, 191, 191, 191, 191, 236, 236, 236, 236, 236, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 236, 236, 236, 236, 236, 191, 191, 191, 191, 191, 191,
+191, 191, 191, 191, 191, 191, 236, 236, 236, 236, 236, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 236, 236, 236, 236, 236, 236, 191, 191, 191, 191, 191, 191,
+204, 204, 204, 204, 204, 204, 217, 217, 217, 217, 217, 217, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 217, 217, 217, 217, 217, 217, 204, 204, 204, 204, 204, 204,
+204, 204, 204, 204, 204, 204, 217, 217, 217, 217, 217, 217, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 217, 217, 217, 217, 217, 217, 204, 204, 204, 204, 204, 204,
+220, 220, 220, 220, 220, 220, 196, 196, 196, 196, 196, 196, 242, 242, 242, 242, 242, 242, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 242, 242, 242, 242, 242, 242, 196, 196, 196, 196, 196, 196, 220, 220, 220, 220, 220, 220,
+220, 220, 220, 220, 220, 220, 196, 196, 196, 196, 196, 196, 242, 242, 242, 242, 242, 242, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 242, 242, 242, 242, 242, 242, 196, 196, 196, 196, 196, 196, 220, 220, 220, 220, 220, 220,
+  0,   0,   0,   0,   0,   0, 204, 204, 204, 204, 204, 204, 209, 209, 209, 209, 209, 209, 251, 251, 251, 251, 251, 251,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+251, 251, 251, 251, 251, 251, 209, 209, 209, 209, 209, 209, 204, 204, 204, 204, 204, 204,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 204, 204, 204, 204, 204, 204, 209, 209, 209, 209, 209, 209, 251, 251, 251, 251, 251, 251,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+251, 251, 251, 251, 251, 251, 209, 209, 209, 209, 209, 209, 204, 204, 204, 204, 204, 204,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 228, 228, 228, 228, 228, 228, 199, 199, 199, 199, 199, 199, 209, 209, 209, 209, 209, 209,
+242, 242, 242, 242, 242, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 242, 242, 242, 242, 242, 242,
+209, 209, 209, 209, 209, 209, 199, 199, 199, 199, 199, 199, 228, 228, 228, 228, 228, 228,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 228, 228, 228, 228, 228, 228, 199, 199, 199, 199, 199, 199, 209, 209, 209, 209, 209, 209,
+242, 242, 242, 242, 242, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 242, 242, 242, 242, 242, 242,
+209, 209, 209, 209, 209, 209, 199, 199, 199, 199, 199, 199, 228, 228, 228, 228, 228, 228,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 228, 228, 228, 228, 228, 228, 204, 204, 204, 204, 204, 204,
+196, 196, 196, 196, 196, 196, 217, 217, 217, 217, 217, 217, 236, 236, 236, 236, 236, 236, 250, 250, 250, 250, 250, 250,
+250, 250, 250, 250, 250, 250, 236, 236, 236, 236, 236, 236, 217, 217, 217, 217, 217, 217, 196, 196, 196, 196, 196, 196,
+204, 204, 204, 204, 204, 204, 228, 228, 228, 228, 228, 228,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 228, 228, 228, 228, 228, 228, 204, 204, 204, 204, 204, 204,
+196, 196, 196, 196, 196, 196, 217, 217, 217, 217, 217, 217, 236, 236, 236, 236, 236, 236, 250, 250, 250, 250, 250, 250,
+250, 250, 250, 250, 250, 250, 236, 236, 236, 236, 236, 236, 217, 217, 217, 217, 217, 217, 196, 196, 196, 196, 196, 196,
+204, 204, 204, 204, 204, 204, 228, 228, 228, 228, 228, 228,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+220, 220, 220, 220, 220, 220, 204, 204, 204, 204, 204, 204, 191, 191, 191, 191, 191, 191, 182, 182, 182, 182, 182, 182,
+182, 182, 182, 182, 182, 182, 191, 191, 191, 191, 191, 191, 204, 204, 204, 204, 204, 204, 220, 220, 220, 220, 220, 220,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+220, 220, 220, 220, 220, 220, 204, 204, 204, 204, 204, 204, 191, 191, 191, 191, 191, 191, 182, 182, 182, 182, 182, 182,
+182, 182, 182, 182, 182, 182, 191, 191, 191, 191, 191, 191, 204, 204, 204, 204, 204, 204, 220, 220, 220, 220, 220, 220,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
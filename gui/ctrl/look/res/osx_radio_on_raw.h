@@ -0,0 +1,167 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info osx_radio_on_1x_info(16, 16, 48, gui::pixel_format_t::RGB);
+static const unsigned char osx_radio_on_1x_pixels[] = {
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 178, 202, 240, 122, 170, 245,  81, 147, 250,  53, 131, 252,
+ 53, 131, 252,  81, 147, 250, 122, 170, 245, 178, 202, 240,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 210, 220, 238, 122, 169, 244,  54, 131, 252,  52, 132, 253,  56, 134, 253,  57, 135, 253,
+ 57, 135, 253,  56, 134, 253,  52, 132, 253,  54, 131, 252, 122, 169, 244, 210, 220, 238,   0,   0,   0,   0,   0,   0,
+  0,   0,   0, 210, 220, 238, 106, 160, 247,  50, 131, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  50, 131, 253, 106, 160, 247, 210, 220, 238,   0,   0,   0,
+  0,   0,   0, 122, 169, 244,  50, 131, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  50, 131, 253, 122, 169, 244,   0,   0,   0,
+178, 202, 240,  54, 131, 252,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,  55, 132, 249,
+ 55, 132, 249,  57, 134, 251,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  54, 131, 252, 178, 202, 240,
+122, 170, 245,  52, 132, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  55, 132, 249, 106, 161, 245, 189, 213, 248,
+184, 210, 248, 108, 163, 245,  55, 132, 249,  59, 136, 253,  59, 136, 253,  59, 136, 253,  52, 132, 253, 122, 170, 245,
+ 81, 147, 250,  56, 134, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251, 104, 160, 245, 254, 254, 255, 255, 255, 255,
+255, 255, 255, 254, 254, 255, 104, 160, 245,  57, 134, 251,  59, 136, 253,  59, 136, 253,  56, 134, 253,  81, 147, 250,
+ 53, 131, 252,  57, 135, 253,  59, 136, 253,  59, 136, 253,  55, 132, 249, 181, 207, 245, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 187, 211, 246,  55, 132, 249,  59, 136, 253,  59, 136, 253,  57, 135, 253,  53, 131, 252,
+ 53, 131, 252,  57, 135, 253,  59, 136, 253,  59, 136, 253,  55, 132, 249, 176, 202, 240, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 182, 206, 241,  55, 132, 249,  59, 136, 253,  59, 136, 253,  57, 135, 253,  53, 131, 252,
+ 81, 147, 250,  56, 134, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,  85, 142, 227, 254, 254, 255, 255, 255, 255,
+255, 255, 255, 254, 254, 255,  86, 141, 226,  57, 134, 251,  59, 136, 253,  59, 136, 253,  56, 134, 253,  81, 147, 250,
+122, 170, 245,  52, 132, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  44, 122, 239,  78, 134, 218, 178, 202, 237,
+172, 198, 236,  80, 136, 219,  44, 122, 239,  59, 136, 253,  59, 136, 253,  59, 136, 253,  52, 132, 253, 122, 170, 245,
+178, 202, 240,  54, 131, 252,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  47, 123, 240,  29, 106, 223,
+ 30, 107, 224,  47, 123, 240,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  54, 131, 252, 178, 202, 240,
+  0,   0,   0, 122, 169, 244,  50, 131, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  50, 131, 253, 122, 169, 244,   0,   0,   0,
+  0,   0,   0, 210, 220, 238, 106, 160, 247,  50, 131, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  50, 131, 253, 106, 160, 247, 210, 220, 238,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 210, 220, 238, 122, 169, 244,  54, 131, 252,  52, 132, 253,  56, 134, 253,  57, 135, 253,
+ 57, 135, 253,  56, 134, 253,  52, 132, 253,  54, 131, 252, 122, 169, 244, 210, 220, 238,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 178, 202, 240, 122, 170, 245,  81, 147, 250,  53, 131, 252,
+ 53, 131, 252,  81, 147, 250, 122, 170, 245, 178, 202, 240,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
+static const gui::draw::bitmap_info osx_radio_on_2x_info(32, 32, 96, gui::pixel_format_t::RGB);
+static const unsigned char osx_radio_on_2x_pixels[] = {
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+178, 202, 240, 178, 202, 240, 122, 170, 245, 122, 170, 245,  81, 147, 250,  81, 147, 250,  53, 131, 252,  53, 131, 252,
+ 53, 131, 252,  53, 131, 252,  81, 147, 250,  81, 147, 250, 122, 170, 245, 122, 170, 245, 178, 202, 240, 178, 202, 240,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+178, 202, 240, 178, 202, 240, 122, 170, 245, 122, 170, 245,  81, 147, 250,  81, 147, 250,  53, 131, 252,  53, 131, 252,
+ 53, 131, 252,  53, 131, 252,  81, 147, 250,  81, 147, 250, 122, 170, 245, 122, 170, 245, 178, 202, 240, 178, 202, 240,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 210, 220, 238, 210, 220, 238, 122, 169, 244, 122, 169, 244,
+ 54, 131, 252,  54, 131, 252,  52, 132, 253,  52, 132, 253,  56, 134, 253,  56, 134, 253,  57, 135, 253,  57, 135, 253,
+ 57, 135, 253,  57, 135, 253,  56, 134, 253,  56, 134, 253,  52, 132, 253,  52, 132, 253,  54, 131, 252,  54, 131, 252,
+122, 169, 244, 122, 169, 244, 210, 220, 238, 210, 220, 238,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 210, 220, 238, 210, 220, 238, 122, 169, 244, 122, 169, 244,
+ 54, 131, 252,  54, 131, 252,  52, 132, 253,  52, 132, 253,  56, 134, 253,  56, 134, 253,  57, 135, 253,  57, 135, 253,
+ 57, 135, 253,  57, 135, 253,  56, 134, 253,  56, 134, 253,  52, 132, 253,  52, 132, 253,  54, 131, 252,  54, 131, 252,
+122, 169, 244, 122, 169, 244, 210, 220, 238, 210, 220, 238,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 210, 220, 238, 210, 220, 238, 106, 160, 247, 106, 160, 247,  50, 131, 253,  50, 131, 253,
+ 57, 135, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  57, 135, 253,
+ 50, 131, 253,  50, 131, 253, 106, 160, 247, 106, 160, 247, 210, 220, 238, 210, 220, 238,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 210, 220, 238, 210, 220, 238, 106, 160, 247, 106, 160, 247,  50, 131, 253,  50, 131, 253,
+ 57, 135, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  57, 135, 253,
+ 50, 131, 253,  50, 131, 253, 106, 160, 247, 106, 160, 247, 210, 220, 238, 210, 220, 238,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 122, 169, 244, 122, 169, 244,  50, 131, 253,  50, 131, 253,  57, 135, 253,  57, 135, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 57, 135, 253,  57, 135, 253,  50, 131, 253,  50, 131, 253, 122, 169, 244, 122, 169, 244,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 122, 169, 244, 122, 169, 244,  50, 131, 253,  50, 131, 253,  57, 135, 253,  57, 135, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 57, 135, 253,  57, 135, 253,  50, 131, 253,  50, 131, 253, 122, 169, 244, 122, 169, 244,   0,   0,   0,   0,   0,   0,
+178, 202, 240, 178, 202, 240,  54, 131, 252,  54, 131, 252,  57, 135, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,  57, 134, 251,  55, 132, 249,  55, 132, 249,
+ 55, 132, 249,  55, 132, 249,  57, 134, 251,  57, 134, 251,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  57, 135, 253,  57, 135, 253,  54, 131, 252,  54, 131, 252, 178, 202, 240, 178, 202, 240,
+178, 202, 240, 178, 202, 240,  54, 131, 252,  54, 131, 252,  57, 135, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 134, 251,  57, 134, 251,  55, 132, 249,  55, 132, 249,
+ 55, 132, 249,  55, 132, 249,  57, 134, 251,  57, 134, 251,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  57, 135, 253,  57, 135, 253,  54, 131, 252,  54, 131, 252, 178, 202, 240, 178, 202, 240,
+122, 170, 245, 122, 170, 245,  52, 132, 253,  52, 132, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  55, 132, 249,  55, 132, 249, 106, 161, 245, 106, 161, 245, 189, 213, 248, 189, 213, 248,
+184, 210, 248, 184, 210, 248, 108, 163, 245, 108, 163, 245,  55, 132, 249,  55, 132, 249,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  52, 132, 253,  52, 132, 253, 122, 170, 245, 122, 170, 245,
+122, 170, 245, 122, 170, 245,  52, 132, 253,  52, 132, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  55, 132, 249,  55, 132, 249, 106, 161, 245, 106, 161, 245, 189, 213, 248, 189, 213, 248,
+184, 210, 248, 184, 210, 248, 108, 163, 245, 108, 163, 245,  55, 132, 249,  55, 132, 249,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  52, 132, 253,  52, 132, 253, 122, 170, 245, 122, 170, 245,
+ 81, 147, 250,  81, 147, 250,  56, 134, 253,  56, 134, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 57, 134, 251,  57, 134, 251, 104, 160, 245, 104, 160, 245, 254, 254, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 254, 254, 255, 254, 254, 255, 104, 160, 245, 104, 160, 245,  57, 134, 251,  57, 134, 251,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  56, 134, 253,  56, 134, 253,  81, 147, 250,  81, 147, 250,
+ 81, 147, 250,  81, 147, 250,  56, 134, 253,  56, 134, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 57, 134, 251,  57, 134, 251, 104, 160, 245, 104, 160, 245, 254, 254, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 254, 254, 255, 254, 254, 255, 104, 160, 245, 104, 160, 245,  57, 134, 251,  57, 134, 251,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  56, 134, 253,  56, 134, 253,  81, 147, 250,  81, 147, 250,
+ 53, 131, 252,  53, 131, 252,  57, 135, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 55, 132, 249,  55, 132, 249, 181, 207, 245, 181, 207, 245, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 187, 211, 246, 187, 211, 246,  55, 132, 249,  55, 132, 249,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  57, 135, 253,  53, 131, 252,  53, 131, 252,
+ 53, 131, 252,  53, 131, 252,  57, 135, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 55, 132, 249,  55, 132, 249, 181, 207, 245, 181, 207, 245, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 187, 211, 246, 187, 211, 246,  55, 132, 249,  55, 132, 249,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  57, 135, 253,  53, 131, 252,  53, 131, 252,
+ 53, 131, 252,  53, 131, 252,  57, 135, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 55, 132, 249,  55, 132, 249, 176, 202, 240, 176, 202, 240, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 182, 206, 241, 182, 206, 241,  55, 132, 249,  55, 132, 249,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  57, 135, 253,  53, 131, 252,  53, 131, 252,
+ 53, 131, 252,  53, 131, 252,  57, 135, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 55, 132, 249,  55, 132, 249, 176, 202, 240, 176, 202, 240, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 182, 206, 241, 182, 206, 241,  55, 132, 249,  55, 132, 249,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  57, 135, 253,  53, 131, 252,  53, 131, 252,
+ 81, 147, 250,  81, 147, 250,  56, 134, 253,  56, 134, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 57, 134, 251,  57, 134, 251,  85, 142, 227,  85, 142, 227, 254, 254, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 254, 254, 255, 254, 254, 255,  86, 141, 226,  86, 141, 226,  57, 134, 251,  57, 134, 251,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  56, 134, 253,  56, 134, 253,  81, 147, 250,  81, 147, 250,
+ 81, 147, 250,  81, 147, 250,  56, 134, 253,  56, 134, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 57, 134, 251,  57, 134, 251,  85, 142, 227,  85, 142, 227, 254, 254, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255,
+255, 255, 255, 255, 255, 255, 254, 254, 255, 254, 254, 255,  86, 141, 226,  86, 141, 226,  57, 134, 251,  57, 134, 251,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  56, 134, 253,  56, 134, 253,  81, 147, 250,  81, 147, 250,
+122, 170, 245, 122, 170, 245,  52, 132, 253,  52, 132, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  44, 122, 239,  44, 122, 239,  78, 134, 218,  78, 134, 218, 178, 202, 237, 178, 202, 237,
+172, 198, 236, 172, 198, 236,  80, 136, 219,  80, 136, 219,  44, 122, 239,  44, 122, 239,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  52, 132, 253,  52, 132, 253, 122, 170, 245, 122, 170, 245,
+122, 170, 245, 122, 170, 245,  52, 132, 253,  52, 132, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  44, 122, 239,  44, 122, 239,  78, 134, 218,  78, 134, 218, 178, 202, 237, 178, 202, 237,
+172, 198, 236, 172, 198, 236,  80, 136, 219,  80, 136, 219,  44, 122, 239,  44, 122, 239,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  52, 132, 253,  52, 132, 253, 122, 170, 245, 122, 170, 245,
+178, 202, 240, 178, 202, 240,  54, 131, 252,  54, 131, 252,  57, 135, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  47, 123, 240,  47, 123, 240,  29, 106, 223,  29, 106, 223,
+ 30, 107, 224,  30, 107, 224,  47, 123, 240,  47, 123, 240,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  57, 135, 253,  57, 135, 253,  54, 131, 252,  54, 131, 252, 178, 202, 240, 178, 202, 240,
+178, 202, 240, 178, 202, 240,  54, 131, 252,  54, 131, 252,  57, 135, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  47, 123, 240,  47, 123, 240,  29, 106, 223,  29, 106, 223,
+ 30, 107, 224,  30, 107, 224,  47, 123, 240,  47, 123, 240,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  57, 135, 253,  57, 135, 253,  54, 131, 252,  54, 131, 252, 178, 202, 240, 178, 202, 240,
+  0,   0,   0,   0,   0,   0, 122, 169, 244, 122, 169, 244,  50, 131, 253,  50, 131, 253,  57, 135, 253,  57, 135, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 57, 135, 253,  57, 135, 253,  50, 131, 253,  50, 131, 253, 122, 169, 244, 122, 169, 244,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 122, 169, 244, 122, 169, 244,  50, 131, 253,  50, 131, 253,  57, 135, 253,  57, 135, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 57, 135, 253,  57, 135, 253,  50, 131, 253,  50, 131, 253, 122, 169, 244, 122, 169, 244,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 210, 220, 238, 210, 220, 238, 106, 160, 247, 106, 160, 247,  50, 131, 253,  50, 131, 253,
+ 57, 135, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  57, 135, 253,
+ 50, 131, 253,  50, 131, 253, 106, 160, 247, 106, 160, 247, 210, 220, 238, 210, 220, 238,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0, 210, 220, 238, 210, 220, 238, 106, 160, 247, 106, 160, 247,  50, 131, 253,  50, 131, 253,
+ 57, 135, 253,  57, 135, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,
+ 59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  59, 136, 253,  57, 135, 253,  57, 135, 253,
+ 50, 131, 253,  50, 131, 253, 106, 160, 247, 106, 160, 247, 210, 220, 238, 210, 220, 238,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 210, 220, 238, 210, 220, 238, 122, 169, 244, 122, 169, 244,
+ 54, 131, 252,  54, 131, 252,  52, 132, 253,  52, 132, 253,  56, 134, 253,  56, 134, 253,  57, 135, 253,  57, 135, 253,
+ 57, 135, 253,  57, 135, 253,  56, 134, 253,  56, 134, 253,  52, 132, 253,  52, 132, 253,  54, 131, 252,  54, 131, 252,
+122, 169, 244, 122, 169, 244, 210, 220, 238, 210, 220, 238,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 210, 220, 238, 210, 220, 238, 122, 169, 244, 122, 169, 244,
+ 54, 131, 252,  54, 131, 252,  52, 132, 253,  52, 132, 253,  56, 134, 253,  56, 134, 253,  57, 135, 253,  57, 135, 253,
+ 57, 135, 253,  57, 135, 253,  56, 134, 253,  56, 134, 253,  52, 132, 253,  52, 132, 253,  54, 131, 252,  54, 131, 252,
+122, 169, 244, 122, 169, 244, 210, 220, 238, 210, 220, 238,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+178, 202, 240, 178, 202, 240, 122, 170, 245, 122, 170, 245,  81, 147, 250,  81, 147, 250,  53, 131, 252,  53, 131, 252,
+ 53, 131, 252,  53, 131, 252,  81, 147, 250,  81, 147, 250, 122, 170, 245, 122, 170, 245, 178, 202, 240, 178, 202, 240,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+178, 202, 240, 178, 202, 240, 122, 170, 245, 122, 170, 245,  81, 147, 250,  81, 147, 250,  53, 131, 252,  53, 131, 252,
+ 53, 131, 252,  53, 131, 252,  81, 147, 250,  81, 147, 250, 122, 170, 245, 122, 170, 245, 178, 202, 240, 178, 202, 240,
+  0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0
+};
@@ -0,0 +1,31 @@
+// generated by pnm2src, do not edit.
+static const gui::draw::bitmap_info simple_frame_1x_info(7, 27, 21, gui::pixel_format_t::RGB);
+static const unsigned char simple_frame_1x_pixels[] = {
+214, 214, 214, 203, 203, 203, 186, 186, 186, 179, 179, 179, 186, 186, 186, 203, 203, 203, 214, 214, 214,
+202, 202, 202, 190, 190, 190, 247, 247, 247, 254, 254, 254, 247, 247, 247, 191, 191, 191, 202, 202, 202,
+182, 182, 182, 244, 244, 244, 248, 248, 248, 243, 243, 243, 248, 248, 248, 244, 244, 244, 182, 182, 182,
+170, 170, 170, 252, 252, 252, 240, 240, 240, 240, 240, 240, 240, 240, 240, 252, 252, 252, 170, 170, 170,
+169, 169, 169, 251, 251, 251, 239, 239, 239, 239, 239, 239, 239, 239, 239, 251, 251, 251, 169, 169, 169,
+168, 168, 168, 251, 251, 251, 238, 238, 238, 238, 238, 238, 238, 238, 238, 251, 251, 251, 168, 168, 168,
+166, 166, 166, 250, 250, 250, 237, 237, 237, 237, 237, 237, 237, 237, 237, 250, 250, 250, 166, 166, 166,
+165, 165, 165, 249, 249, 249, 236, 236, 236, 236, 236, 236, 236, 236, 236, 249, 249, 249, 165, 165, 165,
+164, 164, 164, 248, 248, 248, 235, 235, 235, 235, 235, 235, 235, 235, 235, 248, 248, 248, 164, 164, 164,
+163, 163, 163, 248, 248, 248, 234, 234, 234, 234, 234, 234, 234, 234, 234, 248, 248, 248, 163, 163, 163,
+162, 162, 162, 247, 247, 247, 233, 233, 233, 233, 233, 233, 233, 233, 233, 247, 247, 247, 162, 162, 162,
+160, 160, 160, 245, 245, 245, 231, 231, 231, 231, 231, 231, 231, 231, 231, 245, 245, 245, 160, 160, 160,
+159, 159, 159, 244, 244, 244, 230, 230, 230, 230, 230, 230, 230, 230, 230, 244, 244, 244, 159, 159, 159,
+159, 159, 159, 243, 243, 243, 229, 229, 229, 229, 229, 229, 229, 229, 229, 243, 243, 243, 159, 159, 159,
+158, 158, 158, 241, 241, 241, 227, 227, 227, 227, 227, 227, 227, 227, 227, 241, 241, 241, 158, 158, 158,
+157, 157, 157, 240, 240, 240, 226, 226, 226, 226, 226, 226, 226, 226, 226, 240, 240, 240, 157, 157, 157,
+156, 156, 156, 239, 239, 239, 225, 225, 225, 225, 225, 225, 225, 225, 225, 239, 239, 239, 156, 156, 156,
+155, 155, 155, 238, 238, 238, 224, 224, 224, 224, 224, 224, 224, 224, 224, 238, 238, 238, 155, 155, 155,
+153, 153, 153, 236, 236, 236, 222, 222, 222, 222, 222, 222, 222, 222, 222, 236, 236, 236, 153, 153, 153,
+152, 152, 152, 234, 234, 234, 221, 221, 221, 221, 221, 221, 221, 221, 221, 234, 234, 234, 152, 152, 152,
+151, 151, 151, 232, 232, 232, 220, 220, 220, 220, 220, 220, 220, 220, 220, 232, 232, 232, 151, 151, 151,
+151, 151, 151, 230, 230, 230, 219, 219, 219, 219, 219, 219, 219, 219, 219, 230, 230, 230, 151, 151, 151,
+150, 150, 150, 228, 228, 228, 218, 218, 218, 218, 218, 218, 218, 218, 218, 227, 227, 227, 150, 150, 150,
+150, 150, 150, 228, 228, 228, 218, 218, 218, 218, 218, 218, 218, 218, 218, 227, 227, 227, 150, 150, 150,
+160, 160, 160, 206, 206, 206, 219, 219, 219, 219, 219, 219, 219, 219, 219, 206, 206, 206, 160, 160, 160,
+183, 183, 183, 154, 154, 154, 200, 200, 200, 216, 216, 216, 200, 200, 200, 154, 154, 154, 182, 182, 182,
+194, 194, 194, 180, 180, 180, 156, 156, 156, 143, 143, 143, 156, 156, 156, 179, 179, 179, 195, 195, 195
+};
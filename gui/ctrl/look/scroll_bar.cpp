@@ -25,6 +25,7 @@
 #include "gui/draw/brush.h"
 #include "gui/draw/font.h"
 #include "gui/draw/icons.h"
+#include "gui/draw/icon_cache.h"
 #include "gui/ctrl/look/scroll_bar.h"
 #include "gui/ctrl/look/button.h"
 
@@ -37,17 +38,17 @@ namespace gui {
 
       void draw_up_left_arrow (draw::graphics& g, bool horizontal, const core::rectangle& up, os::color col) {
         if (horizontal) {
-          g.frame(draw::icon_t<draw::icon_type::left>(up.center(), up.max_radius() / 2), col);
+          g.frame(draw::cached_icon_t<draw::icon_type::left>(up.center(), up.max_radius() / 2), col);
         } else {
-          g.frame(draw::icon_t<draw::icon_type::up>(up.center(), up.max_radius() / 2), col);
+          g.frame(draw::cached_icon_t<draw::icon_type::up>(up.center(), up.max_radius() / 2), col);
         }
       }
 
       void draw_down_right_arrow (draw::graphics& g, bool horizontal, const core::rectangle& up, os::color col) {
         if (horizontal) {
-          g.frame(draw::icon_t<draw::icon_type::right>(up.center(), up.max_radius() / 2), col);
+          g.frame(draw::cached_icon_t<draw::icon_type::right>(up.center(), up.max_radius() / 2), col);
         } else {
-          g.frame(draw::icon_t<draw::icon_type::down>(up.center(), up.max_radius() / 2), col);
+          g.frame(draw::cached_icon_t<draw::icon_type::down>(up.center(), up.max_radius() / 2), col);
         }
       }
 
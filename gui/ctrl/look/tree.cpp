@@ -24,6 +24,7 @@
 #include "gui/draw/pen.h"
 #include "gui/draw/font.h"
 #include "gui/draw/icons.h"
+#include "gui/draw/icon_cache.h"
 #include "gui/io/pnm.h"
 #include "gui/ctrl/look/control.h"
 #include "gui/ctrl/look/tree.h"
@@ -53,9 +54,9 @@ namespace gui {
                       const draw::pen& pn) {
       const auto radius = area.max_radius()/ 2;
       if (is_open) {
-        graph.frame(draw::icon_t<draw::icon_type::down>(area.center(), radius), pn);
+        graph.frame(draw::cached_icon_t<draw::icon_type::down>(area.center(), radius), pn);
       } else {
-        graph.frame(draw::icon_t<draw::icon_type::right>(area.center(), radius), pn);
+        graph.frame(draw::cached_icon_t<draw::icon_type::right>(area.center(), radius), pn);
       }
     }
 
@@ -0,0 +1,193 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     list data fetched in pages from a slow store
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include "gui/ctrl/list.h"
+#include "gui/ctrl/column_list.h"
+#include "gui/ctrl/table.h"
+#include "gui/ctrl/worker_pool.h"
+#include "gui/win/window_event_proc.h"
+
+
+namespace gui {
+
+  namespace ctrl {
+
+    // --------------------------------------------------------------------------
+    /**
+     * Rows of a slow store, e.g. a large file or a database, fetched in pages
+     * of page_rows rows on the worker pool.
+     * get() returns nullptr for a row whose page is not loaded yet and requests
+     * the page. Loaded pages arrive on the main thread and the target window is
+     * redrawn. The pages next to the requested one in scroll direction are
+     * prefetched, the least recently used pages are dropped above max_pages.
+     * fetch is called on worker threads, a page whose fetch throws is logged
+     * and requested again on the next get().
+     */
+    template<typename T>
+    class paged_data_source {
+    public:
+      typedef std::vector<T> page_type;
+      typedef page_type (fetch_fn) (std::size_t first, std::size_t count);
+
+      static constexpr std::size_t default_page_rows = 256;
+      static constexpr std::size_t default_max_pages = 64;
+      static constexpr std::size_t prefetch_pages = 2;
+
+      explicit paged_data_source (std::function<fetch_fn> fetch,
+                                  std::size_t page_rows = default_page_rows,
+                                  std::size_t max_pages = default_max_pages);
+      ~paged_data_source ();
+
+      paged_data_source (const paged_data_source&) = delete;
+      paged_data_source& operator= (const paged_data_source&) = delete;
+
+      /// Loaded pages redraw target. Only used on the main thread, reset it
+      /// before target is destroyed.
+      void set_target (const win::window* target);
+
+      /// Growing keeps all pages but the last one, shrinking drops all pages.
+      void set_size (std::size_t);
+      std::size_t size () const;
+
+      /// Main thread only.
+      const T* get (std::size_t row) const;
+
+      /// Drops all pages and pending fetches, e.g. after the store changed.
+      void clear ();
+
+      std::size_t loaded_pages () const;
+
+    private:
+      struct state {
+        std::mutex guard;
+        std::atomic_bool alive;
+
+        state ()
+          : alive(true)
+        {}
+      };
+
+      struct page {
+        page_type rows;
+        std::list<std::size_t>::iterator lru;
+      };
+
+      void request (std::size_t page, bool prefetch) const;
+      void loaded (std::size_t page, std::size_t n, page_type&& rows) const;
+      void failed (std::size_t page) const;
+      void drop_from (std::size_t page);
+      void cancel ();
+
+      std::size_t rows_of (std::size_t page) const;
+
+      std::function<fetch_fn> fetch;
+      const std::size_t page_rows;
+      const std::size_t max_pages;
+      std::size_t count;
+      const win::window* target;
+
+      mutable std::unordered_map<std::size_t, page> pages;
+      // most recently used page first.
+      mutable std::list<std::size_t> lru;
+      mutable std::set<std::size_t> pending;
+      mutable std::size_t last_page;
+      std::shared_ptr<state> current;
+    };
+
+    // --------------------------------------------------------------------------
+    void draw_pending_row (draw::graphics&,
+                           const core::rectangle& place,
+                           const draw::brush& background,
+                           item_state state);
+
+    // --------------------------------------------------------------------------
+    template<typename T, list_item_drawer<T> D = default_list_item_drawer<T>>
+    struct paged_list_data : public list_data {
+      explicit paged_list_data (const paged_data_source<T>& source);
+
+      std::size_t size () const override;
+
+      void draw_at (std::size_t idx,
+                    draw::graphics& g,
+                    const core::rectangle& place,
+                    const draw::brush& background,
+                    item_state state) const override;
+
+    private:
+      const paged_data_source<T>& source;
+    };
+
+    // --------------------------------------------------------------------------
+    template<typename ... Arguments>
+    struct paged_column_list_data : public column_list_data_t<Arguments...> {
+      typedef column_list_data_t<Arguments...> super;
+      typedef typename super::row_type row_type;
+      typedef typename super::drawer_type drawer_type;
+      typedef paged_data_source<row_type> source_type;
+
+      explicit paged_column_list_data (const source_type& source);
+      paged_column_list_data (const source_type& source, drawer_type&& drwr);
+
+      std::size_t size () const override;
+
+      /// A default row while the page is loading.
+      row_type at (std::size_t idx) const override;
+      const row_type* get_row (std::size_t idx) const override;
+
+      void draw_at (std::size_t idx,
+                    draw::graphics& g,
+                    const core::rectangle& place,
+                    const draw::brush& background,
+                    item_state state) const override;
+
+    private:
+      const source_type& source;
+    };
+
+    namespace table {
+
+      // --------------------------------------------------------------------------
+      /// Table data source showing the rows of source, cells of loading rows are empty.
+      template<typename T>
+      std::function<data_source> paged_data (const paged_data_source<T>& source,
+                                             std::function<std::string(const T&, int column)> cell);
+
+    } // namespace table
+
+  } // namespace ctrl
+
+} // namespace gui
+
+#include "gui/ctrl/paged_data.inl"
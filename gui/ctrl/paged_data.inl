@@ -0,0 +1,294 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     list data fetched in pages from a slow store
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <algorithm>
+#include <logging/logger.h>
+
+
+namespace gui {
+
+  namespace ctrl {
+
+    // --------------------------------------------------------------------------
+    template<typename T>
+    paged_data_source<T>::paged_data_source (std::function<fetch_fn> fetch,
+                                             std::size_t page_rows,
+                                             std::size_t max_pages)
+      : fetch(std::move(fetch))
+      , page_rows(std::max<std::size_t>(page_rows, 1))
+      , max_pages(std::max<std::size_t>(max_pages, 1))
+      , count(0)
+      , target(nullptr)
+      , last_page(0)
+      , current(std::make_shared<state>())
+    {}
+
+    template<typename T>
+    paged_data_source<T>::~paged_data_source () {
+      cancel();
+    }
+
+    template<typename T>
+    void paged_data_source<T>::set_target (const win::window* t) {
+      target = t;
+    }
+
+    template<typename T>
+    void paged_data_source<T>::set_size (std::size_t sz) {
+      if (sz < count) {
+        // rows may have been removed anywhere.
+        clear();
+      } else if (sz > count) {
+        // only the old last page gets more rows.
+        drop_from(count / page_rows);
+      }
+      count = sz;
+    }
+
+    template<typename T>
+    std::size_t paged_data_source<T>::size () const {
+      return count;
+    }
+
+    template<typename T>
+    const T* paged_data_source<T>::get (std::size_t row) const {
+      if (row >= count) {
+        return nullptr;
+      }
+      const std::size_t p = row / page_rows;
+      if (p != last_page) {
+        // prefetch ahead in scroll direction.
+        const bool down = p > last_page;
+        last_page = p;
+        for (std::size_t i = 1; i <= prefetch_pages; ++i) {
+          if (down) {
+            request(p + i, true);
+          } else if (p >= i) {
+            request(p - i, true);
+          }
+        }
+      }
+      auto i = pages.find(p);
+      if (i == pages.end()) {
+        request(p, false);
+        return nullptr;
+      }
+      page& pg = i->second;
+      lru.splice(lru.begin(), lru, pg.lru);
+      const std::size_t offset = row - p * page_rows;
+      return offset < pg.rows.size() ? &pg.rows[offset] : nullptr;
+    }
+
+    template<typename T>
+    void paged_data_source<T>::clear () {
+      cancel();
+      current = std::make_shared<state>();
+      pages.clear();
+      lru.clear();
+      pending.clear();
+    }
+
+    template<typename T>
+    std::size_t paged_data_source<T>::loaded_pages () const {
+      return pages.size();
+    }
+
+    template<typename T>
+    void paged_data_source<T>::request (std::size_t p, bool prefetch) const {
+      const std::size_t n = rows_of(p);
+      if (!fetch || (n == 0) || (pages.find(p) != pages.end()) || !pending.insert(p).second) {
+        return;
+      }
+      const std::size_t first = p * page_rows;
+      auto s = current;
+      auto f = fetch;
+      // posted without the target, it may be gone when the fetch returns.
+      worker_pool::get().push([&, s, f, p, first, n] () {
+        if (!s->alive) {
+          return;
+        }
+        std::shared_ptr<page_type> rows;
+        try {
+          rows = std::make_shared<page_type>(f(first, n));
+        } catch (std::exception& ex) {
+          logging::error() << "fetch of rows " << first << " to " << (first + n) << " failed: " << ex;
+        } catch (...) {
+          logging::error() << "fetch of rows " << first << " to " << (first + n) << " failed";
+        }
+        std::lock_guard<std::mutex> lock(s->guard);
+        if (s->alive) {
+          win::run_on_main([&, s, p, n, rows] () {
+            if (s->alive) {
+              if (rows) {
+                loaded(p, n, std::move(*rows));
+              } else {
+                failed(p);
+              }
+            }
+          });
+        }
+      }, prefetch);
+    }
+
+    template<typename T>
+    void paged_data_source<T>::loaded (std::size_t p, std::size_t n, page_type&& rows) const {
+      pending.erase(p);
+      if (n != rows_of(p)) {
+        // the size changed while the page was fetched.
+        request(p, false);
+        return;
+      }
+      lru.push_front(p);
+      pages[p] = page{std::move(rows), lru.begin()};
+      while (pages.size() > max_pages) {
+        pages.erase(lru.back());
+        lru.pop_back();
+      }
+      if (target) {
+        target->invalidate();
+      }
+    }
+
+    template<typename T>
+    void paged_data_source<T>::failed (std::size_t p) const {
+      // the next get() of a row in this page tries again.
+      pending.erase(p);
+    }
+
+    template<typename T>
+    void paged_data_source<T>::drop_from (std::size_t p) {
+      for (auto i = lru.begin(); i != lru.end();) {
+        if (*i >= p) {
+          pages.erase(*i);
+          i = lru.erase(i);
+        } else {
+          ++i;
+        }
+      }
+    }
+
+    template<typename T>
+    std::size_t paged_data_source<T>::rows_of (std::size_t p) const {
+      const std::size_t first = p * page_rows;
+      return first < count ? std::min(page_rows, count - first) : 0;
+    }
+
+    template<typename T>
+    void paged_data_source<T>::cancel () {
+      std::lock_guard<std::mutex> lock(current->guard);
+      current->alive = false;
+    }
+
+    // --------------------------------------------------------------------------
+    inline void draw_pending_row (draw::graphics& g,
+                                  const core::rectangle& place,
+                                  const draw::brush& background,
+                                  item_state state) {
+      look::text_item(g, place, background, "...", state, text_origin_t::vcenter_left);
+    }
+
+    // --------------------------------------------------------------------------
+    template<typename T, list_item_drawer<T> D>
+    paged_list_data<T, D>::paged_list_data (const paged_data_source<T>& source)
+      : source(source)
+    {}
+
+    template<typename T, list_item_drawer<T> D>
+    std::size_t paged_list_data<T, D>::size () const {
+      return source.size();
+    }
+
+    template<typename T, list_item_drawer<T> D>
+    void paged_list_data<T, D>::draw_at (std::size_t idx,
+                                         draw::graphics& g,
+                                         const core::rectangle& place,
+                                         const draw::brush& background,
+                                         item_state state) const {
+      if (const T* t = source.get(idx)) {
+        D(*t, g, place, background, state);
+      } else {
+        draw_pending_row(g, place, background, state);
+      }
+    }
+
+    // --------------------------------------------------------------------------
+    template<typename ... A>
+    paged_column_list_data<A...>::paged_column_list_data (const source_type& source)
+      : super(std::make_tuple(ctrl::cell_drawer<A>...))
+      , source(source)
+    {}
+
+    template<typename ... A>
+    paged_column_list_data<A...>::paged_column_list_data (const source_type& source, drawer_type&& drwr)
+      : super(std::move(drwr))
+      , source(source)
+    {}
+
+    template<typename ... A>
+    std::size_t paged_column_list_data<A...>::size () const {
+      return source.size();
+    }
+
+    template<typename ... A>
+    auto paged_column_list_data<A...>::at (std::size_t idx) const -> row_type {
+      const row_type* row = source.get(idx);
+      return row ? *row : row_type();
+    }
+
+    template<typename ... A>
+    auto paged_column_list_data<A...>::get_row (std::size_t idx) const -> const row_type* {
+      return source.get(idx);
+    }
+
+    template<typename ... A>
+    void paged_column_list_data<A...>::draw_at (std::size_t idx,
+                                                draw::graphics& g,
+                                                const core::rectangle& place,
+                                                const draw::brush& background,
+                                                item_state state) const {
+      if (source.get(idx)) {
+        super::draw_at(idx, g, place, background, state);
+      } else {
+        draw_pending_row(g, place, background, state);
+      }
+    }
+
+    namespace table {
+
+      // --------------------------------------------------------------------------
+      template<typename T>
+      std::function<data_source> paged_data (const paged_data_source<T>& source,
+                                             std::function<std::string(const T&, int column)> cell) {
+        return [&source, cell] (const position& pos) -> std::string {
+          if (pos.y() < 0) {
+            return std::string();
+          }
+          const T* row = source.get(static_cast<std::size_t>(pos.y()));
+          return row ? cell(*row, pos.x()) : std::string();
+        };
+      }
+
+    } // namespace table
+
+  } // namespace ctrl
+
+} // namespace gui
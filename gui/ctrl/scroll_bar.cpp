@@ -74,6 +74,14 @@ namespace gui {
         set_hilite(scrollbar_item::nothing);
         invalidate();
       });
+      on_left_btn_down([&] (os::key_state, const core::native_point&) {
+        scroller.stop();
+      });
+      scroller.set_scroll([&] (type d) {
+        const type v = get_value();
+        set_value(v + d, true);
+        return get_value() == v + d;
+      });
     }
 
     void scroll_bar::create (const win::class_info& type,
@@ -215,7 +223,7 @@ namespace gui {
     void scroll_bar::handle_wheel (const core::native_point::type delta, const core::native_point&) {
       if (is_enabled()) {
         logging::trace() << "scroll_bar::handle_wheel() delta: " << delta << " step: " << get_step();
-        set_value(get_value() + delta * get_step(), true);
+        scroller.move_by(delta * get_step());
       }
     }
 
@@ -21,6 +21,7 @@
 // Library includes
 //
 #include "gui/core/orientation_traits.h"
+#include "gui/win/animation.h"
 #include "gui/ctrl/control.h"
 #include "gui/ctrl/scrollbar_item.h"
 #include "gui/ctrl/look/scroll_bar.h"
@@ -115,6 +116,7 @@ namespace gui {
       void init ();
 
       scroll_bar_data data;
+      win::animation::kinetic scroller;
 
     };
 
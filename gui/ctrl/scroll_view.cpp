@@ -291,12 +291,17 @@ namespace gui {
       std::vector<window*> children = get_children();
       for (window* win : children) {
         if ((win != &vscroll) && (win != &hscroll) && (win != &edge)) {
-          win->position(win->position() - delta);
+          win->position(win->position() - delta, false);
         }
       }
       get_layout().set_last_scroll_pos(get_layout().get_last_scroll_pos() + delta);
       get_layout().set_in_scroll_event(false);
-      invalidate();
+
+      // copy the painted children, without the scroll bars.
+      core::rectangle client = client_geometry();
+      client.shrink(0, hscroll.is_visible() ? ctrl::scroll_bar::get_scroll_bar_width() : 0,
+                    0, vscroll.is_visible() ? ctrl::scroll_bar::get_scroll_bar_width() : 0);
+      scroll_content(client, -delta);
     }
 
     void scroll_view_base::set_scroll_pos (const core::point& pt) {
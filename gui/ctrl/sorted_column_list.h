@@ -20,6 +20,10 @@
 //
 // Common includes
 //
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
 #include <util/sort_order.h>
 
 // --------------------------------------------------------------------------
@@ -28,12 +32,100 @@
 //
 #include "gui/ctrl/column_list.h"
 #include "gui/ctrl/file_tree.h"
+#include "gui/ctrl/worker_pool.h"
 
 
 namespace gui {
 
   namespace ctrl {
 
+    // --------------------------------------------------------------------------
+    /**
+     * Sorted and filtered view of a column list data source.
+     * The view keeps only a permutation of the source row indices, rows are read
+     * from the source when they are drawn. The keys of sorted columns are cached,
+     * columns without operator< are not sorted.
+     * Filter and sort run on the worker pool, so the filter and the at() of the
+     * source must be callable from any thread while they run.
+     * After changing the source, call rows_appended() or refresh().
+     */
+    template<typename ... Arguments>
+    struct sorted_column_list_data : public column_list_data_t<Arguments...> {
+      typedef column_list_data_t<Arguments...> super;
+      typedef typename super::row_type row_type;
+      typedef typename super::drawer_type drawer_type;
+      typedef super source_type;
+      typedef bool (filter_fn) (const row_type&);
+
+      struct sort_key {
+        int column;
+        util::sort::order dir;
+      };
+      typedef std::vector<sort_key> sort_keys;
+
+      sorted_column_list_data ();
+      explicit sorted_column_list_data (drawer_type&& drwr);
+
+      void set_source (const source_type* source);
+      const source_type* get_source () const;
+
+      std::size_t size () const override;
+      row_type at (std::size_t idx) const override;
+      const row_type* get_row (std::size_t idx) const override;
+
+      /// Index in the source of the row idx of the view.
+      std::size_t source_index (std::size_t idx) const;
+
+      /// Rows without filter or for which the filter returns true are shown.
+      void set_filter (std::function<filter_fn> filter);
+
+      /// The first key sorts, the following keys decide on equal rows.
+      void sort (const sort_keys& keys);
+      const sort_keys& get_sort_keys () const;
+
+      /// Sorts the rows added to the end of the source into the view.
+      void rows_appended ();
+
+      /// Drops the cached keys and rebuilds the view from the source.
+      void refresh ();
+
+    private:
+      struct column_keys_base {
+        virtual ~column_keys_base () = default;
+        virtual void extract (const source_type& source, std::size_t first, std::size_t last) = 0;
+        virtual int compare (std::size_t lhs, std::size_t rhs) const = 0;
+      };
+
+      template<std::size_t I>
+      struct column_keys : public column_keys_base {
+        typedef typename std::decay<typename std::tuple_element<I, row_type>::type>::type key_type;
+
+        void extract (const source_type& source, std::size_t first, std::size_t last) override;
+        int compare (std::size_t lhs, std::size_t rhs) const override;
+
+        std::vector<key_type> keys;
+      };
+
+      template<std::size_t ... I>
+      static std::shared_ptr<column_keys_base> make_keys (int column, std::index_sequence<I...>);
+
+      template<std::size_t I>
+      static std::shared_ptr<column_keys_base> make_column_keys (std::true_type);
+      template<std::size_t I>
+      static std::shared_ptr<column_keys_base> make_column_keys (std::false_type);
+
+      std::vector<std::size_t> filtered (std::size_t first, std::size_t last) const;
+      void extract_keys ();
+      bool less (std::size_t lhs, std::size_t rhs) const;
+
+      const source_type* source;
+      std::function<filter_fn> filter;
+      sort_keys keys;
+      std::vector<std::size_t> order;
+      std::vector<std::shared_ptr<column_keys_base>> key_cache;
+      std::size_t known_rows;
+    };
+
     // --------------------------------------------------------------------------
     template<typename Layout, typename S = core::selector::single, typename ... Arguments>
     class sorted_column_list_t : public gui::ctrl::column_list_t<Layout, S, Arguments ...> {
@@ -41,6 +133,10 @@ namespace gui {
       typedef gui::ctrl::column_list_t<Layout, S, Arguments ...> super;
       typedef std::tuple<Arguments ...> data_t;
       typedef bool (sort_callback) (util::sort::order o, int column);
+      typedef sorted_column_list_data<Arguments ...> sorted_data;
+
+      /// Keys used by the built in sort, the last clicked column first.
+      static constexpr std::size_t max_sort_keys = 3;
 
       sorted_column_list_t (gui::core::size::type item_size = 20,
                             gui::os::color background = gui::color::white,
@@ -51,6 +147,9 @@ namespace gui {
       void on_sort (const std::function<sort_callback>& sorter);
       void sort ();
 
+      /// Shows the view and sorts it by the header, if no sorter is set.
+      void set_sorted_data (sorted_data& view);
+
       std::vector<std::string> header_label;
       std::function<sort_callback> sorter;
 
@@ -58,6 +157,9 @@ namespace gui {
       gui::core::point mouse_down_point;
       int sort_column;
       util::sort::order sort_dir;
+      // set by set_sorted_data only, lists without view need no sortable columns.
+      std::function<void(const typename sorted_data::sort_keys&)> sort_view;
+      typename sorted_data::sort_keys keys;
 
       void init ();
     };
@@ -16,10 +16,331 @@
 
 #pragma once
 
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <algorithm>
+#include <numeric>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <type_traits>
+
+
 namespace gui {
 
   namespace ctrl {
 
+    namespace detail {
+
+      // --------------------------------------------------------------------------
+      constexpr std::size_t min_parallel_rows = 8192;
+
+      inline std::size_t worker_count (std::size_t rows) {
+        // the pool threads and the caller.
+        const std::size_t threads = worker_pool::default_threads() + 1;
+        return std::max<std::size_t>(1, std::min(threads, rows / min_parallel_rows));
+      }
+
+      // --------------------------------------------------------------------------
+      template<typename T, typename = void>
+      struct is_less_comparable : std::false_type {};
+
+      template<typename T>
+      struct is_less_comparable<T, decltype(void(std::declval<const T&>() < std::declval<const T&>()))>
+        : std::true_type {};
+
+      // --------------------------------------------------------------------------
+      struct chunk_state {
+        std::atomic<std::size_t> next;
+        std::size_t done;
+        std::mutex guard;
+        std::condition_variable finished;
+        std::exception_ptr error;
+
+        chunk_state ()
+          : next(0)
+          , done(0)
+        {}
+      };
+
+      /**
+       * Calls fn(chunk, first, last) for consecutive chunks of [0, rows) on the
+       * worker pool. The caller runs chunks, too, and takes the chunks no worker
+       * has started, so it never waits for a busy pool.
+       */
+      template<typename F>
+      void parallel_chunks (std::size_t rows, std::size_t chunks, F fn) {
+        if (chunks < 2) {
+          fn(std::size_t(0), std::size_t(0), rows);
+          return;
+        }
+        auto s = std::make_shared<chunk_state>();
+        const std::size_t step = (rows + chunks - 1) / chunks;
+        // jobs started after the last chunk was taken do not touch fn.
+        auto work = [s, &fn, rows, chunks, step] () {
+          for (std::size_t c = s->next++; c < chunks; c = s->next++) {
+            std::exception_ptr ex;
+            try {
+              fn(c, std::min(rows, c * step), std::min(rows, (c + 1) * step));
+            } catch (...) {
+              ex = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(s->guard);
+            if (ex && !s->error) {
+              s->error = ex;
+            }
+            ++s->done;
+            s->finished.notify_all();
+          }
+        };
+        for (std::size_t c = 1; c < chunks; ++c) {
+          worker_pool::get().push(work);
+        }
+        work();
+        std::unique_lock<std::mutex> lock(s->guard);
+        s->finished.wait(lock, [&] () {
+          return s->done == chunks;
+        });
+        if (s->error) {
+          // thrown in the caller, after all chunks have finished.
+          std::rethrow_exception(s->error);
+        }
+      }
+
+      /// Stable sort of the chunks in parallel, followed by stable merges of the sorted chunks.
+      template<typename I, typename C>
+      void parallel_stable_sort (I first, I last, C comp) {
+        const std::size_t rows = std::distance(first, last);
+        const std::size_t chunks = worker_count(rows);
+        if (chunks < 2) {
+          std::stable_sort(first, last, comp);
+          return;
+        }
+        const std::size_t step = (rows + chunks - 1) / chunks;
+        parallel_chunks(rows, chunks, [&] (std::size_t, std::size_t b, std::size_t e) {
+          std::stable_sort(first + b, first + e, comp);
+        });
+        for (std::size_t width = step; width < rows; width *= 2) {
+          for (std::size_t b = 0; b + width < rows; b += 2 * width) {
+            std::inplace_merge(first + b, first + b + width, first + std::min(rows, b + 2 * width), comp);
+          }
+        }
+      }
+
+    } // namespace detail
+
+    // --------------------------------------------------------------------------
+    template<typename ... A>
+    sorted_column_list_data<A...>::sorted_column_list_data ()
+      : super(std::make_tuple(ctrl::cell_drawer<A>...))
+      , source(nullptr)
+      , known_rows(0)
+    {}
+
+    template<typename ... A>
+    sorted_column_list_data<A...>::sorted_column_list_data (drawer_type&& drwr)
+      : super(std::move(drwr))
+      , source(nullptr)
+      , known_rows(0)
+    {}
+
+    template<typename ... A>
+    void sorted_column_list_data<A...>::set_source (const source_type* s) {
+      source = s;
+      refresh();
+    }
+
+    template<typename ... A>
+    auto sorted_column_list_data<A...>::get_source () const -> const source_type* {
+      return source;
+    }
+
+    template<typename ... A>
+    std::size_t sorted_column_list_data<A...>::size () const {
+      return order.size();
+    }
+
+    template<typename ... A>
+    auto sorted_column_list_data<A...>::at (std::size_t idx) const -> row_type {
+      return source->at(order[idx]);
+    }
+
+    template<typename ... A>
+    auto sorted_column_list_data<A...>::get_row (std::size_t idx) const -> const row_type* {
+      return source->get_row(order[idx]);
+    }
+
+    template<typename ... A>
+    std::size_t sorted_column_list_data<A...>::source_index (std::size_t idx) const {
+      return order[idx];
+    }
+
+    template<typename ... A>
+    void sorted_column_list_data<A...>::set_filter (std::function<filter_fn> f) {
+      filter = std::move(f);
+      order = filtered(0, known_rows);
+      sort(keys);
+    }
+
+    template<typename ... A>
+    void sorted_column_list_data<A...>::sort (const sort_keys& k) {
+      keys = k;
+      extract_keys();
+      if (!keys.empty()) {
+        detail::parallel_stable_sort(order.begin(), order.end(), [&] (std::size_t lhs, std::size_t rhs) {
+          return less(lhs, rhs);
+        });
+      } else {
+        std::sort(order.begin(), order.end());
+      }
+    }
+
+    template<typename ... A>
+    auto sorted_column_list_data<A...>::get_sort_keys () const -> const sort_keys& {
+      return keys;
+    }
+
+    template<typename ... A>
+    void sorted_column_list_data<A...>::rows_appended () {
+      const std::size_t rows = source ? source->size() : 0;
+      if (rows < known_rows) {
+        refresh();
+        return;
+      }
+      const std::size_t first = known_rows;
+      known_rows = rows;
+      // the old rows keep their keys, only the new ones are extracted and sorted.
+      for (auto& c : key_cache) {
+        if (c) {
+          c->extract(*source, first, rows);
+        }
+      }
+      extract_keys();
+      auto added = filtered(first, rows);
+      const auto comp = [&] (std::size_t lhs, std::size_t rhs) {
+        return keys.empty() ? lhs < rhs : less(lhs, rhs);
+      };
+      detail::parallel_stable_sort(added.begin(), added.end(), comp);
+      const auto mid = order.insert(order.end(), added.begin(), added.end()) - order.begin();
+      std::inplace_merge(order.begin(), order.begin() + mid, order.end(), comp);
+    }
+
+    template<typename ... A>
+    void sorted_column_list_data<A...>::refresh () {
+      key_cache.clear();
+      known_rows = source ? source->size() : 0;
+      order = filtered(0, known_rows);
+      sort(keys);
+    }
+
+    template<typename ... A>
+    auto sorted_column_list_data<A...>::filtered (std::size_t first, std::size_t last) const -> std::vector<std::size_t> {
+      std::vector<std::size_t> result(last - first);
+      std::iota(result.begin(), result.end(), first);
+      if (!filter || result.empty()) {
+        return result;
+      }
+      const std::size_t chunks = detail::worker_count(result.size());
+      std::vector<std::vector<std::size_t>> parts(chunks);
+      detail::parallel_chunks(result.size(), chunks, [&] (std::size_t c, std::size_t b, std::size_t e) {
+        auto& part = parts[c];
+        for (std::size_t i = first + b; i < first + e; ++i) {
+          const row_type* row = source->get_row(i);
+          if (row ? filter(*row) : filter(source->at(i))) {
+            part.push_back(i);
+          }
+        }
+      });
+      result.clear();
+      for (const auto& part : parts) {
+        result.insert(result.end(), part.begin(), part.end());
+      }
+      return result;
+    }
+
+    template<typename ... A>
+    void sorted_column_list_data<A...>::extract_keys () {
+      if (!source) {
+        return;
+      }
+      for (const auto& k : keys) {
+        if ((k.column < 0) || (k.column >= static_cast<int>(sizeof...(A)))) {
+          continue;
+        }
+        if (key_cache.size() <= static_cast<std::size_t>(k.column)) {
+          key_cache.resize(k.column + 1);
+        }
+        auto& c = key_cache[k.column];
+        if (!c) {
+          // a new key column needs the keys of all rows.
+          c = make_keys(k.column, std::index_sequence_for<A...>());
+          if (c) {
+            c->extract(*source, 0, known_rows);
+          }
+        }
+      }
+    }
+
+    template<typename ... A>
+    bool sorted_column_list_data<A...>::less (std::size_t lhs, std::size_t rhs) const {
+      for (const auto& k : keys) {
+        if ((k.column < 0) || (static_cast<std::size_t>(k.column) >= key_cache.size()) || !key_cache[k.column]) {
+          continue;
+        }
+        const int r = key_cache[k.column]->compare(lhs, rhs);
+        if (r != 0) {
+          return (k.dir == util::sort::order::up) ? (r < 0) : (r > 0);
+        }
+      }
+      return false;
+    }
+
+    template<typename ... A>
+    template<std::size_t ... I>
+    auto sorted_column_list_data<A...>::make_keys (int column, std::index_sequence<I...>) -> std::shared_ptr<column_keys_base> {
+      std::shared_ptr<column_keys_base> keys;
+      (void)std::initializer_list<int>{(column == I ? (keys = make_column_keys<I>(
+        detail::is_less_comparable<typename column_keys<I>::key_type>()), 0) : 0)...};
+      return keys;
+    }
+
+    template<typename ... A>
+    template<std::size_t I>
+    auto sorted_column_list_data<A...>::make_column_keys (std::true_type) -> std::shared_ptr<column_keys_base> {
+      return std::make_shared<column_keys<I>>();
+    }
+
+    template<typename ... A>
+    template<std::size_t I>
+    auto sorted_column_list_data<A...>::make_column_keys (std::false_type) -> std::shared_ptr<column_keys_base> {
+      // the column can not be sorted.
+      return nullptr;
+    }
+
+    template<typename ... A>
+    template<std::size_t I>
+    void sorted_column_list_data<A...>::column_keys<I>::extract (const source_type& source, std::size_t first, std::size_t last) {
+      keys.resize(last);
+      const std::size_t rows = last - first;
+      // the elements of a vector<bool> share words and can not be written in parallel.
+      const std::size_t chunks = std::is_same<key_type, bool>::value ? 1 : detail::worker_count(rows);
+      detail::parallel_chunks(rows, chunks, [&] (std::size_t, std::size_t b, std::size_t e) {
+        for (std::size_t i = first + b; i < first + e; ++i) {
+          const row_type* row = source.get_row(i);
+          keys[i] = row ? std::get<I>(*row) : std::get<I>(source.at(i));
+        }
+      });
+    }
+
+    template<typename ... A>
+    template<std::size_t I>
+    int sorted_column_list_data<A...>::column_keys<I>::compare (std::size_t lhs, std::size_t rhs) const {
+      return (keys[lhs] < keys[rhs]) ? -1 : ((keys[rhs] < keys[lhs]) ? 1 : 0);
+    }
+
     template<typename L, typename S, typename ... A>
     sorted_column_list_t<L, S, A...>::sorted_column_list_t (gui::core::size::type item_size,
                                                          gui::os::color background,
@@ -54,11 +375,34 @@ namespace gui {
         if (!sorter(sort_dir, sort_column)) {
           sort_column = -1;
         }
+      } else if (sort_view) {
+        // the previous columns decide on equal rows.
+        auto i = std::find_if(keys.begin(), keys.end(), [&] (const typename sorted_data::sort_key& k) {
+          return k.column == sort_column;
+        });
+        if (i != keys.end()) {
+          keys.erase(i);
+        }
+        if (sort_column > -1) {
+          keys.insert(keys.begin(), typename sorted_data::sort_key{sort_column, sort_dir});
+        }
+        if (keys.size() > max_sort_keys) {
+          keys.resize(max_sort_keys);
+        }
+        sort_view(keys);
       }
       super::list.invalidate();
       super::header.invalidate();
     }
 
+    template<typename L, typename S, typename ... A>
+    void sorted_column_list_t<L, S, A...>::set_sorted_data (sorted_data& v) {
+      sort_view = [&v] (const typename sorted_data::sort_keys& k) {
+        v.sort(k);
+      };
+      super::set_data(std::ref(v));
+    }
+
     template<typename L, typename S, typename ... A>
     void sorted_column_list_t<L, S, A...>::init () {
       using namespace gui;
@@ -278,7 +278,7 @@ namespace gui {
         auto& dirs = std::get<0>(super::views);
         auto& files = std::get<1>(super::views);
         if (dirs.view->has_selection()) {
-          files.set_path(dirs.view->get_item(dirs.view->get_selection().get_first_index()).path);
+          files.set_path_async(dirs.view->get_item(dirs.view->get_selection().get_first_index()).path);
         }
       });
       std::get<1>(super::views).list->on_selection_commit([&, action] () {
@@ -288,7 +288,7 @@ namespace gui {
         if (O && sys_fs::is_directory(path)) {
           dirs.view->open_node(path.parent_path());
           dirs.view->select_node(path);
-          files.set_path(path);
+          files.set_path_async(path);
         } else {
           action(super::get_overlapped_window(), path);
         }
@@ -0,0 +1,326 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     streaming time-series chart with incremental rendering
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <algorithm>
+#include <iomanip>
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include <util/ostreamfmt.h>
+#include "gui/draw/graphics.h"
+#include "gui/draw/drawers.h"
+#include "gui/draw/font.h"
+#include "gui/draw/pen.h"
+#include "gui/ctrl/stream_chart.h"
+#include "gui/win/window_event_proc.h"
+
+
+using namespace gui::draw;
+using namespace gui::win;
+using namespace gui::core;
+
+namespace gui {
+
+  namespace ctrl {
+
+    // --------------------------------------------------------------------------
+    namespace {
+
+      point::type value_to_y (const stream_plot::range_type& range,
+                              stream_plot::value_type v,
+                              point::type height) {
+        const auto span = range.end() - range.begin();
+        const auto f = span != 0 ? (v - range.begin()) / span : 0;
+        return height - 1 - std::min<point::type>(std::max<point::type>(f, 0), 1) * (height - 1);
+      }
+
+    } // namespace
+
+    stream_plot::stream_plot (std::size_t samples_per_column)
+      : samples_per_column(std::max<std::size_t>(samples_per_column, 1))
+      , current{0, 0, 0}
+      , current_count(0)
+      , last_value(0)
+      , has_last(false)
+    {}
+
+    void stream_plot::resize (const core::native_size& sz, os::color background) {
+      if (sz.width() > 0 && sz.height() > 0) {
+        backstore.create(sz);
+        graphics(backstore).clear(background);
+      } else {
+        backstore = draw::pixmap();
+      }
+      has_last = false;
+    }
+
+    void stream_plot::reset () {
+      pending.clear();
+      has_last = false;
+      current_count = 0;
+    }
+
+    void stream_plot::add (value_type v) {
+      if (current_count == 0) {
+        current = {v, v, v};
+      } else {
+        current.min = std::min(current.min, v);
+        current.max = std::max(current.max, v);
+        current.last = v;
+      }
+      if (++current_count >= samples_per_column) {
+        pending.push_back(current);
+        current_count = 0;
+      }
+    }
+
+    bool stream_plot::draw (const range_type& range, os::color foreground, os::color background) {
+      if (pending.empty()) {
+        return false;
+      }
+      draw_columns(pending.data(), pending.size(), range, foreground, background);
+      pending.clear();
+      return true;
+    }
+
+    void stream_plot::set_samples_per_column (std::size_t n) {
+      samples_per_column = std::max<std::size_t>(n, 1);
+    }
+
+    std::size_t stream_plot::get_samples_per_column () const {
+      return samples_per_column;
+    }
+
+    const draw::pixmap& stream_plot::get_pixmap () const {
+      return backstore;
+    }
+
+    void stream_plot::draw_columns (const column* cols, std::size_t count, const range_type& range,
+                                    os::color foreground, os::color background) {
+      if (!backstore.is_valid()) {
+        return;
+      }
+      const auto sz = backstore.native_size();
+      const uint32_t w = sz.width();
+      if (w == 0) {
+        return;
+      }
+
+      // only the newest columns can be visible.
+      if (count > w) {
+        cols += count - w;
+        count = w;
+      }
+      const auto k = static_cast<uint32_t>(count);
+
+      graphics g(backstore);
+      if (k < w) {
+        g.copy_from(g, native_rect(k, 0, w - k, sz.height()), native_point::zero);
+      }
+
+      const auto x0 = core::global::scale_from_native<point::type>(w - k);
+      const auto height = core::global::scale_from_native<point::type>(sz.height());
+      g.erase(core::rectangle(point(x0, 0), point(core::global::scale_from_native<point::type>(w), height)),
+              background);
+
+      const draw::pen pn(foreground);
+      for (uint32_t i = 0; i < k; ++i) {
+        const column& c = cols[i];
+        const auto x = core::global::scale_from_native<point::type>(w - k + i);
+        auto top = value_to_y(range, c.max, height);
+        auto bottom = value_to_y(range, c.min, height);
+        if (has_last) {
+          // connect to the previous column to avoid gaps on steep slopes.
+          const auto y = value_to_y(range, last_value, height);
+          top = std::min(top, y);
+          bottom = std::max(bottom, y);
+        }
+        g.frame(draw::line(point(x, top), point(x, bottom)), pn);
+        last_value = c.last;
+        has_last = true;
+      }
+    }
+
+    // --------------------------------------------------------------------------
+    stream_chart::stream_chart (const range_type& range, std::size_t samples_per_column)
+      : plot(samples_per_column)
+      , range(range)
+      , axis_width(40)
+      , foreground(color::dark_blue)
+      , axis_color(color::black)
+    {
+      set_background(color::white);
+      on_paint(draw::paint(this, &stream_chart::paint));
+      on_size([&] (const core::size&) {
+        rebuild();
+      });
+    }
+
+    void stream_chart::create (container& parent,
+                               const core::rectangle& place) {
+      super::create(clazz::get(), parent, place);
+      rebuild();
+      if (!queue.empty()) {
+        // values pushed before the window existed.
+        schedule_update();
+      }
+    }
+
+    // --------------------------------------------------------------------------
+    bool stream_chart::push (value_type v) {
+      return push(&v, 1) == 1;
+    }
+
+    std::size_t stream_chart::push (const value_type* data, std::size_t count) {
+      const auto n = queue.push(data, count);
+      schedule_update();
+      return n;
+    }
+
+    void stream_chart::schedule_update () {
+      // coalesce: only one update per main loop round trip, regardless of the push rate.
+      if (update_request.request()) {
+        if (is_valid()) {
+          // the bound update is dropped if the chart is destroyed meanwhile.
+          win::run_on_main(*this, update_request.bind([&] () {
+            update();
+          }));
+        } else {
+          update_request.cancel();
+        }
+      }
+    }
+
+    // --------------------------------------------------------------------------
+    void stream_chart::set_range (const range_type& r) {
+      range = r;
+      rebuild();
+      invalidate();
+    }
+
+    auto stream_chart::get_range () const -> const range_type& {
+      return range;
+    }
+
+    void stream_chart::set_samples_per_column (std::size_t n) {
+      plot.set_samples_per_column(n);
+    }
+
+    std::size_t stream_chart::get_samples_per_column () const {
+      return plot.get_samples_per_column();
+    }
+
+    void stream_chart::set_foreground (os::color c) {
+      foreground = c;
+    }
+
+    os::color stream_chart::get_foreground () const {
+      return foreground;
+    }
+
+    void stream_chart::set_axis_color (os::color c) {
+      axis_color = c;
+    }
+
+    os::color stream_chart::get_axis_color () const {
+      return axis_color;
+    }
+
+    void stream_chart::set_axis_width (core::size::type w) {
+      axis_width = w;
+      rebuild();
+      invalidate();
+    }
+
+    core::size::type stream_chart::get_axis_width () const {
+      return axis_width;
+    }
+
+    void stream_chart::clear () {
+      plot.reset();
+      rebuild();
+      invalidate();
+    }
+
+    // --------------------------------------------------------------------------
+    void stream_chart::update () {
+      value_type buffer[256];
+      std::size_t n = 0;
+      while ((n = queue.pop(buffer, 256)) > 0) {
+        for (std::size_t i = 0; i < n; ++i) {
+          plot.add(buffer[i]);
+        }
+      }
+      if (plot.draw(range, foreground, get_background())) {
+        invalidate_plot();
+      }
+    }
+
+    // --------------------------------------------------------------------------
+    void stream_chart::paint (graphics& graph) {
+      const auto area = client_geometry();
+      const core::rectangle axis(area.top_left(), core::size(axis_width, area.height()));
+      graph.erase(axis, get_background());
+
+      const auto& f = draw::font::system_small();
+      const auto x = axis.x2() - 4;
+      graph.text(draw::text(ostreamfmt(std::setprecision(3) << range.end()),
+                            point(x, axis.y()), text_origin_t::top_right), f, axis_color);
+      graph.text(draw::text(ostreamfmt(std::setprecision(3) << range.begin()),
+                            point(x, axis.y2()), text_origin_t::bottom_right), f, axis_color);
+      graph.frame(draw::line(point(axis.x2() - 1, axis.y()), point(axis.x2() - 1, axis.y2())),
+                  draw::pen(axis_color));
+
+      if (plot.get_pixmap().is_valid()) {
+        graph.copy_from(plot.get_pixmap(), point(axis.x2(), area.y()));
+      }
+    }
+
+    // --------------------------------------------------------------------------
+    void stream_chart::rebuild () {
+      plot.resize(plot_area().size(), get_background());
+    }
+
+    native_rect stream_chart::plot_area () const {
+      const auto sz = client_size();
+      const uint32_t w = sz.os_width();
+      const auto aw = std::min(core::global::scale_to_native<uint32_t>(axis_width), w);
+      return native_rect(aw, 0, w - aw, sz.os_height());
+    }
+
+    void stream_chart::invalidate_plot () const {
+      if (is_valid() && is_visible()) {
+        auto r = surface_geometry();
+        const auto aw = std::min(core::global::scale_to_native<uint32_t>(axis_width), r.width());
+        r.x(r.x() + aw);
+        r.width(r.width() - aw);
+        if (get_parent() && !get_state().overlapped()) {
+          get_parent()->invalidate(r);
+        } else {
+          get_overlapped_window().invalidate(r);
+        }
+      }
+    }
+
+  } // ctrl
+
+} // gui
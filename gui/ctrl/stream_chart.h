@@ -0,0 +1,157 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     streaming time-series chart with incremental rendering
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <vector>
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include "gui/core/ring_buffer.h"
+#include "gui/core/pending_update.h"
+#include "gui/core/range.h"
+#include "gui/draw/bitmap.h"
+#include "gui/ctrl/control.h"
+#include "gui/win/container.h"
+
+
+namespace gui {
+
+  namespace ctrl {
+
+    // --------------------------------------------------------------------------
+    /**
+     * Back store of a stream_chart.
+     * Collects the values into one min/max column per native pixel, scrolls
+     * the pixmap by the number of new columns and draws only those.
+     */
+    class GUIPP_CTRL_EXPORT stream_plot {
+    public:
+      typedef float value_type;
+      typedef core::range<value_type> range_type;
+
+      explicit stream_plot (std::size_t samples_per_column = 1);
+
+      /// Recreate the pixmap, an empty size drops it.
+      void resize (const core::native_size&, os::color background);
+      /// Forget the last column, the next one does not connect to it.
+      void reset ();
+
+      void add (value_type v);
+      /// Draw the columns completed since the last call, false if there were none.
+      bool draw (const range_type&, os::color foreground, os::color background);
+
+      void set_samples_per_column (std::size_t);
+      std::size_t get_samples_per_column () const;
+
+      const draw::pixmap& get_pixmap () const;
+
+    private:
+      struct column {
+        value_type min;
+        value_type max;
+        value_type last;
+      };
+
+      void draw_columns (const column* cols, std::size_t count, const range_type&,
+                         os::color foreground, os::color background);
+
+      draw::pixmap backstore;
+      std::vector<column> pending;
+      std::size_t samples_per_column;
+
+      column current;
+      std::size_t current_count;
+      value_type last_value;
+      bool has_last;
+    };
+
+    // --------------------------------------------------------------------------
+    /**
+     * Chart for a continuous stream of values.
+     * Values are pushed from any single producer thread, the chart hands
+     * them to its stream_plot on the main thread.
+     */
+    class GUIPP_CTRL_EXPORT stream_chart : public control {
+    public:
+      typedef control super;
+      typedef win::no_focus_window_class<stream_chart> clazz;
+      typedef stream_plot::value_type value_type;
+      typedef stream_plot::range_type range_type;
+
+      static constexpr std::size_t queue_size = 16384;
+
+      explicit stream_chart (const range_type& range = {0, 1},
+                             std::size_t samples_per_column = 1);
+
+      void create (win::container& parent,
+                   const core::rectangle& place = core::rectangle::def) override;
+
+      /// Producer side, may be called from a worker thread.
+      /// Returns false if the queue was full and the value was dropped.
+      bool push (value_type v);
+      std::size_t push (const value_type* data, std::size_t count);
+
+      void set_range (const range_type&);
+      const range_type& get_range () const;
+
+      void set_samples_per_column (std::size_t);
+      std::size_t get_samples_per_column () const;
+
+      void set_foreground (os::color);
+      os::color get_foreground () const;
+
+      void set_axis_color (os::color);
+      os::color get_axis_color () const;
+
+      void set_axis_width (core::size::type);
+      core::size::type get_axis_width () const;
+
+      /// Remove all drawn values.
+      void clear ();
+
+      void paint (draw::graphics& graph);
+
+    protected:
+      /// Main thread: consume the queue and draw the new columns into the back store.
+      void update ();
+
+    private:
+      void schedule_update ();
+      void rebuild ();
+      core::native_rect plot_area () const;
+      void invalidate_plot () const;
+
+      core::ring_buffer<value_type, queue_size> queue;
+      core::pending_update update_request;
+
+      stream_plot plot;
+
+      range_type range;
+      core::size::type axis_width;
+      os::color foreground;
+      os::color axis_color;
+    };
+
+  } // ctrl
+
+} // gui
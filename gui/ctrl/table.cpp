@@ -37,26 +37,19 @@ namespace gui {
 
         // --------------------------------------------------------------------------
         void spawns::set (const position& cell, const spawn& sp) {
-          if (data.size() <= (cell.x() + sp.x)) {
-            data.resize(cell.x() + sp.x + 1);
-          }
           for(int16_t x = 0; x < sp.x + 1; ++x) {
-            column& c = data[cell.x() + x];
-            if (c.size() <= (cell.y() + sp.y)) {
-              c.resize(cell.y() + sp.y + 1);
-            }
             for(int16_t y = 0; y < sp.y + 1; ++y) {
-              c[cell.y() + y] = {int16_t(-x), int16_t(-y)};
+              const spawn hidden = {int16_t(-x), int16_t(-y)};
+              data[cell_key(cell + offset(x, y))] = (x || y) ? hidden : sp;
             }
           }
-          data[cell.x()][cell.y()] = sp;
         }
 
         spawn spawns::get (const position& cell) const {
-          if (cell.x() < data.size()) {
-            const std::vector<spawn>& c = data[cell.x()];
-            if (cell.y() < c.size()) {
-              return c[cell.y()];
+          if (!data.empty()) {
+            auto i = data.find(cell_key(cell));
+            if (i != data.end()) {
+              return i->second;
             }
           }
           return {};
@@ -66,9 +59,8 @@ namespace gui {
           spawn sp = get(cell);
           if (!sp.is_empty()) {
             for(int x = 0; x < sp.x + 1; ++x) {
-              column& c = data[cell.x() + x];
               for(int y = 0; y < sp.y + 1; ++y) {
-                c[cell.y() + y] = {};
+                data.erase(cell_key(cell + offset(x, y)));
               }
             }
           }
@@ -212,9 +204,10 @@ namespace gui {
                               const data::matrix<os::color>& backgrounds,
                               const std::function<cell_drawer>& drawer,
                               const std::function<filter::selection_and_hilite>& selection_filter,
-                              const std::function<filter::selection_and_hilite>& hilite_filter) {
-          if (drawer) {
-            const core::point max_sz = place.x2y2();
+                              const std::function<filter::selection_and_hilite>& hilite_filter,
+                              const core::rectangle& dirty) {
+          if (drawer && !dirty.empty()) {
+            const core::point max_sz = dirty.x2y2();
             position cell(0, static_cast<position::type>(geometrie.heights.get_first_idx()));
             core::point::type y = place.y() + geometrie.heights.get_first_offset();
 
@@ -222,6 +215,12 @@ namespace gui {
 
             while (y < max_sz.y()) {
               const core::size::type height = geometrie.heights.get_size(cell.y());
+              if (y + height <= dirty.y()) {
+                // rows above the dirty area, a spawn reaching into it is drawn from its hidden cells.
+                y += height;
+                cell.move_y(1);
+                continue;
+              }
 
               cell.x(static_cast<int>(geometrie.widths.get_first_idx()));
               core::point::type x = place.x() + geometrie.widths.get_first_offset();
@@ -253,7 +252,7 @@ namespace gui {
                   painted_spawns.insert(paint_cell);
                   area.set_size(geometrie.get_size(paint_cell));
                 }
-                if (!area.size().empty()) {
+                if (!area.size().empty() && area.overlap(dirty)) {
                   drawer(paint_cell, graph, area,
                          aligns.get_cell(paint_cell),
                          foregrounds.get_cell(paint_cell),
@@ -278,20 +277,23 @@ namespace gui {
                                 const data::vector<os::color>& backgrounds,
                                 const std::function<cell_drawer>& drawer,
                                 const std::function<filter::selection_and_hilite>& selection_filter,
-                                const std::function<filter::selection_and_hilite>& hilite_filter) {
-          if (drawer) {
-            const auto max_x = place.x2();
+                                const std::function<filter::selection_and_hilite>& hilite_filter,
+                                const core::rectangle& dirty) {
+          if (drawer && !dirty.empty()) {
+            const auto max_x = dirty.x2();
             position cell(static_cast<position::type>(geometrie.widths.get_first_idx()), 0);
             core::point::type x = place.x() + geometrie.widths.get_first_offset();
 
             while (x < max_x) {
               const core::size::type width = geometrie.widths.get_size(cell.x());
-              drawer(cell, graph,
-                     core::rectangle(x, place.y(), width, place.height()),
-                     aligns.get(cell.x()),
-                     foregrounds.get(cell.x()),
-                     backgrounds.get(cell.x()),
-                     get_cell_item_state(selection_filter, hilite_filter, cell, geometrie));
+              if (x + width > dirty.x()) {
+                drawer(cell, graph,
+                       core::rectangle(x, place.y(), width, place.height()),
+                       aligns.get(cell.x()),
+                       foregrounds.get(cell.x()),
+                       backgrounds.get(cell.x()),
+                       get_cell_item_state(selection_filter, hilite_filter, cell, geometrie));
+              }
 
               x += width;
               cell.x(1 + cell.x());
@@ -307,21 +309,24 @@ namespace gui {
                              const data::vector<os::color>& backgrounds,
                              const std::function<cell_drawer>& drawer,
                              const std::function<filter::selection_and_hilite>& selection_filter,
-                             const std::function<filter::selection_and_hilite>& hilite_filter) {
-          if (drawer) {
-            const core::point::type max_y = place.y2();
+                             const std::function<filter::selection_and_hilite>& hilite_filter,
+                             const core::rectangle& dirty) {
+          if (drawer && !dirty.empty()) {
+            const core::point::type max_y = dirty.y2();
             position cell(0, static_cast<position::type>(geometrie.heights.get_first_idx()));
             core::point::type y = place.y() + geometrie.heights.get_first_offset();
 
             while (y < max_y) {
               const core::size::type height = geometrie.heights.get_size(cell.y());
 
-              drawer(cell, graph,
-                     core::rectangle(place.x(), y, place.width(), height),
-                     aligns.get(cell.y()),
-                     foregrounds.get(cell.y()),
-                     backgrounds.get(cell.y()),
-                     get_cell_item_state(selection_filter, hilite_filter, cell, geometrie));
+              if (y + height > dirty.y()) {
+                drawer(cell, graph,
+                       core::rectangle(place.x(), y, place.width(), height),
+                       aligns.get(cell.y()),
+                       foregrounds.get(cell.y()),
+                       backgrounds.get(cell.y()),
+                       get_cell_item_state(selection_filter, hilite_filter, cell, geometrie));
+              }
 
               y += height;
               cell.y(1 + cell.y());
@@ -329,6 +334,11 @@ namespace gui {
           }
         }
 
+        core::rectangle get_dirty_area (const draw::graphics& graph, const core::rectangle& place) {
+          const auto& ctx = graph.context();
+          return core::rectangle(graph.get_invalid_area().os(ctx), ctx) & place;
+        }
+
       }
 
       // --------------------------------------------------------------------------
@@ -393,10 +403,35 @@ namespace gui {
 
       void data_view::init () {
         super::on_paint(draw::paint([&](draw::graphics&  graph){
-          paint::draw_table_data(graph, client_geometry(), geometrie, aligns, foregrounds, backgrounds, drawer, selection_filter, hilite_filter);
+          const auto place = client_geometry();
+          paint::draw_table_data(graph, place, geometrie, aligns, foregrounds, backgrounds, drawer,
+                                 selection_filter, hilite_filter, paint::get_dirty_area(graph, place));
         }));
       }
 
+      core::rectangle data_view::get_cells_area (const table::position& first, const table::position& last) const {
+        if ((first.x() < 0) || (first.y() < 0) || (last.x() < first.x()) || (last.y() < first.y())) {
+          return core::rectangle::zero;
+        }
+        auto top_left = first;
+        const auto spwn = geometrie.spawns.get(first);
+        if (spwn.is_hidden()) {
+          // the cell is painted as part of the spawn it is hidden by.
+          top_left += offset(spwn.x, spwn.y);
+        }
+        // the two point constructor includes the second point, build from the size instead.
+        const auto pos = geometrie.position_of(top_left);
+        const auto end = geometrie.position_of(last) + geometrie.get_size(last);
+        return core::rectangle(pos, core::size(end.x() - pos.x(), end.y() - pos.y()));
+      }
+
+      void data_view::invalidate_cells (const table::position& first, const table::position& last) const {
+        const auto area = get_cells_area(first, last);
+        if (!area.empty()) {
+          invalidate(area);
+        }
+      }
+
       // --------------------------------------------------------------------------
       column_view::column_view (metric& geometrie,
                                 text_origin_t align,
@@ -424,10 +459,28 @@ namespace gui {
 
       void column_view::init () {
         super::on_paint(draw::paint([&](draw::graphics&  graph) {
-          paint::draw_table_column(graph, client_geometry(), geometrie, aligns, foregrounds, backgrounds, drawer, selection_filter, hilite_filter);
+          const auto place = client_geometry();
+          paint::draw_table_column(graph, place, geometrie, aligns, foregrounds, backgrounds, drawer,
+                                   selection_filter, hilite_filter, paint::get_dirty_area(graph, place));
         }));
       }
 
+      core::rectangle column_view::get_cells_area (int first, int last) const {
+        if ((first < 0) || (last < first)) {
+          return core::rectangle::zero;
+        }
+        const auto x = geometrie.widths.position_of(first);
+        const auto x2 = geometrie.widths.position_of(last) + geometrie.widths.get_size(last);
+        return core::rectangle(x, 0, x2 - x, client_size().height());
+      }
+
+      void column_view::invalidate_cells (int first, int last) const {
+        const auto area = get_cells_area(first, last);
+        if (!area.empty()) {
+          invalidate(area);
+        }
+      }
+
       // --------------------------------------------------------------------------
       row_view::row_view (metric& geometrie,
                           text_origin_t align,
@@ -455,10 +508,28 @@ namespace gui {
 
       void row_view::init () {
         super::on_paint(draw::paint([&](draw::graphics&  graph){
-          paint::draw_table_row(graph, client_geometry(), geometrie, aligns, foregrounds, backgrounds, drawer, selection_filter, hilite_filter);
+          const auto place = client_geometry();
+          paint::draw_table_row(graph, place, geometrie, aligns, foregrounds, backgrounds, drawer,
+                                selection_filter, hilite_filter, paint::get_dirty_area(graph, place));
         }));
       }
 
+      core::rectangle row_view::get_cells_area (int first, int last) const {
+        if ((first < 0) || (last < first)) {
+          return core::rectangle::zero;
+        }
+        const auto y = geometrie.heights.position_of(first);
+        const auto y2 = geometrie.heights.position_of(last) + geometrie.heights.get_size(last);
+        return core::rectangle(0, y, client_size().width(), y2 - y);
+      }
+
+      void row_view::invalidate_cells (int first, int last) const {
+        const auto area = get_cells_area(first, last);
+        if (!area.empty()) {
+          invalidate(area);
+        }
+      }
+
     } // namespace table
 
     // --------------------------------------------------------------------------
@@ -468,6 +539,17 @@ namespace gui {
       return current_pos + size * 2.0;
     }
 
+    namespace {
+
+      // true if f still is the default filter fn.
+      bool is_hilite_filter (const std::function<table::filter::selection_and_hilite>& f,
+                             table::filter::selection_and_hilite* fn) {
+        auto p = f.target<table::filter::selection_and_hilite*>();
+        return p && (*p == fn);
+      }
+
+    } // namespace
+
     // --------------------------------------------------------------------------
     table_view::table_view (core::size::type default_width,
                             core::size::type default_height,
@@ -562,11 +644,12 @@ namespace gui {
     }
 
     void table_view::handle_scroll (const core::point& pos) {
+      const core::point previous = geometrie.get_offset();
       geometrie.set_offset(pos);
       if ((hscroll.get_selection() == scrollbar_item::nothing) && (vscroll.get_selection() == scrollbar_item::nothing)) {
         set_scroll_maximum(scroll_maximum(data.client_size(), pos, core::point(hscroll.get_max(), vscroll.get_max())));
       }
-      redraw_all();
+      scroll_all(previous);
     }
 
     void table_view::init () {
@@ -626,6 +709,7 @@ namespace gui {
     }
 
     void table_view::set_scroll_pos (const core::point& pos) {
+      const core::point previous = geometrie.get_offset();
       if (hscroll.is_enabled()) {
         hscroll.set_value(pos.x(), false);
         geometrie.widths.set_offset(hscroll.get_value());
@@ -634,7 +718,7 @@ namespace gui {
         vscroll.set_value(pos.y(), false);
         geometrie.heights.set_offset(vscroll.get_value());
       }
-      redraw_all();
+      scroll_all(previous);
     }
 
     void table_view::clear_selection (event_source notify) {
@@ -732,6 +816,78 @@ namespace gui {
       columns.invalidate();
     }
 
+    void table_view::scroll_all (const core::point& previous_offset) {
+      // copy the still visible cells and headers, paint only the exposed ones.
+      const core::point delta = previous_offset - geometrie.get_offset();
+      if (delta == core::point::zero) {
+        redraw_all();
+        return;
+      }
+      if (delta.x() != 0) {
+        columns.scroll_content(core::point(delta.x(), 0));
+      }
+      if (delta.y() != 0) {
+        rows.scroll_content(core::point(0, delta.y()));
+      }
+      data.scroll_content(delta);
+    }
+
+    void table_view::redraw_hilite (const table::position& old_hilite) {
+      if (!has_default_hilite_filters()) {
+        // a custom filter may hilite any cell.
+        redraw_all();
+        return;
+      }
+      const auto damage = get_hilite_damage(old_hilite);
+      for (const auto& r : damage.data) {
+        data.invalidate(r);
+      }
+      for (const auto& r : damage.columns) {
+        columns.invalidate(r);
+      }
+      for (const auto& r : damage.rows) {
+        rows.invalidate(r);
+      }
+    }
+
+    table_view::hilite_damage table_view::get_hilite_damage (const table::position& old_hilite) const {
+      // only the cells the hilite left or entered change.
+      hilite_damage damage;
+      const auto add = [] (std::vector<core::rectangle>& v, const core::rectangle& r) {
+        if (!r.empty()) {
+          v.push_back(r);
+        }
+      };
+      const auto& new_hilite = geometrie.hilite;
+      add(damage.data, data.get_cells_area(old_hilite, old_hilite));
+      if (new_hilite != old_hilite) {
+        add(damage.data, data.get_cells_area(new_hilite, new_hilite));
+      }
+      if (old_hilite.x() != new_hilite.x()) {
+        add(damage.columns, columns.get_cells_area(old_hilite.x(), old_hilite.x()));
+        add(damage.columns, columns.get_cells_area(new_hilite.x(), new_hilite.x()));
+      }
+      if (old_hilite.y() != new_hilite.y()) {
+        add(damage.rows, rows.get_cells_area(old_hilite.y(), old_hilite.y()));
+        add(damage.rows, rows.get_cells_area(new_hilite.y(), new_hilite.y()));
+      }
+      return damage;
+    }
+
+    bool table_view::has_default_hilite_filters () const {
+      return is_hilite_filter(data.get_hilite_filter(), table::filter::data_hilite) &&
+             is_hilite_filter(columns.get_hilite_filter(), table::filter::column_hilite) &&
+             is_hilite_filter(rows.get_hilite_filter(), table::filter::row_hilite);
+    }
+
+    void table_view::invalidate_cells (const table::position& first, const table::position& last) {
+      data.invalidate_cells(first, last);
+    }
+
+    void table_view::invalidate_cell (const table::position& cell) {
+      data.invalidate_cells(cell, cell);
+    }
+
     core::size::type table_view::row_width () const {
       return get_layout().get_left_width();
     }
@@ -819,8 +975,9 @@ namespace gui {
       } else if (enable_hilite_) {
         const auto new_hilite = data.get_index_at_point(data.surface_to_client(pt));
         if (geometrie.hilite != new_hilite) {
+          const auto old_hilite = geometrie.hilite;
           geometrie.hilite = new_hilite;
-          redraw_all();
+          redraw_hilite(old_hilite);
           notify_event(detail::HILITE_CHANGE_MESSAGE, true);
         }
       }
@@ -877,8 +1034,9 @@ namespace gui {
         if (enable_hilite_ && (idx < 0)) {
           const auto new_hilite = columns.get_index_at_point(cpt);
           if (geometrie.hilite != new_hilite) {
+            const auto old_hilite = geometrie.hilite;
             geometrie.hilite = new_hilite;
-            redraw_all();
+            redraw_hilite(old_hilite);
             notify_event(detail::HILITE_CHANGE_MESSAGE, true);
           }
         }
@@ -936,8 +1094,9 @@ namespace gui {
         if (enable_hilite_ && (idx < 0)) {
           const auto new_hilite = rows.get_index_at_point(rpt);
           if (geometrie.hilite != new_hilite) {
+            const auto old_hilite = geometrie.hilite;
             geometrie.hilite = new_hilite;
-            redraw_all();
+            redraw_hilite(old_hilite);
             notify_event(detail::HILITE_CHANGE_MESSAGE, true);
           }
         }
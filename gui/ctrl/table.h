@@ -16,6 +16,12 @@
 
 #pragma once
 
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <unordered_map>
+
 // --------------------------------------------------------------------------
 //
 // Library includes
@@ -51,6 +57,9 @@ namespace gui {
       // --------------------------------------------------------------------------
       namespace data {
 
+        /// Unique key of a cell for hashed storage.
+        uint64_t cell_key (const position& cell);
+
         // --------------------------------------------------------------------------
         template<typename T>
         struct vector : public std::vector<T> {
@@ -72,6 +81,11 @@ namespace gui {
         };
 
         // --------------------------------------------------------------------------
+        /**
+         * Sparse cell attributes: a default, per column and per row values and
+         * single cell exceptions. Memory grows with the number of set values only.
+         * The last of set_cell, set_column and set_row touching a cell wins.
+         */
         template<typename T>
         struct matrix {
           explicit matrix (const T& default_data);
@@ -92,12 +106,20 @@ namespace gui {
           const T& get_column_row_cell (const position& cell) const;
 
         private:
-          typedef data::vector<T> vector;
+          struct stamped {
+            T value;
+            uint32_t stamp;
+          };
 
-          std::vector<std::vector<T> > data;
-          vector column_data;
-          vector row_data;
+          typedef std::unordered_map<int, T> cells;
 
+          T default_data;
+          // columns are few, rows may be millions.
+          std::vector<stamped> column_data;
+          std::unordered_map<int, stamped> row_data;
+          std::vector<cells> data;
+          int rows;
+          uint32_t stamp;
         };
 
         // --------------------------------------------------------------------------
@@ -125,8 +147,7 @@ namespace gui {
           void clear (const position&);
 
         private:
-          typedef std::vector<spawn> column;
-          std::vector<column> data;
+          std::unordered_map<uint64_t, spawn> data;
         };
 
       } // data
@@ -214,6 +235,7 @@ namespace gui {
       // --------------------------------------------------------------------------
       namespace paint {
 
+        /// Only the cells overlapping dirty are drawn.
         GUIPP_CTRL_EXPORT void draw_table_data (draw::graphics& graph,
                                                 const core::rectangle& place,
                                                 const metric& geometrie,
@@ -222,7 +244,8 @@ namespace gui {
                                                 const data::matrix<os::color>& backgrounds,
                                                 const std::function<cell_drawer>& drawer,
                                                 const std::function<filter::selection_and_hilite>& selection_filter,
-                                                const std::function<filter::selection_and_hilite>& hilite_filter);
+                                                const std::function<filter::selection_and_hilite>& hilite_filter,
+                                                const core::rectangle& dirty);
 
         GUIPP_CTRL_EXPORT void draw_table_column (draw::graphics& graph,
                                                   const core::rectangle& place,
@@ -232,7 +255,8 @@ namespace gui {
                                                   const data::vector<os::color>& backgrounds,
                                                   const std::function<cell_drawer>& drawer,
                                                   const std::function<filter::selection_and_hilite>& selection_filter,
-                                                  const std::function<filter::selection_and_hilite>& hilite_filter);
+                                                  const std::function<filter::selection_and_hilite>& hilite_filter,
+                                                  const core::rectangle& dirty);
 
         GUIPP_CTRL_EXPORT void draw_table_row (draw::graphics& graph,
                                                const core::rectangle& place,
@@ -242,7 +266,12 @@ namespace gui {
                                                const data::vector<os::color>& backgrounds,
                                                const std::function<cell_drawer>& drawer,
                                                const std::function<filter::selection_and_hilite>& selection_filter,
-                                               const std::function<filter::selection_and_hilite>& hilite_filter);
+                                               const std::function<filter::selection_and_hilite>& hilite_filter,
+                                               const core::rectangle& dirty);
+
+        /// The part of place that needs to be painted in this paint event.
+        GUIPP_CTRL_EXPORT core::rectangle get_dirty_area (const draw::graphics& graph,
+                                                          const core::rectangle& place);
       } // namespace look
 
       // --------------------------------------------------------------------------
@@ -325,6 +354,12 @@ namespace gui {
 
         table::position get_index_at_point (const core::point& pt) const;
 
+        /// The area of the cells from first to last, including both, empty for an invalid range.
+        core::rectangle get_cells_area (const table::position& first, const table::position& last) const;
+
+        /// Invalidate the area of the cells from first to last, including both.
+        void invalidate_cells (const table::position& first, const table::position& last) const;
+
       private:
         void init ();
       };
@@ -344,6 +379,9 @@ namespace gui {
 
         table::position get_index_at_point (const core::point& pt) const;
 
+        core::rectangle get_cells_area (int first, int last) const;
+        void invalidate_cells (int first, int last) const;
+
       private:
         void init ();
       };
@@ -363,6 +401,9 @@ namespace gui {
 
         table::position get_index_at_point (const core::point& pt) const;
 
+        core::rectangle get_cells_area (int first, int last) const;
+        void invalidate_cells (int first, int last) const;
+
       private:
         void init ();
       };
@@ -420,6 +461,14 @@ namespace gui {
 
       void make_selection_visible ();
 
+      /// Repaint only the data cells from first to last, e.g. after their values changed.
+      void invalidate_cells (const table::position& first, const table::position& last);
+      void invalidate_cell (const table::position& cell);
+
+      /// True while the default hilite filters are used, then a hilite change
+      /// repaints only the cells it left and entered, otherwise all cells.
+      bool has_default_hilite_filters () const;
+
       void set_selection_adjustment (core::selection_adjustment);
       core::selection_adjustment get_selection_adjustment () const;
 
@@ -467,6 +516,21 @@ namespace gui {
     protected:
       table::position get_valid_selection (const table::offset&) const;
       void redraw_all ();
+      void scroll_all (const core::point& previous_offset);
+      void redraw_hilite (const table::position& old_hilite);
+
+    public:
+      /// The areas of the data, column and row views a hilite move repaints.
+      struct hilite_damage {
+        std::vector<core::rectangle> data;
+        std::vector<core::rectangle> columns;
+        std::vector<core::rectangle> rows;
+      };
+
+      /// The damage of a hilite move from old_hilite to the current hilite with the default filters.
+      hilite_damage get_hilite_damage (const table::position& old_hilite) const;
+
+    protected:
 
       bool enable_v_size;
       bool enable_h_size;
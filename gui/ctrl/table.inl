@@ -72,19 +72,27 @@ namespace gui {
           default_data = data;
         }
 
+        inline uint64_t cell_key (const position& cell) {
+          return (static_cast<uint64_t>(static_cast<uint32_t>(cell.x())) << 32) | static_cast<uint32_t>(cell.y());
+        }
+
         // --------------------------------------------------------------------------
         template<typename T>
         inline matrix<T>::matrix (const T& default_data)
-          : column_data(default_data)
-          , row_data(default_data)
+          : default_data(default_data)
+          , rows(0)
+          , stamp(0)
         {}
 
         template<typename T>
         auto matrix<T>::get_cell (const position &cell) const->const T &{
-          if (cell.x() < data.size()) {
-            const std::vector<T>& c = data[cell.x()];
-            if (cell.y() < c.size()) {
-              return c[cell.y()];
+          if ((cell.x() >= 0) && (cell.x() < data.size())) {
+            const cells& c = data[cell.x()];
+            if (!c.empty()) {
+              auto i = c.find(cell.y());
+              if (i != c.end()) {
+                return i->second;
+              }
             }
           }
           return get_column_row_cell(cell);
@@ -92,24 +100,19 @@ namespace gui {
 
         template<typename T>
         void matrix<T>::set_cell (const position& cell, const T& t) {
-          const std::size_t data_size = data.size();
-          if (data_size <= cell.x()) {
+          if (data.size() <= cell.x()) {
             data.resize(cell.x() + 1);
           }
-          std::vector<T>& c = data[cell.x()];
-          const int rows = static_cast<int>(c.size());
-          if (rows <= cell.y()) {
-            c.resize(cell.y() + 1, column_data.get(cell.x()));
-            for (int r = rows; r < cell.y(); ++r) {
-              c[r] = get_column_row_cell(position(cell.x(), r));
-            }
-          }
-          c[cell.y()] = t;
+          data[cell.x()][cell.y()] = t;
+          rows = std::max(rows, cell.y() + 1);
         }
 
         template<typename T>
         void matrix<T>::set_column (std::size_t column, const T& t) {
-          column_data[column] = t;
+          if (column_data.size() <= column) {
+            column_data.resize(column + 1, {default_data, 0});
+          }
+          column_data[column] = {t, ++stamp};
           if (column < data.size()) {
             data[column].clear();
           }
@@ -117,16 +120,11 @@ namespace gui {
 
         template<typename T>
         void matrix<T>::set_row (std::size_t row, const T& t) {
-          row_data[row] = t;
-          for (std::vector<T>& column : data) {
-            if (row < column.size()) {
-              column[row] = t;
-            }
-          }
-          const int column_data_size = static_cast<int>(column_data.size());
-          for (int c = 0; c < column_data_size; ++c) {
-            set_cell(position(c, static_cast<int>(row)), t);
+          row_data[static_cast<int>(row)] = {t, ++stamp};
+          for (cells& c : data) {
+            c.erase(static_cast<int>(row));
           }
+          rows = std::max(rows, static_cast<int>(row) + 1);
         }
 
         template<typename T>
@@ -134,29 +132,35 @@ namespace gui {
           data.clear();
           column_data.clear();
           row_data.clear();
+          rows = 0;
+          stamp = 0;
         }
 
         template<typename T>
         inline auto matrix<T>::size () const->position {
-          return position {column_data.size(), row_data.size()};
+          return position {static_cast<int>(std::max(column_data.size(), data.size())), rows};
         }
 
         template<typename T>
         inline auto matrix<T>::get_default_data () const->const T &{
-          return column_data.get_default_data();
+          return default_data;
         }
 
         template<typename T>
         inline void matrix<T>::set_default_data (const T& data) {
-          column_data.set_default_data(data);
+          default_data = data;
         }
 
         template<typename T>
         inline auto matrix<T>::get_column_row_cell (const position &cell) const->const T &{
-          if (cell.x() < column_data.size()) {
-            return column_data[cell.x()];
+          const stamped* c = ((cell.x() >= 0) && (cell.x() < column_data.size())) ? &column_data[cell.x()] : nullptr;
+          if (!row_data.empty()) {
+            auto i = row_data.find(cell.y());
+            if ((i != row_data.end()) && (!c || (i->second.stamp > c->stamp))) {
+              return i->second.value;
+            }
           }
-          return row_data[cell.y()];
+          return (c && c->stamp) ? c->value : default_data;
         }
 
         // --------------------------------------------------------------------------
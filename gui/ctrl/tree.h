@@ -20,12 +20,17 @@
 //
 // Common includes
 //
+#include <map>
 #include <set>
+#include <functional>
+#include <type_traits>
 
 // --------------------------------------------------------------------------
 //
 // Library includes
 //
+#include "gui/core/pending_update.h"
+#include "gui/win/window_event_proc.h"
 #include "gui/ctrl/list.h"
 #include "gui/ctrl/look/tree.h"
 
@@ -52,6 +57,57 @@ namespace gui {
                         has_children, is_open, state);
       }
 
+      namespace detail {
+
+        // --------------------------------------------------------------------------
+        /**
+         * Tree infos load their sub nodes synchronous by default.
+         * An info with a static constexpr bool async_loading = true provides
+         * is_loaded, load_sub_nodes, cancel_load, pin and invalidate; the tree shows a
+         * placeholder for an open node until load_sub_nodes calls ready on the main
+         * thread. Open nodes are pinned, the sub nodes of a closed node are invalidated.
+         */
+        template<typename I, typename = void>
+        struct sub_nodes_loader {
+          static bool is_loaded (const I&, const typename I::type&) {
+            return true;
+          }
+
+          static void load (I&, const win::window&, const typename I::type&, std::function<void()>&&, bool) {}
+
+          static void cancel (I&, const typename I::type&) {}
+
+          static void pin (I&, const typename I::type&) {}
+
+          static void release (I&, const typename I::type&) {}
+        };
+
+        template<typename I>
+        struct sub_nodes_loader<I, typename std::enable_if<I::async_loading>::type> {
+          static bool is_loaded (const I& info, const typename I::type& n) {
+            return info.is_loaded(n);
+          }
+
+          static void load (I& info, const win::window& target, const typename I::type& n,
+                            std::function<void()>&& ready, bool prefetch) {
+            info.load_sub_nodes(target, n, std::move(ready), prefetch);
+          }
+
+          static void cancel (I& info, const typename I::type& n) {
+            info.cancel_load(n);
+          }
+
+          static void pin (I& info, const typename I::type& n) {
+            info.pin(n);
+          }
+
+          static void release (I& info, const typename I::type& n) {
+            info.invalidate(n);
+          }
+        };
+
+      } // namespace detail
+
       // --------------------------------------------------------------------------
       template<typename I>
       class basic_tree : public vertical_list {
@@ -62,6 +118,10 @@ namespace gui {
         typedef typename tree_info::type type;
         typedef typename tree_info::reference reference;
         typedef typename tree_info::list_type roots_list_type;
+        typedef detail::sub_nodes_loader<tree_info> loader;
+
+        /// Sub nodes of just loaded nodes that are loaded in advance.
+        static constexpr std::size_t prefetch_count = 8;
 
         void set_root (const type& root);
         void set_root (type&& root);
@@ -100,6 +160,7 @@ namespace gui {
 
         void select_node (const reference);
 
+        /// Rebuild the whole list of visible nodes.
         void update_node_list ();
         void collect_children (const type& n, std::size_t depth = 0);
 
@@ -115,15 +176,40 @@ namespace gui {
       private:
         roots_list_type roots;
 
+        // position of each visible node in the node list.
+        typedef std::map<reference, int> index_map;
+
         struct depth_info {
-          depth_info (reference ref, std::size_t depth);
+          depth_info (reference ref, std::size_t depth, int parent, bool pending = false);
 
           reference ref;
           std::size_t depth;
+          int parent;
+          // placeholder for the sub nodes of parent while they are loading.
+          bool pending;
+          // false for placeholders and for a reference already shown at an other position.
+          bool indexed;
+          typename index_map::iterator index;
         };
 
         typedef std::vector<depth_info> node_list;
 
+        void collect_visible (node_list& list, const type& n, std::size_t depth, int parent, int base);
+        void add_indices (int first, int last);
+        void move_indices (int first, int delta);
+        void expand_at (int idx);
+        void collapse_at (int idx);
+        int index_of (const reference) const;
+        bool is_pending (int idx) const;
+        void nodes_changed ();
+
+        void request_sub_nodes (const type& n, bool prefetch);
+        void prefetch_sub_nodes (const type& n);
+        void sub_nodes_loaded (const reference);
+        void splice_loaded ();
+        void get_load_range (int& first, int& last) const;
+        void update_visible_loads ();
+
         typedef std::set<reference> node_set;
 
         struct tree_data : public list_data {
@@ -143,9 +229,17 @@ namespace gui {
           }
 
           node_list nodes;
+          index_map indices;
           node_set open_nodes;
+          node_set loading_nodes;
+          // loaded nodes whose placeholders are not replaced yet.
+          node_set loaded_nodes;
           tree_info info;
+          // open_all opens the nodes loaded afterwards, too.
+          bool open_loaded = false;
         } data;
+
+        core::pending_update splice_request;
       };
 
       // --------------------------------------------------------------------------
@@ -92,7 +92,8 @@ namespace gui {
       template<typename I>
       void basic_tree<I>::init () {
         set_root(type());
-        super::set_data(data);
+        // the list draws from the tree data itself, changes need no copy.
+        super::set_data(std::cref(data));
         super::on_selection_commit([&]() {
           toggle_node(super::get_selection().get_first_index());
         });
@@ -117,10 +118,8 @@ namespace gui {
               int idx = super::get_selection().get_first_index();
               if (is_valid_idx(idx)) {
                 const reference ref = get_item(idx);
-                auto i = data.open_nodes.find(ref);
-                if (i != data.open_nodes.end()) {
-                  data.open_nodes.erase(i);
-                  update_node_list();
+                if (data.is_open(ref)) {
+                  close_node(idx);
                 } else {
                   idx = get_parent_item_of(idx);
                   close_node(idx);
@@ -135,6 +134,12 @@ namespace gui {
               break;
           }
         });
+        super::on_scroll([&] (core::point::type) {
+          update_visible_loads();
+        });
+        super::on_size([&] (const core::size&) {
+          update_visible_loads();
+        });
       }
 
       template<typename I>
@@ -166,6 +171,7 @@ namespace gui {
       template<typename I>
       inline void basic_tree<I>::open_all () {
         data.open_nodes.clear();
+        data.open_loaded = true;
         for (const auto& root : roots) {
           open_sub(root);
         }
@@ -181,53 +187,76 @@ namespace gui {
 
       template<typename I>
       inline void basic_tree<I>::open_sub (const type& n) {
-        data.open_nodes.insert(tree_info::make_reference(n));
-        for (const auto& i : info().sub_nodes(n)) {
-          open_sub(i);
+        // leaves are never drawn open, keep them out of the set.
+        if (info().has_sub_nodes(n)) {
+          data.open_nodes.insert(tree_info::make_reference(n));
+          // not loaded nodes open their sub nodes when they arrive.
+          if (loader::is_loaded(info(), n)) {
+            for (const auto& i : info().sub_nodes(n)) {
+              open_sub(i);
+            }
+          }
         }
       }
 
       template<typename I>
       void basic_tree<I>::toggle_node (int idx) {
-        if (is_valid_idx(idx)) {
-          const reference ref = get_item(idx);
-          toggle_node(ref);
+        if (is_valid_idx(idx) && !is_pending(idx)) {
+          if (data.is_open(get_item(idx))) {
+            close_node(idx);
+          } else {
+            open_node(idx);
+          }
         }
       }
 
       template<typename I>
       void basic_tree<I>::open_node (int idx) {
-        if (is_valid_idx(idx)) {
+        if (is_valid_idx(idx) && !is_pending(idx)) {
           const reference ref = get_item(idx);
-          open_node(ref);
+          if (!data.is_open(ref)) {
+            data.open_nodes.emplace(ref);
+            expand_at(idx);
+            nodes_changed();
+          }
         }
       }
 
       template<typename I>
       void basic_tree<I>::close_node (int idx) {
+        if (is_pending(idx)) {
+          idx = data.nodes[idx].parent;
+        }
         if (is_valid_idx(idx)) {
+          data.open_loaded = false;
           const reference ref = get_item(idx);
-          close_node(ref);
+          auto i = data.open_nodes.find(ref);
+          if (i != data.open_nodes.end()) {
+            data.open_nodes.erase(i);
+            collapse_at(idx);
+            loader::release(info(), tree_info::dereference(ref));
+            nodes_changed();
+          }
         }
       }
 
       template<typename I>
       void basic_tree<I>::toggle_node (const reference ref) {
-        auto i = data.open_nodes.find(ref);
-        if (i != data.open_nodes.end()) {
-          data.open_nodes.erase(i);
+        if (data.is_open(ref)) {
+          close_node(ref);
         } else {
-          data.open_nodes.emplace(ref);
+          open_node(ref);
         }
-        update_node_list();
       }
 
       template<typename I>
       void basic_tree<I>::open_node (const reference ref) {
-        auto i = data.open_nodes.find(ref);
-        if (i == data.open_nodes.end()) {
+        const int idx = index_of(ref);
+        if (idx > -1) {
+          open_node(idx);
+        } else {
+          // not visible, the list does not change.
           data.open_nodes.emplace(ref);
-          update_node_list();
         }
       }
 
@@ -241,43 +270,306 @@ namespace gui {
 
       template<typename I>
       void basic_tree<I>::close_node (const reference ref) {
-        auto i = data.open_nodes.find(ref);
-        if (i != data.open_nodes.end()) {
-          data.open_nodes.erase(i);
-          update_node_list();
+        const int idx = index_of(ref);
+        if (idx > -1) {
+          close_node(idx);
+        } else if (data.open_nodes.erase(ref)) {
+          loader::release(info(), tree_info::dereference(ref));
         }
       }
 
       template<typename I>
       void basic_tree<I>::select_node (const reference ref) {
-        for (auto i = data.nodes.begin(), e = data.nodes.end(); i != e; ++i) {
-          if (i->ref == ref) {
-            super::set_selection(static_cast<int>(std::distance(data.nodes.begin(), i)), event_source::logic);
-            return;
-          }
+        const int idx = index_of(ref);
+        if (idx > -1) {
+          super::set_selection(idx, event_source::logic);
         }
       }
 
       template<typename I>
       void basic_tree<I>::update_node_list () {
         data.nodes.clear();
+        data.indices.clear();
         for (const auto& root : roots) {
           collect_children(root);
         }
-        super::set_data(data);
-        super::invalidate();
-        super::notify_content_changed();
+        nodes_changed();
       }
 
       template<typename I>
       void basic_tree<I>::collect_children (const type& n, std::size_t depth) {
+        const int first = size();
+        collect_visible(data.nodes, n, depth, -1, 0);
+        add_indices(first, size());
+        update_visible_loads();
+      }
+
+      template<typename I>
+      void basic_tree<I>::collect_visible (node_list& list, const type& n, std::size_t depth, int parent, int base) {
         auto ref = tree_info::make_reference(n);
-        data.nodes.emplace_back(depth_info(ref, depth));
+        const int self = base + static_cast<int>(list.size());
+        list.emplace_back(depth_info(ref, depth, parent));
         if (is_open(ref)) {
+          loader::pin(info(), n);
+          if (loader::is_loaded(info(), n)) {
+            for (const auto& i : info().sub_nodes(n)) {
+              collect_visible(list, i, depth + 1, self, base);
+            }
+          } else {
+            // the load is requested by update_visible_loads, if the placeholder is visible.
+            list.emplace_back(depth_info(ref, depth + 1, self, true));
+          }
+        }
+      }
+
+      template<typename I>
+      void basic_tree<I>::add_indices (int first, int last) {
+        for (int i = first; i < last; ++i) {
+          depth_info& n = data.nodes[i];
+          if (!n.pending) {
+            auto r = data.indices.emplace(n.ref, i);
+            n.indexed = r.second;
+            n.index = r.first;
+          }
+        }
+      }
+
+      template<typename I>
+      void basic_tree<I>::move_indices (int first, int delta) {
+        // the nodes from first on moved by delta, their parents too if they are behind the splice point.
+        const int splice = first - std::max(delta, 0);
+        for (auto i = data.nodes.begin() + first, e = data.nodes.end(); i != e; ++i) {
+          if (i->parent >= splice) {
+            i->parent += delta;
+          }
+          if (i->indexed) {
+            i->index->second += delta;
+          }
+        }
+      }
+
+      template<typename I>
+      void basic_tree<I>::expand_at (int idx) {
+        // splice the visible sub tree in behind the node, the rest of the list is kept.
+        node_list sub;
+        const depth_info& at = data.nodes[idx];
+        const std::size_t depth = at.depth + 1;
+        const type& n = tree_info::dereference(at.ref);
+        loader::pin(info(), n);
+        if (loader::is_loaded(info(), n)) {
           for (const auto& i : info().sub_nodes(n)) {
-            collect_children(i, depth + 1);
+            collect_visible(sub, i, depth, idx, idx + 1);
+          }
+        } else {
+          sub.emplace_back(depth_info(at.ref, depth, idx, true));
+          request_sub_nodes(n, false);
+        }
+        if (sub.empty()) {
+          return;
+        }
+        const int count = static_cast<int>(sub.size());
+        data.nodes.insert(data.nodes.begin() + idx + 1,
+                          std::make_move_iterator(sub.begin()),
+                          std::make_move_iterator(sub.end()));
+        // linear in the nodes behind the splice, like the vector insert above.
+        // Still far cheaper than update_node_list, which rebuilds the whole index map.
+        move_indices(idx + 1 + count, count);
+        add_indices(idx + 1, idx + 1 + count);
+        update_visible_loads();
+      }
+
+      template<typename I>
+      void basic_tree<I>::collapse_at (int idx) {
+        const std::size_t depth = data.nodes[idx].depth;
+        auto first = data.nodes.begin() + idx + 1;
+        auto last = first;
+        while ((last != data.nodes.end()) && (last->depth > depth)) {
+          ++last;
+        }
+        const int count = static_cast<int>(std::distance(first, last));
+        if (count == 0) {
+          return;
+        }
+        if (!data.loading_nodes.empty()) {
+          // loads of nodes that are no longer visible are not needed anymore.
+          for (auto i = first; i != last; ++i) {
+            auto l = data.loading_nodes.find(i->ref);
+            if (l != data.loading_nodes.end()) {
+              loader::cancel(info(), tree_info::dereference(i->ref));
+              data.loading_nodes.erase(l);
+            }
           }
         }
+        for (auto i = first; i != last; ++i) {
+          if (i->indexed) {
+            data.indices.erase(i->index);
+          }
+        }
+        data.nodes.erase(first, last);
+        // linear in the nodes behind the splice, like the vector erase above.
+        move_indices(idx + 1, -count);
+      }
+
+      template<typename I>
+      int basic_tree<I>::index_of (const reference ref) const {
+        auto i = data.indices.find(ref);
+        return (i != data.indices.end()) ? i->second : -1;
+      }
+
+      template<typename I>
+      bool basic_tree<I>::is_pending (int idx) const {
+        return is_valid_idx(idx) && data.nodes[idx].pending;
+      }
+
+      template<typename I>
+      void basic_tree<I>::request_sub_nodes (const type& n, bool prefetch) {
+        const reference ref = tree_info::make_reference(n);
+        if (data.loading_nodes.insert(ref).second) {
+          loader::load(info(), *this, n, [&, ref] () {
+            sub_nodes_loaded(ref);
+          }, prefetch);
+        }
+      }
+
+      template<typename I>
+      void basic_tree<I>::prefetch_sub_nodes (const type& n) {
+        std::size_t count = 0;
+        for (const auto& i : info().sub_nodes(n)) {
+          if (count >= prefetch_count) {
+            break;
+          }
+          if (info().has_sub_nodes(i) && !is_open(tree_info::make_reference(i)) && !loader::is_loaded(info(), i)) {
+            request_sub_nodes(i, true);
+            ++count;
+          }
+        }
+      }
+
+      template<typename I>
+      void basic_tree<I>::sub_nodes_loaded (const reference ref) {
+        data.loading_nodes.erase(ref);
+        if (data.open_loaded) {
+          for (const auto& i : info().sub_nodes(tree_info::dereference(ref))) {
+            if (info().has_sub_nodes(i)) {
+              data.open_nodes.insert(tree_info::make_reference(i));
+            }
+          }
+        }
+        data.loaded_nodes.insert(ref);
+        if (!super::is_valid()) {
+          // nothing is shown, there is no main loop to collect more loads.
+          splice_loaded();
+        } else if (splice_request.request()) {
+          // the loads that finish until then are spliced in one pass over the node list.
+          win::run_on_main(*this, splice_request.bind([&] () {
+            splice_loaded();
+          }));
+        }
+      }
+
+      template<typename I>
+      void basic_tree<I>::splice_loaded () {
+        node_set loaded;
+        loaded.swap(data.loaded_nodes);
+        // prefetched or closed nodes have no placeholder.
+        std::vector<reference> spliced;
+        for (const auto& ref : loaded) {
+          const int idx = index_of(ref);
+          if ((idx > -1) && is_pending(idx + 1)) {
+            spliced.push_back(ref);
+          }
+        }
+        if (spliced.empty()) {
+          return;
+        }
+
+        // replace the placeholders by the loaded sub nodes.
+        node_list nodes;
+        nodes.reserve(data.nodes.size());
+        std::vector<int> moved(data.nodes.size(), -1);
+        for (std::size_t i = 0, e = data.nodes.size(); i < e; ++i) {
+          depth_info& n = data.nodes[i];
+          const int parent = (n.parent > -1) ? moved[n.parent] : -1;
+          if (n.pending && (loaded.find(n.ref) != loaded.end())) {
+            for (const auto& sub : info().sub_nodes(tree_info::dereference(n.ref))) {
+              collect_visible(nodes, sub, n.depth, parent, 0);
+            }
+          } else {
+            moved[i] = static_cast<int>(nodes.size());
+            n.parent = parent;
+            nodes.emplace_back(std::move(n));
+          }
+        }
+        data.nodes.swap(nodes);
+
+        for (int i = 0, e = size(); i < e; ++i) {
+          depth_info& n = data.nodes[i];
+          if (n.indexed) {
+            n.index->second = i;
+          } else if (!n.pending) {
+            auto r = data.indices.emplace(n.ref, i);
+            n.indexed = r.second;
+            n.index = r.first;
+          }
+        }
+        update_visible_loads();
+        nodes_changed();
+
+        for (const auto& ref : spliced) {
+          prefetch_sub_nodes(tree_info::dereference(ref));
+        }
+      }
+
+      template<typename I>
+      void basic_tree<I>::get_load_range (int& first, int& last) const {
+        const auto item_size = super::get_item_size();
+        if (!super::is_valid() || (item_size <= 0)) {
+          // nothing is shown, all nodes are loaded.
+          first = 0;
+          last = size() - 1;
+          return;
+        }
+        // keep the loads one page above and below the visible nodes.
+        const int page = static_cast<int>(super::client_size().height() / item_size) + 1;
+        first = static_cast<int>(super::get_scroll_offset() / item_size) - page;
+        last = first + page * 3;
+      }
+
+      template<typename I>
+      void basic_tree<I>::update_visible_loads () {
+        if (data.nodes.empty()) {
+          return;
+        }
+        int first = 0, last = 0;
+        get_load_range(first, last);
+
+        for (auto i = data.loading_nodes.begin(); i != data.loading_nodes.end();) {
+          const int idx = index_of(*i);
+          if ((idx > -1) && is_pending(idx + 1) && ((idx + 1 < first) || (idx + 1 > last))) {
+            loader::cancel(info(), tree_info::dereference(*i));
+            i = data.loading_nodes.erase(i);
+          } else {
+            ++i;
+          }
+        }
+        // new placeholders and those that scrolled in again. A load may finish
+        // at once and change the node list, the requests are sent after the scan.
+        std::vector<reference> requests;
+        for (int idx = std::max(first, 0), end = std::min(last, size() - 1); idx <= end; ++idx) {
+          const depth_info& n = data.nodes[idx];
+          if (n.pending && (data.loaded_nodes.find(n.ref) == data.loaded_nodes.end())) {
+            requests.push_back(n.ref);
+          }
+        }
+        for (const auto& ref : requests) {
+          request_sub_nodes(tree_info::dereference(ref), false);
+        }
+      }
+
+      template<typename I>
+      void basic_tree<I>::nodes_changed () {
+        super::invalidate();
+        super::notify_content_changed();
       }
 
       template<typename I>
@@ -303,19 +595,18 @@ namespace gui {
       template<typename I>
       int basic_tree<I>::get_parent_item_of (int idx) {
         if (is_valid_idx(idx)) {
-          const std::size_t depth = data.nodes[idx].depth;
-          do {
-            --idx;
-          } while ((idx > -1) && (data.nodes[idx].depth >= depth));
-          return idx;
+          return data.nodes[idx].parent;
         }
         return -1;
       }
 
       template<typename I>
-      inline basic_tree<I>::depth_info::depth_info (reference ref, std::size_t depth)
+      inline basic_tree<I>::depth_info::depth_info (reference ref, std::size_t depth, int parent, bool pending)
         : ref(ref)
         , depth(depth)
+        , parent(parent)
+        , pending(pending)
+        , indexed(false)
       {}
 
       template<typename I>
@@ -330,6 +621,10 @@ namespace gui {
                                               const draw::brush& b,
                                               item_state state) const {
         const depth_info& i = nodes[idx];
+        if (i.pending) {
+          look::tree_node(g, r, b, i.depth, "...", nullptr, false, false, state);
+          return;
+        }
         const type& n = tree_info::dereference(i.ref);
         bool has_children = info.has_sub_nodes(n);
         tree_node_drawer<I>(g, r, b, n, i.depth,
@@ -0,0 +1,105 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     small pool of worker threads for background loads
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <algorithm>
+#include <logging/logger.h>
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include "gui/ctrl/worker_pool.h"
+
+
+namespace gui {
+
+  namespace ctrl {
+
+    // --------------------------------------------------------------------------
+    worker_pool& worker_pool::get () {
+      // lazy create static
+      static worker_pool pool;
+      return pool;
+    }
+
+    unsigned worker_pool::default_threads () {
+      return std::max(2U, std::min(4U, std::thread::hardware_concurrency()));
+    }
+
+    worker_pool::worker_pool (unsigned count)
+      : stop(false)
+    {
+      for (unsigned i = 0; i < count; ++i) {
+        threads.emplace_back(&worker_pool::run, this);
+      }
+    }
+
+    worker_pool::~worker_pool () {
+      {
+        std::lock_guard<std::mutex> lock(guard);
+        stop = true;
+      }
+      wakeup.notify_all();
+      for (auto& t : threads) {
+        t.join();
+      }
+    }
+
+    void worker_pool::push (job&& j, bool low) {
+      {
+        std::lock_guard<std::mutex> lock(guard);
+        if (low) {
+          low_jobs.emplace_back(std::move(j));
+        } else {
+          jobs.emplace_front(std::move(j));
+        }
+      }
+      wakeup.notify_one();
+    }
+
+    void worker_pool::run () {
+      for (;;) {
+        job j;
+        {
+          std::unique_lock<std::mutex> lock(guard);
+          wakeup.wait(lock, [&] () {
+            return stop || !jobs.empty() || !low_jobs.empty();
+          });
+          if (stop) {
+            return;
+          }
+          auto& q = jobs.empty() ? low_jobs : jobs;
+          j = std::move(q.front());
+          q.pop_front();
+        }
+        // a failing job must not end the worker thread.
+        try {
+          j();
+        } catch (std::exception& ex) {
+          logging::error() << "exception in worker_pool job: " << ex;
+        } catch (...) {
+          logging::error() << "Unknown exception in worker_pool job";
+        }
+      }
+    }
+
+  } // namespace ctrl
+
+} // namespace gui
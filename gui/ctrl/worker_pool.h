@@ -0,0 +1,78 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     small pool of worker threads for background loads
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include "gui/ctrl/gui++-ctrl-export.h"
+
+
+namespace gui {
+
+  namespace ctrl {
+
+    // --------------------------------------------------------------------------
+    /**
+     * A few threads that run jobs in the background.
+     * The latest normal job runs first, since that is the one the user waits
+     * for; low priority jobs, e.g. prefetches, run when no normal job waits.
+     * Jobs still waiting when the pool is destroyed are dropped, exceptions
+     * thrown by a job are logged.
+     */
+    class GUIPP_CTRL_EXPORT worker_pool {
+    public:
+      typedef std::function<void()> job;
+
+      static worker_pool& get ();
+
+      explicit worker_pool (unsigned threads = default_threads());
+      ~worker_pool ();
+
+      worker_pool (const worker_pool&) = delete;
+      worker_pool& operator= (const worker_pool&) = delete;
+
+      void push (job&& j, bool low = false);
+
+      static unsigned default_threads ();
+
+    private:
+      void run ();
+
+      std::mutex guard;
+      std::condition_variable wakeup;
+      std::deque<job> jobs;
+      std::deque<job> low_jobs;
+      std::vector<std::thread> threads;
+      bool stop;
+    };
+
+  } // namespace ctrl
+
+} // namespace gui
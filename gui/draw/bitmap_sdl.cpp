@@ -97,9 +97,11 @@ namespace gui {
 
     void copy_bitmap (draw::basic_map& lhs, const draw::basic_map& rhs) {
       auto renderer = core::native::sdl::get_font_renderer();
+      // keep the current target, it may be the back texture of a window in paint.
+      auto target = SDL_GetRenderTarget(renderer);
       SDL_SetRenderTarget(renderer, rhs.get_os_bitmap());
       SDL_RenderCopy(renderer, lhs.get_os_bitmap(), NULL, NULL);
-      SDL_SetRenderTarget(renderer, NULL);
+      SDL_SetRenderTarget(renderer, target);
     }
 
   } // namespace native
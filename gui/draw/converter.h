@@ -20,6 +20,11 @@
 //
 // Common includes
 //
+#include <algorithm>
+#include <cstdint>
+#ifdef __SSE2__
+# include <emmintrin.h>
+#endif // __SSE2__
 
 // --------------------------------------------------------------------------
 //
@@ -59,6 +64,33 @@ namespace gui {
 
     } // namespace format
 
+    // --------------------------------------------------------------------------
+    /**
+     * Word at a time kernels for 1 bit per pixel rows.
+     * Pixel positions are counted in the bit order O, rows are accessed bytewise
+     * and never beyond the last byte that contains a pixel of the range.
+     */
+    namespace bw {
+
+      template<core::bit_order_t O = core::os::bitmap_bit_order>
+      void fill (byte* row, uint32_t x0, uint32_t w, bool bit);
+
+      template<core::bit_order_t O = core::os::bitmap_bit_order>
+      void invert (byte* row, uint32_t x0, uint32_t w);
+
+      template<core::bit_order_t O = core::os::bitmap_bit_order>
+      void copy (const byte* src, uint32_t src_x0, byte* dst, uint32_t dst_x0, uint32_t w);
+
+      /// Set bit to set_bit where the gray value is above limit.
+      template<core::bit_order_t O = core::os::bitmap_bit_order>
+      void threshold (const byte* gray, byte* row, uint32_t w, byte limit, bool set_bit);
+
+      /// Write lut[bit] for each pixel.
+      template<typename T, core::bit_order_t O = core::os::bitmap_bit_order>
+      void expand (const byte* row, T* out, uint32_t w, const T (&lut)[2]);
+
+    } // namespace bw
+
     // --------------------------------------------------------------------------
     namespace copy {
 
@@ -25,6 +25,211 @@ namespace gui {
     //
     // inlines
     //
+    // --------------------------------------------------------------------------
+    namespace bw {
+
+      namespace detail {
+
+        // Pixel k of a 64 pixel word is at bit k (lsb first) or at bit 63 - k (msb first).
+        template<core::bit_order_t O>
+        struct word_order {};
+
+        template<>
+        struct word_order<core::bit_order_t::lsb_first> {
+          static inline uint64_t load (const byte* p, uint32_t n) {
+            uint64_t v = 0;
+            for (uint32_t i = 0; i < n; ++i) {
+              v |= static_cast<uint64_t>(p[i]) << (i * 8);
+            }
+            return v;
+          }
+
+          static inline void store (byte* p, uint64_t v, uint32_t n) {
+            for (uint32_t i = 0; i < n; ++i) {
+              p[i] = static_cast<byte>(v >> (i * 8));
+            }
+          }
+
+          /// mask of the first n pixels
+          static inline uint64_t head (uint32_t n) {
+            return n >= 64 ? ~uint64_t(0) : ((uint64_t(1) << n) - 1);
+          }
+
+          /// move pixels n positions towards the start
+          static inline uint64_t to_front (uint64_t v, uint32_t n) {
+            return n >= 64 ? 0 : v >> n;
+          }
+
+          /// move pixels n positions towards the end
+          static inline uint64_t to_back (uint64_t v, uint32_t n) {
+            return n >= 64 ? 0 : v << n;
+          }
+
+          static inline byte from_lsb (byte b) {
+            return b;
+          }
+
+          static inline uint32_t shift (uint32_t i) {
+            return i;
+          }
+        };
+
+        template<>
+        struct word_order<core::bit_order_t::msb_first> {
+          static inline uint64_t load (const byte* p, uint32_t n) {
+            uint64_t v = 0;
+            for (uint32_t i = 0; i < n; ++i) {
+              v |= static_cast<uint64_t>(p[i]) << (56 - i * 8);
+            }
+            return v;
+          }
+
+          static inline void store (byte* p, uint64_t v, uint32_t n) {
+            for (uint32_t i = 0; i < n; ++i) {
+              p[i] = static_cast<byte>(v >> (56 - i * 8));
+            }
+          }
+
+          static inline uint64_t head (uint32_t n) {
+            return n >= 64 ? ~uint64_t(0) : ~(~uint64_t(0) >> n);
+          }
+
+          static inline uint64_t to_front (uint64_t v, uint32_t n) {
+            return n >= 64 ? 0 : v << n;
+          }
+
+          static inline uint64_t to_back (uint64_t v, uint32_t n) {
+            return n >= 64 ? 0 : v >> n;
+          }
+
+          static inline byte from_lsb (byte b) {
+            return core::reverse_bit_order(b);
+          }
+
+          static inline uint32_t shift (uint32_t i) {
+            return 7 - i;
+          }
+        };
+
+        /// Calls f(byte* p, uint32_t nbytes, uint64_t mask, uint32_t first, uint32_t done)
+        /// for each word that contains pixels of [x0, x0 + w).
+        template<core::bit_order_t O, typename F>
+        inline void for_each_word (byte* row, uint32_t x0, uint32_t w, F f) {
+          using order = word_order<O>;
+          byte* p = row + x0 / 8;
+          uint32_t first = x0 % 8;
+          uint32_t done = 0;
+          while (done < w) {
+            const uint32_t n = std::min<uint32_t>(64 - first, w - done);
+            const uint32_t nbytes = (first + n + 7) / 8;
+            f(p, nbytes, order::head(first + n) & ~order::head(first), first, done);
+            p += 8;
+            first = 0;
+            done += n;
+          }
+        }
+
+        /// Pixels [x, x + n) of row at the start of a word, n <= 64.
+        template<core::bit_order_t O>
+        inline uint64_t extract (const byte* row, uint32_t x, uint32_t n) {
+          using order = word_order<O>;
+          const byte* p = row + x / 8;
+          const uint32_t offset = x % 8;
+          const uint32_t nbytes = (offset + n + 7) / 8;
+          if (nbytes <= 8) {
+            return order::to_front(order::load(p, nbytes), offset);
+          }
+          return order::to_front(order::load(p, 8), offset) | order::to_back(order::load(p + 8, 1), 64 - offset);
+        }
+
+      } // namespace detail
+
+      template<core::bit_order_t O>
+      void fill (byte* row, uint32_t x0, uint32_t w, bool bit) {
+        using order = detail::word_order<O>;
+        const uint64_t pattern = bit ? ~uint64_t(0) : 0;
+        detail::for_each_word<O>(row, x0, w, [&] (byte* p, uint32_t nbytes, uint64_t mask, uint32_t, uint32_t) {
+          const uint64_t v = order::load(p, nbytes);
+          order::store(p, (v & ~mask) | (pattern & mask), nbytes);
+        });
+      }
+
+      template<core::bit_order_t O>
+      void invert (byte* row, uint32_t x0, uint32_t w) {
+        using order = detail::word_order<O>;
+        detail::for_each_word<O>(row, x0, w, [&] (byte* p, uint32_t nbytes, uint64_t mask, uint32_t, uint32_t) {
+          order::store(p, order::load(p, nbytes) ^ mask, nbytes);
+        });
+      }
+
+      template<core::bit_order_t O>
+      void copy (const byte* src, uint32_t src_x0, byte* dst, uint32_t dst_x0, uint32_t w) {
+        using order = detail::word_order<O>;
+        detail::for_each_word<O>(dst, dst_x0, w, [&] (byte* p, uint32_t nbytes, uint64_t mask, uint32_t first, uint32_t done) {
+          const uint32_t n = std::min<uint32_t>(64 - first, w - done);
+          const uint64_t s = order::to_back(detail::extract<O>(src, src_x0 + done, n), first);
+          const uint64_t v = order::load(p, nbytes);
+          order::store(p, (v & ~mask) | (s & mask), nbytes);
+        });
+      }
+
+      template<core::bit_order_t O>
+      void threshold (const byte* gray, byte* row, uint32_t w, byte limit, bool set_bit) {
+        using order = detail::word_order<O>;
+        const byte invert = set_bit ? 0 : 0xff;
+        uint32_t x = 0;
+#ifdef __SSE2__
+        // unsigned compare by signed compare of the values with flipped sign bit.
+        const __m128i sign = _mm_set1_epi8(static_cast<char>(0x80));
+        const __m128i lim = _mm_set1_epi8(static_cast<char>(limit ^ 0x80));
+        for (; x + 16 <= w; x += 16) {
+          const __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(gray + x)), sign);
+          // bit i of the mask is pixel i.
+          const int m = _mm_movemask_epi8(_mm_cmpgt_epi8(v, lim));
+          row[x / 8] = order::from_lsb(static_cast<byte>(m)) ^ invert;
+          row[x / 8 + 1] = order::from_lsb(static_cast<byte>(m >> 8)) ^ invert;
+        }
+#endif // __SSE2__
+        for (; x + 8 <= w; x += 8) {
+          byte b = 0;
+          for (uint32_t i = 0; i < 8; ++i) {
+            b |= static_cast<byte>(limit < gray[x + i]) << order::shift(i);
+          }
+          row[x / 8] = b ^ invert;
+        }
+        if (x < w) {
+          // keep the padding bits of the last byte.
+          byte b = 0;
+          byte mask = 0;
+          for (uint32_t i = 0; x + i < w; ++i) {
+            b |= static_cast<byte>(limit < gray[x + i]) << order::shift(i);
+            mask |= byte(1) << order::shift(i);
+          }
+          row[x / 8] = (row[x / 8] & ~mask) | ((b ^ invert) & mask);
+        }
+      }
+
+      template<typename T, core::bit_order_t O>
+      void expand (const byte* row, T* out, uint32_t w, const T (&lut)[2]) {
+        using order = detail::word_order<O>;
+        uint32_t x = 0;
+        for (; x + 8 <= w; x += 8) {
+          const byte b = row[x / 8];
+          for (uint32_t i = 0; i < 8; ++i) {
+            out[x + i] = lut[(b >> order::shift(i)) & 1];
+          }
+        }
+        if (x < w) {
+          const byte b = row[x / 8];
+          for (uint32_t i = 0; x + i < w; ++i) {
+            out[x + i] = lut[(b >> order::shift(i)) & 1];
+          }
+        }
+      }
+
+    } // namespace bw
+
+    // --------------------------------------------------------------------------
     namespace format {
 
       template<pixel_format_t From>
@@ -79,6 +284,62 @@ namespace gui {
         }
       }
 
+      // --------------------------------------------------------------------------
+      template<pixel_format_t To>
+      struct line<pixel_format_t::BW, To> {
+        using pixel_type = typename draw::image_data<To>::pixel_type;
+
+        static void convert (const typename draw::image_data<pixel_format_t::BW>::const_row_type in,
+                             typename draw::image_data<To>::row_type out,
+                             uint32_t w) {
+          pixel_type lut[2];
+          lut[0] = static_cast<pixel::mono>(false);
+          lut[1] = static_cast<pixel::mono>(true);
+          bw::expand(in.data(0, 0), out.data(0, 0), w, lut);
+        }
+
+        static void mask (const typename draw::image_data<pixel_format_t::BW>::const_row_type in,
+                          typename draw::image_data<To>::row_type out,
+                          uint32_t w, pixel::gray limit) {
+          for (uint_fast32_t x = 0; x < w; ++x) {
+            out[x] = gui::color::system_bw_colors::value[check_limit(in[x], limit)];
+          }
+        }
+      };
+
+      template<>
+      struct line<pixel_format_t::BW, pixel_format_t::BW> {
+        static inline void convert (const typename draw::image_data<pixel_format_t::BW>::const_row_type in,
+                                    typename draw::image_data<pixel_format_t::BW>::row_type out,
+                                    uint32_t w) {
+          bw::copy(in.data(0, 0), 0, out.data(0, 0), 0, w);
+        }
+
+        static inline void mask (const typename draw::image_data<pixel_format_t::BW>::const_row_type in,
+                                 typename draw::image_data<pixel_format_t::BW>::row_type out,
+                                 uint32_t w, pixel::gray) {
+          bw::copy(in.data(0, 0), 0, out.data(0, 0), 0, w);
+        }
+      };
+
+      template<>
+      struct line<pixel_format_t::GRAY, pixel_format_t::BW> {
+        static inline void convert (const typename draw::image_data<pixel_format_t::GRAY>::const_row_type in,
+                                    typename draw::image_data<pixel_format_t::BW>::row_type out,
+                                    uint32_t w) {
+          // get_bw: below 128 is black
+          bw::threshold(reinterpret_cast<const byte*>(in.data(0, 0)), out.data(0, 0), w,
+                        127, static_cast<bool>(pixel::mono::white));
+        }
+
+        static inline void mask (const typename draw::image_data<pixel_format_t::GRAY>::const_row_type in,
+                                 typename draw::image_data<pixel_format_t::BW>::row_type out,
+                                 uint32_t w, pixel::gray limit) {
+          bw::threshold(reinterpret_cast<const byte*>(in.data(0, 0)), out.data(0, 0), w,
+                        limit.value, static_cast<bool>(pixel::mono::white));
+        }
+      };
+
       template<pixel_format_t From, pixel_format_t To>
       void convert (const typename draw::image_data<From> in,
                     draw::image_data<To> out,
@@ -110,6 +371,13 @@ namespace gui {
         }
       }
 
+      template<>
+      inline void row<pixel_format_t::BW> (const typename draw::image_data<pixel_format_t::BW>::const_row_type src,
+                                           typename draw::image_data<pixel_format_t::BW>::row_type dst,
+                                           uint32_t src_x0, uint32_t dest_x0, uint32_t w) {
+        bw::copy(src.data(0, 0), src_x0, dst.data(0, 0), dest_x0, w);
+      }
+
       template<pixel_format_t px_fmt>
       void sub (const typename draw::image_data<px_fmt> src_data,
                 draw::image_data<px_fmt> dest_data,
@@ -469,6 +737,12 @@ namespace gui {
         }
       }
 
+      template<>
+      inline void row<pixel_format_t::BW, pixel::mono> (typename draw::image_data<pixel_format_t::BW>::row_type data,
+                                                        uint32_t w, const pixel::mono& px) {
+        bw::fill(data.data(0, 0), 0, w, static_cast<bool>(px));
+      }
+
       template<pixel_format_t px_fmt, typename pixel_type>
       void fill (draw::image_data<px_fmt> data, uint32_t w, uint32_t h, const pixel_type& px) {
         for (uint_fast32_t y = 0; y < h; ++y) {
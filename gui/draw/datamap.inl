@@ -248,6 +248,13 @@ namespace gui {
       auto data = access();
       byte* in = data.data(0, sz);
       const byte* end = in + sz;
+      // word at a time, memcpy avoids unaligned access.
+      for (; in + sizeof(uint64_t) <= end; in += sizeof(uint64_t)) {
+        uint64_t w;
+        memcpy(&w, in, sizeof(w));
+        w = ~w;
+        memcpy(in, &w, sizeof(w));
+      }
       while (in < end) {
         *in = ~(*in);
         ++in;
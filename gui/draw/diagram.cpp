@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <map>
 #include <math.h>
+#include <cmath>
 
 // --------------------------------------------------------------------------
 //
@@ -36,6 +37,96 @@ namespace gui {
 
     namespace diagram {
 
+      namespace detail {
+
+        // --------------------------------------------------------------------------
+        std::vector<core::point>& point_buffer () {
+          thread_local std::vector<core::point> buffer;
+          buffer.clear();
+          return buffer;
+        }
+
+        int pixel_column (core::point::type x) {
+          return static_cast<int>(std::floor(x * core::global::get_scale_factor()));
+        }
+
+        void decimate_columns (std::vector<core::point>& pts, std::size_t offset) {
+          const std::size_t sz = pts.size();
+          if (sz <= offset + 4) {
+            return;
+          }
+          std::size_t out = offset;
+          std::size_t i = offset;
+          while (i < sz) {
+            const int column = pixel_column(pts[i].x());
+            std::size_t last = i;
+            std::size_t min_i = i;
+            std::size_t max_i = i;
+            while ((last + 1 < sz) && (pixel_column(pts[last + 1].x()) == column)) {
+              ++last;
+              if (pts[last].y() < pts[min_i].y()) {
+                min_i = last;
+              }
+              if (pts[last].y() > pts[max_i].y()) {
+                max_i = last;
+              }
+            }
+            // keep first, min, max and last in their original order.
+            const core::point first_pt = pts[i];
+            const core::point min_pt = pts[min_i];
+            const core::point max_pt = pts[max_i];
+            const core::point last_pt = pts[last];
+            pts[out++] = first_pt;
+            if (min_i < max_i) {
+              if ((min_i != i) && (min_i != last)) {
+                pts[out++] = min_pt;
+              }
+              if ((max_i != i) && (max_i != last)) {
+                pts[out++] = max_pt;
+              }
+            } else {
+              if ((max_i != i) && (max_i != last)) {
+                pts[out++] = max_pt;
+              }
+              if ((min_i != i) && (min_i != last)) {
+                pts[out++] = min_pt;
+              }
+            }
+            if (last != i) {
+              pts[out++] = last_pt;
+            }
+            i = last + 1;
+          }
+          pts.resize(out);
+        }
+
+        // --------------------------------------------------------------------------
+        pixel_mask::pixel_mask (const core::rectangle& r)
+          : area(core::global::scale_to_native(r))
+          , bits([] () -> std::vector<bool>& {
+              thread_local std::vector<bool> buffer;
+              return buffer;
+            }())
+        {
+          bits.assign(static_cast<std::size_t>(area.width()) * area.height(), false);
+        }
+
+        bool pixel_mask::test_and_set (const core::point& pt) {
+          const auto x = static_cast<int>(std::floor(pt.x() * core::global::get_scale_factor())) - area.x();
+          const auto y = static_cast<int>(std::floor(pt.y() * core::global::get_scale_factor())) - area.y();
+          if ((x < 0) || (y < 0) || (x >= static_cast<int>(area.width())) || (y >= static_cast<int>(area.height()))) {
+            return true;
+          }
+          const std::size_t idx = static_cast<std::size_t>(y) * area.width() + x;
+          if (bits[idx]) {
+            return false;
+          }
+          bits[idx] = true;
+          return true;
+        }
+
+      } // namespace detail
+
       // --------------------------------------------------------------------------
       circle::circle (float radius)
         : radius(radius)
@@ -23,6 +23,7 @@
 #include <array>
 #include <iomanip>
 #include <functional>
+#include <vector>
 #include <util/ostreamfmt.h>
 
 
@@ -375,6 +376,38 @@ namespace gui {
       template<typename SX, typename SY>
       xy_axis<SX, SY> mk_xy_axis (const SX& sx, const SY& sy);
 
+      namespace detail {
+
+        // --------------------------------------------------------------------------
+        /// Per thread point buffer, cleared but with its capacity kept between paints.
+        GUIPP_DRAW_EXPORT std::vector<core::point>& point_buffer ();
+
+        /// Native pixel column of a logical x coordinate.
+        GUIPP_DRAW_EXPORT int pixel_column (core::point::type x);
+
+        /**
+         * Reduce each run of consecutive points in the same pixel column
+         * (starting at offset) to first, min, max and last point.
+         * The result covers the same pixels as the original polyline.
+         */
+        GUIPP_DRAW_EXPORT void decimate_columns (std::vector<core::point>& pts, std::size_t offset = 0);
+
+        // --------------------------------------------------------------------------
+        /// Marks native pixels inside an area that are already painted.
+        class GUIPP_DRAW_EXPORT pixel_mask {
+        public:
+          explicit pixel_mask (const core::rectangle& area);
+
+          /// returns true if the pixel was not set before.
+          bool test_and_set (const core::point& pt);
+
+        private:
+          core::native_rect area;
+          std::vector<bool>& bits;
+        };
+
+      } // namespace detail
+
       // --------------------------------------------------------------------------
       template<typename X,
                typename Y,
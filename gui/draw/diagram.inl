@@ -735,8 +735,9 @@ namespace gui {
       template<typename X, typename Y, typename C, scaling SX, scaling SY, typename IX, typename IY, typename T>
       void line_graph<X, Y, C, SX, SY, IX, IY, T>::operator() (graphics& g, const pen& p) const {
         clip clp(g, super::get_graph_area());
-        std::vector<core::point> pts;
+        auto& pts = detail::point_buffer();
         calc_points(pts);
+        detail::decimate_columns(pts);
         g.frame(draw::polyline(pts), p);
       }
 
@@ -744,7 +745,7 @@ namespace gui {
       void line_graph<X, Y, C, SX, SY, IX, IY, T>::operator() (graphics& g, const brush& b) const {
         clip clp(g, super::get_graph_area());
 
-        std::vector<core::point> pts;
+        auto& pts = detail::point_buffer();
 
         const auto sz = super::points.size();
         pts.reserve(sz+2);
@@ -755,6 +756,7 @@ namespace gui {
 
         pts.push_back({ x0, y0 });
         calc_points(pts);
+        detail::decimate_columns(pts, 1);
         pts.push_back({ x1, y0 });
 
         g.fill(draw::polygon(pts), b);
@@ -792,16 +794,18 @@ namespace gui {
       template<typename X, typename Y, typename C, scaling SX, scaling SY, typename IX, typename IY, typename T>
       void cascade<X, Y, C, SX, SY, IX, IY, T>::operator() (graphics& g, const pen& p) const {
         clip clp(g, super::get_graph_area());
-        std::vector<core::point> pts;
+        auto& pts = detail::point_buffer();
         calc_points(pts);
+        detail::decimate_columns(pts);
         g.frame(draw::polyline(pts), p);
       }
 
       template<typename X, typename Y, typename C, scaling SX, scaling SY, typename IX, typename IY, typename T>
       void cascade<X, Y, C, SX, SY, IX, IY, T>::operator() (graphics& g, const brush& b) const {
         clip clp(g, super::get_graph_area());
-        std::vector<core::point> pts;
+        auto& pts = detail::point_buffer();
         calc_points(pts);
+        detail::decimate_columns(pts);
         g.fill(draw::polygon(pts), b);
       }
 
@@ -846,11 +850,30 @@ namespace gui {
         const auto sz = super::points.size();
         const auto w = std::max<T>(T(1), T((super::sx.get_target().end() - super::sx.get_target().begin()) / (sz * 2) - space));
         const auto y0 = super::sy(0);
+        // Bars in the same pixel column are merged to one rectangle.
+        int column = 0;
+        T x_first = 0, x_last = 0, y_min = 0, y_max = 0;
         for (int i = 0; i < sz; ++i) {
           const auto pt = super::points[i];
           const auto x = super::sx(get_x<X>(pt));
           const auto y = super::sy(get_y<Y>(pt));
-          g.fill(draw::rectangle(core::point(x - w, y0), core::point(x + w, y)), b);
+          const int c = detail::pixel_column(x);
+          if ((i > 0) && (c == column)) {
+            x_last = x;
+            y_min = std::min<T>(y_min, y);
+            y_max = std::max<T>(y_max, y);
+          } else {
+            if (i > 0) {
+              g.fill(draw::rectangle(core::point(x_first - w, y_min), core::point(x_last + w, y_max)), b);
+            }
+            column = c;
+            x_first = x_last = x;
+            y_min = std::min<T>(y0, y);
+            y_max = std::max<T>(y0, y);
+          }
+        }
+        if (sz > 0) {
+          g.fill(draw::rectangle(core::point(x_first - w, y_min), core::point(x_last + w, y_max)), b);
         }
       }
 
@@ -875,13 +898,17 @@ namespace gui {
       template<typename X, typename Y, typename C, scaling SX, scaling SY, typename IX, typename IY, typename T>
       void points_graph<X, Y, C, SX, SY, IX, IY, T>::operator() (graphics& g, const brush& b) const {
         if (drawer) {
-          clip clp(g, super::get_graph_area());
+          const auto area = super::get_graph_area();
+          clip clp(g, area);
+          // Points on an already painted pixel would paint the same marker again.
+          detail::pixel_mask painted(area);
           const auto sz = super::points.size();
           for (std::size_t i = 0; i < sz; ++i) {
             const auto pt = super::points[i];
-            const auto x = super::sx(get_x<X>(pt));
-            const auto y = super::sy(get_y<Y>(pt));
-            drawer(g, b, core::point(x, y));
+            const core::point p(super::sx(get_x<X>(pt)), super::sy(get_y<Y>(pt)));
+            if (painted.test_and_set(p)) {
+              drawer(g, b, p);
+            }
           }
         }
       }
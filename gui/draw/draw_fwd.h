@@ -34,6 +34,7 @@ namespace gui {
     class bitmap;
     class pixmap;
     class masked_bitmap;
+    struct atlas_region;
 #ifdef GUIPP_USE_XSHM
     class shared_datamap;
 #endif // GUIPP_USE_XSHM
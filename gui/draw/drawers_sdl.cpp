@@ -38,6 +38,7 @@
 #include "gui/draw/brush.h"
 #include "gui/draw/font.h"
 #include "gui/draw/use.h"
+#include "gui/draw/tessellation.h"
 
 #include "SDL2_gfxPrimitives.h"
 
@@ -135,59 +136,74 @@ namespace gui {
       return (lhs.x == rhs.x) && (lhs.y == rhs.y);
     }
 
-    int draw_sdl_filed_polygone (SDL_Renderer* renderer, const std::vector<os::point>& pts, Uint32 color) {
-      const int cnt = pts.size();
-      if ((cnt == 3) || ((cnt == 4) && (pts[0] == pts[3]))) {
-        SDL_Color clr = mk_sdl_color(color);
-        SDL_Vertex vertices[3];
-        vertices[0] = {{ pts[0].x, pts[0].y }, clr, {0, 0} };
-        vertices[1] = {{ pts[1].x, pts[1].y }, clr, {0, 0} };
-        vertices[2] = {{ pts[2].x, pts[2].y }, clr, {0, 0} };
-        int indices[3] = { 0, 1, 2 };
-        return SDL_RenderGeometry(renderer, nullptr, vertices, 3, indices, 3);
-      } else {
-        // SDL_Color clr = mk_sdl_color(color);
-        // SDL_SetRenderDrawColor(renderer, clr.r, clr.g, clr.b, clr.a);
-        // return SDL_RenderDrawLinesF(renderer, pts.data(), pts.size());
-        std::vector<Sint16> vx(cnt);
-        std::vector<Sint16> vy(cnt);
-
-        for (int i = 0; i < cnt; ++i) {
-          vx[i] = pts[i].x;
-          vy[i] = pts[i].y;
-        }
-        return filledPolygonColor(renderer, vx.data(), vy.data(), cnt, color);
+    typedef tessellation::mesh<os::point> sdl_mesh;
+
+    // drawing is done on the main thread only, the buffers keep their capacity between calls.
+    sdl_mesh& get_scratch_mesh () {
+      static sdl_mesh mesh;
+      mesh.clear();
+      return mesh;
+    }
+
+    int render_sdl_mesh (SDL_Renderer* renderer, const sdl_mesh& mesh, Uint32 color) {
+      if (mesh.empty()) {
+        return 0;
       }
+      static std::vector<SDL_Vertex> vertices;
 
+      const SDL_Color clr = mk_sdl_color(color);
+      const auto count = mesh.points.size();
+      vertices.resize(count);
+      for (std::size_t i = 0; i < count; ++i) {
+        vertices[i] = { mesh.points[i], clr, {0, 0} };
+      }
+      return SDL_RenderGeometry(renderer, nullptr,
+                                vertices.data(), static_cast<int>(count),
+                                mesh.indices.data(), static_cast<int>(mesh.indices.size()));
     }
 
-    void thickPolylineColor (SDL_Renderer* renderer, const std::vector<os::point>& pts, Uint8 width, Uint32 color) {
-      bool first = true;
-      os::point p0;
-      for (const auto& pt : pts) {
-        if (first) {
-          first = false;
-        } else {
-          draw_sdl_line(renderer, p0, pt, width, color);
+    int draw_sdl_filed_polygone (SDL_Renderer* renderer, const std::vector<os::point>& pts, Uint32 color) {
+      if (tessellation::is_convex(pts.data(), pts.size())) {
+        auto& mesh = get_scratch_mesh();
+        tessellation::triangulate(pts.data(), pts.size(), mesh);
+        return render_sdl_mesh(renderer, mesh, color);
+      }
+      // concave or self intersecting, the gfx scanline fill handles any outline.
+      const int cnt = static_cast<int>(pts.size());
+      std::vector<Sint16> vx(cnt);
+      std::vector<Sint16> vy(cnt);
+
+      for (int i = 0; i < cnt; ++i) {
+        vx[i] = static_cast<Sint16>(pts[i].x);
+        vy[i] = static_cast<Sint16>(pts[i].y);
+      }
+      return filledPolygonColor(renderer, vx.data(), vy.data(), cnt, color);
+    }
+
+    void thickPolylineColor (SDL_Renderer* renderer, const std::vector<os::point>& pts, Uint8 width, Uint32 color, bool closed = false) {
+      if (width < 2) {
+        SDL_Color clr = mk_sdl_color(color);
+        SDL_SetRenderDrawColor(renderer, clr.r, clr.g, clr.b, clr.a);
+        SDL_RenderDrawLinesF(renderer, pts.data(), pts.size());
+        if (closed && (pts.size() > 2)) {
+          SDL_RenderDrawLineF(renderer, pts.back().x, pts.back().y, pts.front().x, pts.front().y);
         }
-        p0 = pt;
+        return;
       }
+      auto& mesh = get_scratch_mesh();
+      tessellation::stroke(pts.data(), pts.size(), width, closed, mesh);
+      render_sdl_mesh(renderer, mesh, color);
     }
 
     void thickEllipseColor (graphics& g, Sint16 x, Sint16 y, Sint16 rx, Sint16 ry, Uint8 width, Uint32 color) {
-      auto outer = arc_coords({(float)x, (float)y}, {(float)(rx + width / 2), (float)(ry + width / 2)}, 0, 360).calc_arc_os_points(g.context());
       if (width < 2) {
+        auto outer = arc_coords({(float)x, (float)y}, {(float)(rx + width / 2), (float)(ry + width / 2)}, 0, 360).calc_arc_os_points(g.context());
         SDL_Color clr = mk_sdl_color(color);
         SDL_SetRenderDrawColor(g, clr.r, clr.g, clr.b, clr.a);
         SDL_RenderDrawLinesF(g, outer.data(), outer.size());
       } else {
-        auto irx = (float)(rx - width / 2);
-        auto iry = (float)(ry - width / 2);
-        if ((irx > 0) && (iry > 0)) {
-          auto inner = arc_coords({(float)x, (float)y}, {irx, iry}, 0, 360).calc_arc_os_points(g.context());
-          outer.insert(outer.end(), inner.rbegin(), inner.rend());
-        }
-        draw_sdl_filed_polygone(g, outer, color);
+        auto center = arc_coords({(float)x, (float)y}, {(float)rx, (float)ry}, 0, 360).calc_arc_os_points(g.context());
+        thickPolylineColor(g, center, width, color, true);
       }
     }
 
@@ -268,19 +284,20 @@ namespace gui {
       const float w = radius.os_width();
       const float h = radius.os_height();
 
-      thickLineColor(g, r.x + w,    r.y,       r.x + r.w - w, r.y,           p.os_size(), p.color());
-      thickLineColor(g, r.x + w,    r.y + r.h, r.x + r.w - w, r.y + r.h,     p.os_size(), p.color());
-      thickLineColor(g, r.x,        r.y + h,   r.x,           r.y + r.h - h, p.os_size(), p.color());
-      thickLineColor(g, r.x + r.w,  r.y + h,   r.x + r.w,     r.y + r.h - h, p.os_size(), p.color());
+      // the four corner arcs in order, the straight edges are the gaps between them.
+      std::vector<os::point> outline;
+      const std::array<arc_coords, 4> corners = {
+        arc_coords({r.x + r.w - w, r.y + h},       {w, h}, 0, 90),
+        arc_coords({r.x + w, r.y + h},             {w, h}, 90, 180),
+        arc_coords({r.x + w, r.y + r.h - h},       {w, h}, 180, 270),
+        arc_coords({r.x + r.w - w, r.y + r.h - h}, {w, h}, 270, 360)
+      };
+      for (const auto& c : corners) {
+        const auto pts = c.calc_arc_os_points(g.context());
+        outline.insert(outline.end(), pts.begin(), pts.end());
+      }
 
-      arc_coords tr({(float)(r.x + r.w - w), (float)(r.y + h)}, {w, h}, 0, 90);
-      thickArcColor(g, tr, p.os_size(), p.color());
-      arc_coords tl({(float)(r.x + w), (float)(r.y + h)}, {w, h}, 90, 180);
-      thickArcColor(g, tl, p.os_size(), p.color());
-      arc_coords bl({(float)(r.x + w), (float)(r.y + r.h - h)}, {w, h}, 180, 270);
-      thickArcColor(g, bl, p.os_size(), p.color());
-      arc_coords br({(float)(r.x + r.w - w), (float)(r.y + r.h - h)}, {w, h}, 270, 360);
-      thickArcColor(g, br, p.os_size(), p.color());
+      thickPolylineColor(g, outline, p.os_size(), p.color(), true);
     }
 
     void round_rectangle::operator() (graphics& g,
@@ -382,7 +399,7 @@ namespace gui {
 
     void polygon::operator() (graphics& g,
                               const pen& p) const {
-      thickPolylineColor(g, convert(g, true), p.os_size(), p.color());
+      thickPolylineColor(g, convert(g, false), p.os_size(), p.color(), true);
     }
 
     void polygon::operator() (graphics& g,
@@ -33,6 +33,7 @@
 #include "gui/draw/pen.h"
 #include "gui/draw/brush.h"
 #include "gui/draw/use.h"
+#include "gui/draw/pixmap_atlas.h"
 
 
 namespace gui {
@@ -121,6 +122,17 @@ namespace gui {
       return copy_from(bmp, core::native_point(pt.os(context()), context()));
     }
 
+    graphics& graphics::copy_from (const draw::atlas_region& r, const core::point& pt) {
+      return copy_from(r, core::native_point(pt.os(context()), context()));
+    }
+
+    graphics& graphics::copy_from (const draw::atlas_region& r, const core::native_point& pt) {
+      if (r) {
+        copy_from(r.atlas->get_page(r.page), r.rect, pt);
+      }
+      return *this;
+    }
+
     graphics& graphics::copy_from (const draw::pixmap& bmp, const core::native_point& pt) {
       return copy_from(bmp, core::native_rect(bmp.native_size()), pt);
     }
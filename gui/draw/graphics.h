@@ -108,6 +108,11 @@ namespace gui {
       
       graphics& copy_from (const draw::masked_bitmap&, const core::point& dest);
       graphics& copy_from (const draw::masked_bitmap&, const core::native_point& dest = core::native_point::zero);
+      graphics& copy_from (const draw::masked_bitmap&, const core::native_rect& src,
+                           const core::native_point& dest = core::native_point::zero);
+
+      graphics& copy_from (const draw::atlas_region&, const core::point& dest);
+      graphics& copy_from (const draw::atlas_region&, const core::native_point& dest = core::native_point::zero);
 
       graphics& copy_from (os::drawable, const core::rectangle& src,
                            const core::point& dest = core::point::zero,
@@ -114,6 +114,15 @@ namespace gui {
       return *this;
     }
 
+    graphics& graphics::copy_from (const draw::masked_bitmap& bmp, const core::native_rect& src, const core::native_point& pt) {
+      os().call<void>("save");
+      copy_from(bmp.mask.get_os_bitmap(), src, pt, copy_mode::bit_copy);
+      os().call<void>("globalCompositeOperation", std::string("source-in"));
+      copy_from(bmp.image.get_os_bitmap(), src, pt, copy_mode::bit_copy);
+      os().call<void>("restore");
+      return *this;
+    }
+
     graphics& graphics::copy_from (os::drawable src,
                                    const core::native_rect& r,
                                    const core::native_point& pt,
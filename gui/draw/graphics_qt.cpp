@@ -100,7 +100,12 @@ namespace gui {
         if (p) {
           const QPainter::CompositionMode oldMode = gc()->compositionMode();
           gc()->setCompositionMode(static_cast<QPainter::CompositionMode>(mode));
-          gc()->drawPixmap(pt.x(), pt.y(), *p);
+          if (p == gc()->device()) {
+            // a painter can not draw its own device, copy the part first.
+            gc()->drawPixmap(pt.x(), pt.y(), p->copy(r.x(), r.y(), r.width(), r.height()));
+          } else {
+            gc()->drawPixmap(pt.x(), pt.y(), *p, r.x(), r.y(), r.width(), r.height());
+          }
           gc()->setCompositionMode(oldMode);
         }
       }
@@ -122,6 +127,22 @@ namespace gui {
       return *this;
     }
 
+    graphics& graphics::copy_from (const draw::masked_bitmap& bmp, const core::native_rect& src, const core::native_point& pt) {
+      if (bmp.image) {
+        if (bmp.mask) {
+          QRegion clip(*(const QBitmap*)bmp.mask.get_os_bitmap());
+          clip.translate(pt.x() - src.x(), pt.y() - src.y());
+          gc()->setClipRegion(clip);
+        }
+        gc()->drawPixmap(pt.x(), pt.y(), *bmp.image.get_os_bitmap(),
+                         src.x(), src.y(), src.width(), src.height());
+        if (bmp.mask) {
+          gc()->setClipping(false);
+        }
+      }
+      return *this;
+    }
+
     graphics& graphics::copy_from (const draw::pixmap& bmp, const core::rectangle& src, const core::point& pt) {
       if (bmp) {
         const auto r = core::global::scale_to_native(src);
@@ -85,6 +85,10 @@ namespace gui {
       return copy_from(bmp.image, core::native_rect(bmp.image.native_size()), pt);
     }
 
+    graphics& graphics::copy_from (const draw::masked_bitmap& bmp, const core::native_rect& src, const core::native_point& pt) {
+      return copy_from(bmp.image, src, pt);
+    }
+
     graphics& graphics::copy_from (os::drawable src,
                                    const core::native_rect& r,
                                    const core::native_point& pt,
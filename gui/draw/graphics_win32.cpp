@@ -186,6 +186,26 @@ namespace gui {
       return *this;
     }
 
+    graphics& graphics::copy_from (const draw::masked_bitmap& bmp,
+                                   const core::native_rect& src,
+                                   const core::native_point& pt) {
+      if (bmp.mask) {
+        HDC dc = CreateCompatibleDC(gc());
+        SelectObject(dc, bmp.mask.get_os_bitmap());
+        BitBlt(gc(), pt.x(), pt.y(), src.width(), src.height(), dc, src.x(), src.y(),
+               static_cast<int>(copy_mode::bit_and));
+        if (bmp.image) {
+          SelectObject(dc, bmp.image.get_os_bitmap());
+          BitBlt(gc(), pt.x(), pt.y(), src.width(), src.height(), dc, src.x(), src.y(),
+                 static_cast<int>(copy_mode::bit_or));
+        }
+        DeleteDC(dc);
+      } else {
+        copy_from(bmp.image, src, pt);
+      }
+      return *this;
+    }
+
     void graphics::invert (const core::rectangle& r) {
       RECT rect = r.os(context());
       InvertRect(gc(), &rect);
@@ -267,6 +267,22 @@ namespace gui {
       return *this;
     }
 
+    graphics& graphics::copy_from (const draw::masked_bitmap& bmp, const core::native_rect& src, const core::native_point& pt) {
+      if (!bmp.image) {
+        return *this;
+      }
+      auto display = core::global::get_instance();
+      if (bmp.mask) {
+        XSetClipMask(display, gc(), bmp.mask.get_os_bitmap());
+        XSetClipOrigin(display, gc(), pt.x() - src.x(), pt.y() - src.y());
+      }
+      XCopyArea(display, bmp.image, target(), gc(), src.x(), src.y(), src.width(), src.height(), pt.x(), pt.y());
+      if (bmp.mask) {
+        XSetClipMask(display, gc(), None);
+      }
+      return *this;
+    }
+
 #ifdef GUIPP_USE_XSHM
     graphics& graphics::copy_from (const draw::shared_datamap& bmp, const core::native_point& pt) {
       return copy_from(bmp, core::native_rect(bmp.native_size()), pt);
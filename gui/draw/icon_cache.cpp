@@ -0,0 +1,201 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     cache for pre-rasterized icon drawings
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <cmath>
+#include <tuple>
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include "gui/draw/icon_cache.h"
+#include "gui/draw/graphics.h"
+
+
+namespace gui {
+
+  namespace draw {
+
+    namespace {
+
+      inline auto tie_key (const icon_cache_key& k) {
+        return std::tie(k.type, k.radius, k.color, k.pen_size, k.style, k.cap, k.join, k.scale);
+      }
+
+    }
+
+    // --------------------------------------------------------------------------
+    icon_cache_key::icon_cache_key (icon_type type, const pen& pn, core::size::type radius)
+      : type(type)
+      , radius(radius)
+      , color(pn.color())
+      , pen_size(pn.size())
+      , style(pn.style())
+      , cap(pn.cap())
+      , join(pn.join())
+      , scale(core::global::get_scale_factor())
+    {}
+
+    bool icon_cache_key::operator< (const icon_cache_key& rhs) const {
+      return tie_key(*this) < tie_key(rhs);
+    }
+
+    bool icon_cache_key::operator== (const icon_cache_key& rhs) const {
+      return tie_key(*this) == tie_key(rhs);
+    }
+
+    // --------------------------------------------------------------------------
+    double icon_cache::statistics::hit_rate () const {
+      const auto total = hits + misses;
+      return total ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+    }
+
+    // --------------------------------------------------------------------------
+    icon_cache::icon_cache ()
+      : max_bytes(4 * 1024 * 1024)
+      , bytes(0)
+      , hits(0)
+      , misses(0)
+      , evictions(0)
+    {}
+
+    // lazy create static
+    icon_cache& icon_cache::get () {
+      static icon_cache c;
+      return c;
+    }
+
+    core::size::type icon_cache::margin (const pen& pn) {
+      return std::ceil(pn.size()) + 1;
+    }
+
+    void icon_cache::draw (graphics& g, icon_type type, const pen& pn,
+                           const core::point& center, core::size::type radius) {
+      if (type == icon_type::none) {
+        return;
+      }
+      if (type == icon_type::background) {
+        // draws with its own fixed colors, a single colored mask can not represent it.
+        draw_icon(g, type, pn, center, radius);
+        return;
+      }
+      const auto offset = radius + margin(pn);
+      std::lock_guard<std::mutex> lock(guard);
+      const masked_bitmap& bmp = lookup(icon_cache_key(type, pn, radius), pn);
+      g.copy_from(bmp, center - core::point(offset, offset));
+    }
+
+    void icon_cache::prewarm (const std::vector<icon_type>& types, const pen& pn,
+                              core::size::type radius) {
+      std::lock_guard<std::mutex> lock(guard);
+      for (auto type : types) {
+        lookup(icon_cache_key(type, pn, radius), pn);
+      }
+    }
+
+    void icon_cache::set_max_bytes (std::size_t b) {
+      std::lock_guard<std::mutex> lock(guard);
+      max_bytes = b;
+      shrink();
+    }
+
+    std::size_t icon_cache::get_max_bytes () const {
+      std::lock_guard<std::mutex> lock(guard);
+      return max_bytes;
+    }
+
+    void icon_cache::clear () {
+      std::lock_guard<std::mutex> lock(guard);
+      index.clear();
+      entries.clear();
+      bytes = 0;
+    }
+
+    auto icon_cache::get_statistics () const -> statistics {
+      std::lock_guard<std::mutex> lock(guard);
+      return {hits, misses, evictions, entries.size(), bytes};
+    }
+
+    void icon_cache::reset_statistics () {
+      std::lock_guard<std::mutex> lock(guard);
+      hits = misses = evictions = 0;
+    }
+
+    const masked_bitmap& icon_cache::lookup (const icon_cache_key& key, const pen& pn) {
+      auto i = index.find(key);
+      if (i != index.end()) {
+        ++hits;
+        // move to front, the list iterator stays valid.
+        entries.splice(entries.begin(), entries, i->second);
+        return i->second->second;
+      }
+      ++misses;
+      entries.emplace_front(key, rasterize(key, pn));
+      index[key] = entries.begin();
+      bytes += bytes_of(entries.front().second);
+      shrink();
+      return entries.front().second;
+    }
+
+    void icon_cache::shrink () {
+      // Keep at least the most recent entry, it may just be in use.
+      while ((bytes > max_bytes) && (entries.size() > 1)) {
+        const entry& last = entries.back();
+        bytes -= bytes_of(last.second);
+        index.erase(last.first);
+        entries.pop_back();
+        ++evictions;
+      }
+    }
+
+    masked_bitmap icon_cache::rasterize (const icon_cache_key& key, const pen& pn) {
+      const auto offset = key.radius + margin(pn);
+      const core::size sz(offset * 2, offset * 2);
+      const core::point center(offset, offset);
+
+      pixmap shape(sz);
+      {
+        graphics g(shape);
+        g.clear(color::black);
+        draw_icon(g, key.type, pn.with_color(color::white), center, key.radius);
+      }
+      bitmap mask(shape.get_mask({0x7F}));
+
+      pixmap image(sz);
+      graphics(image).clear(key.color);
+
+      return masked_bitmap(std::move(image), std::move(mask));
+    }
+
+    std::size_t icon_cache::bytes_of (const masked_bitmap& bmp) {
+      const auto sz = bmp.native_size();
+      const std::size_t pixels = static_cast<std::size_t>(sz.width()) * sz.height();
+      return pixels * ((bmp.image.depth() + 7) / 8) + (pixels + 7) / 8;
+    }
+
+    // --------------------------------------------------------------------------
+    void draw_cached_icon (graphics& g, icon_type type, const pen& pn,
+                           const core::point& center, core::size::type radius) {
+      icon_cache::get().draw(g, type, pn, center, radius);
+    }
+
+  } //namespace draw
+
+} //namespace gui
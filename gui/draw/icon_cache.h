@@ -0,0 +1,155 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     cache for pre-rasterized icon drawings
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <list>
+#include <map>
+#include <mutex>
+#include <vector>
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include "gui/draw/icons.h"
+#include "gui/draw/pen.h"
+#include "gui/draw/bitmap.h"
+#include "gui/draw/gui++-draw-export.h"
+
+
+namespace gui {
+
+  namespace draw {
+
+    // --------------------------------------------------------------------------
+    struct GUIPP_DRAW_EXPORT icon_cache_key {
+      icon_cache_key (icon_type type, const pen& pn, core::size::type radius);
+
+      bool operator< (const icon_cache_key& rhs) const;
+      bool operator== (const icon_cache_key& rhs) const;
+
+      icon_type type;
+      core::size::type radius;
+      os::color color;
+      pen::size_type pen_size;
+      pen::Style style;
+      pen::Cap cap;
+      pen::Join join;
+      double scale;
+    };
+
+    // --------------------------------------------------------------------------
+    /**
+     * Process wide cache of masked bitmaps with pre-rasterized icons.
+     * Entries are created on first use and evicted in least recently used order
+     * when the memory footprint exceeds the configured limit.
+     */
+    class GUIPP_DRAW_EXPORT icon_cache {
+    public:
+      struct statistics {
+        std::size_t hits;
+        std::size_t misses;
+        std::size_t evictions;
+        std::size_t entries;
+        std::size_t bytes;
+
+        double hit_rate () const;
+      };
+
+      static icon_cache& get ();
+
+      void draw (graphics& g, icon_type type, const pen& pn,
+                 const core::point& center, core::size::type radius);
+
+      void prewarm (const std::vector<icon_type>& types, const pen& pn,
+                    core::size::type radius);
+
+      void set_max_bytes (std::size_t bytes);
+      std::size_t get_max_bytes () const;
+
+      void clear ();
+
+      statistics get_statistics () const;
+      void reset_statistics ();
+
+      static core::size::type margin (const pen& pn);
+
+    private:
+      icon_cache ();
+
+      typedef std::pair<icon_cache_key, masked_bitmap> entry;
+      typedef std::list<entry> entry_list;
+
+      const masked_bitmap& lookup (const icon_cache_key& key, const pen& pn);
+      void shrink ();
+
+      static masked_bitmap rasterize (const icon_cache_key& key, const pen& pn);
+      static std::size_t bytes_of (const masked_bitmap&);
+
+      mutable std::mutex guard;
+      entry_list entries;
+      std::map<icon_cache_key, entry_list::iterator> index;
+      std::size_t max_bytes;
+      std::size_t bytes;
+      std::size_t hits;
+      std::size_t misses;
+      std::size_t evictions;
+    };
+
+    // --------------------------------------------------------------------------
+    GUIPP_DRAW_EXPORT void draw_cached_icon (graphics& g, icon_type type, const pen& pn,
+                                             const core::point& center, core::size::type radius);
+
+    // --------------------------------------------------------------------------
+    template<icon_type I>
+    struct cached_icon_t : public detail::icon_base {
+      typedef detail::icon_base super;
+
+      inline cached_icon_t (const core::point& center, core::size::type radius)
+        : super(center, radius)
+      {}
+
+      inline void operator() (graphics& g, const pen& pn) const {
+        draw_cached_icon(g, I, pn, center, radius);
+      }
+
+    };
+
+    // --------------------------------------------------------------------------
+    struct cached_icon : public detail::icon_base {
+      typedef detail::icon_base super;
+
+      inline cached_icon (icon_type type, const core::point& center, core::size::type radius)
+        : super(center, radius)
+        , type(type)
+      {}
+
+      inline void operator() (graphics& g, const pen& pn) const {
+        draw_cached_icon(g, type, pn, center, radius);
+      }
+
+    private:
+      icon_type type;
+    };
+
+  } //namespace draw
+
+} //namespace gui
@@ -0,0 +1,181 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     pack small masked images into few native pixmaps
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <algorithm>
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include "gui/draw/pixmap_atlas.h"
+#include "gui/draw/graphics.h"
+
+
+namespace gui {
+
+  namespace draw {
+
+    // --------------------------------------------------------------------------
+    shelf_packer::shelf_packer (const core::native_size& area)
+      : size(area)
+      , next_y(0)
+      , used(0)
+    {}
+
+    bool shelf_packer::insert (const core::native_size& sz, core::native_point& pos) {
+      if ((sz.width() > size.width()) || (sz.height() > size.height())) {
+        return false;
+      }
+      // the lowest shelf with room wastes the fewest rows.
+      shelf* best = nullptr;
+      for (auto& s : shelves) {
+        if ((s.height >= sz.height()) && (s.x + sz.width() <= size.width()) &&
+            (!best || (s.height < best->height))) {
+          best = &s;
+        }
+      }
+      if (!best) {
+        if (next_y + sz.height() > size.height()) {
+          return false;
+        }
+        shelves.push_back({next_y, sz.height(), 0});
+        next_y += sz.height();
+        best = &shelves.back();
+      }
+      pos = core::native_point(best->x, best->y);
+      best->x += sz.width();
+      used += static_cast<std::size_t>(sz.width()) * sz.height();
+      return true;
+    }
+
+    void shelf_packer::clear () {
+      shelves.clear();
+      next_y = 0;
+      used = 0;
+    }
+
+    const core::native_size& shelf_packer::area () const {
+      return size;
+    }
+
+    std::size_t shelf_packer::used_pixels () const {
+      return used;
+    }
+
+    // --------------------------------------------------------------------------
+    atlas_region::atlas_region ()
+      : atlas(nullptr)
+      , page(0)
+    {}
+
+    atlas_region::atlas_region (const pixmap_atlas* atlas, uint32_t page, const core::native_rect& rect)
+      : atlas(atlas)
+      , page(page)
+      , rect(rect)
+    {}
+
+    core::native_size atlas_region::native_size () const {
+      return rect.size();
+    }
+
+    core::size atlas_region::scaled_size () const {
+      return core::global::scale_from_native(native_size());
+    }
+
+    bool atlas_region::is_valid () const {
+      return atlas != nullptr;
+    }
+
+    atlas_region::operator bool () const {
+      return is_valid();
+    }
+
+    // --------------------------------------------------------------------------
+    pixmap_atlas::page::page (const core::native_size& sz)
+      : image(sz)
+      , mask(sz)
+      , packer(sz)
+    {}
+
+    pixmap_atlas::pixmap_atlas (uint32_t page_size)
+      : page_size(page_size)
+    {}
+
+    atlas_region pixmap_atlas::add (const rgbmap& img, const bwmap& mask) {
+      const auto sz = img.native_size();
+      if (sz.empty()) {
+        return {};
+      }
+      std::lock_guard<std::mutex> lock(guard);
+      core::native_point pos;
+      uint32_t i = 0;
+      for (; i < pages.size(); ++i) {
+        if (pages[i].packer.insert(sz, pos)) {
+          break;
+        }
+      }
+      if (i == pages.size()) {
+        pages.emplace_back(core::native_size(std::max(page_size, sz.width()), std::max(page_size, sz.height())));
+        pages.back().packer.insert(sz, pos);
+      }
+      page& p = pages[i];
+      const core::native_rect src(sz);
+      p.image.copy_from(img, src, pos);
+      p.mask.copy_from(mask, src, pos);
+      const core::native_rect r(pos, sz);
+      if (p.changed.empty()) {
+        p.changed = r;
+      } else {
+        p.changed |= r;
+      }
+      return atlas_region(this, i, r);
+    }
+
+    const masked_bitmap& pixmap_atlas::get_page (uint32_t i) const {
+      std::lock_guard<std::mutex> lock(guard);
+      page& p = pages[i];
+      if (!p.native) {
+        p.native = masked_bitmap(pixmap(p.image), bitmap(p.mask));
+      } else if (!p.changed.empty()) {
+        // images added after the first draw, e.g. while the image cache is prewarmed.
+        const auto& r = p.changed;
+        const masked_bitmap part(pixmap(p.image.sub(r.x(), r.y(), r.width(), r.height())),
+                                 bitmap(p.mask.sub(r.x(), r.y(), r.width(), r.height())));
+        const core::native_rect src(r.size());
+        graphics(p.native.image).copy_from(part.image, src, r.position());
+        graphics(p.native.mask).copy_from(part.mask, src, r.position());
+      }
+      p.changed = core::native_rect::zero;
+      return p.native;
+    }
+
+    std::size_t pixmap_atlas::page_count () const {
+      std::lock_guard<std::mutex> lock(guard);
+      return pages.size();
+    }
+
+    void pixmap_atlas::clear () {
+      std::lock_guard<std::mutex> lock(guard);
+      pages.clear();
+    }
+
+  } // namespace draw
+
+} // namespace gui
@@ -0,0 +1,134 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     pack small masked images into few native pixmaps
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <deque>
+#include <mutex>
+#include <vector>
+
+// --------------------------------------------------------------------------
+//
+// Library includes
+//
+#include "gui/core/rectangle.h"
+#include "gui/draw/draw_fwd.h"
+#include "gui/draw/datamap.h"
+#include "gui/draw/bitmap.h"
+#include "gui/draw/gui++-draw-export.h"
+
+
+namespace gui {
+
+  namespace draw {
+
+    // --------------------------------------------------------------------------
+    /**
+     * Shelf packing of rectangles into a fixed area.
+     * A rectangle is placed on the lowest shelf it fits in, or opens a new shelf
+     * below the last one.
+     */
+    class GUIPP_DRAW_EXPORT shelf_packer {
+    public:
+      explicit shelf_packer (const core::native_size& area);
+
+      /// Returns false if there is no room left for sz.
+      bool insert (const core::native_size& sz, core::native_point& pos);
+
+      void clear ();
+
+      const core::native_size& area () const;
+      std::size_t used_pixels () const;
+
+    private:
+      struct shelf {
+        uint32_t y;
+        uint32_t height;
+        uint32_t x;
+      };
+
+      core::native_size size;
+      std::vector<shelf> shelves;
+      uint32_t next_y;
+      std::size_t used;
+    };
+
+    class pixmap_atlas;
+
+    // --------------------------------------------------------------------------
+    /// Place of one image inside an atlas page.
+    struct GUIPP_DRAW_EXPORT atlas_region {
+      atlas_region ();
+      atlas_region (const pixmap_atlas* atlas, uint32_t page, const core::native_rect& rect);
+
+      core::native_size native_size () const;
+      core::size scaled_size () const;
+
+      bool is_valid () const;
+      operator bool () const;
+
+      const pixmap_atlas* atlas;
+      uint32_t page;
+      core::native_rect rect;
+    };
+
+    // --------------------------------------------------------------------------
+    /**
+     * Many small masked images in a few native masked bitmaps.
+     * Adding only touches the memory copy of a page and may be done from any
+     * thread. The native page is created on the main thread at its first draw,
+     * later draws upload only the part changed since then.
+     * Images larger than a page get a page of their own.
+     */
+    class GUIPP_DRAW_EXPORT pixmap_atlas {
+    public:
+      static constexpr uint32_t default_page_size = 256;
+
+      explicit pixmap_atlas (uint32_t page_size = default_page_size);
+
+      atlas_region add (const rgbmap& img, const bwmap& mask);
+
+      /// Main thread only.
+      const masked_bitmap& get_page (uint32_t page) const;
+
+      std::size_t page_count () const;
+
+      void clear ();
+
+    private:
+      struct page {
+        explicit page (const core::native_size& sz);
+
+        rgbmap image;
+        bwmap mask;
+        shelf_packer packer;
+        masked_bitmap native;
+        // part of the memory copy that is not yet in native.
+        core::native_rect changed;
+      };
+
+      const uint32_t page_size;
+      mutable std::mutex guard;
+      mutable std::deque<page> pages;
+    };
+
+  } // namespace draw
+
+} // namespace gui
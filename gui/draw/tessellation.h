@@ -0,0 +1,80 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     polygon triangulation and stroke tessellation
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <cstddef>
+#include <vector>
+
+
+namespace gui {
+
+  namespace draw {
+
+    namespace tessellation {
+
+      // --------------------------------------------------------------------------
+      /**
+       * Triangles to render a shape in one geometry call.
+       * P is any point type with float members x and y, that can be created by P{x, y}.
+       * Keep a mesh over several calls to reuse the allocated buffers.
+       */
+      template<typename P>
+      struct mesh {
+        std::vector<P> points;
+        std::vector<int> indices;
+
+        void clear ();
+        bool empty () const;
+      };
+
+      // --------------------------------------------------------------------------
+      /**
+       * True if the polygon is convex and winds once around its inside, so a
+       * fan of triangles covers it. False for concave, self intersecting and
+       * degenerated polygons.
+       */
+      template<typename P>
+      bool is_convex (const P* pts, std::size_t count);
+
+      /**
+       * Append the triangles of the filled polygon to the indices of m.
+       * The indices refer to pts, which are copied to m.points.
+       * Convex polygons are fanned, others are ear clipped.
+       * Self intersecting polygons are filled approximately.
+       */
+      template<typename P>
+      void triangulate (const P* pts, std::size_t count, mesh<P>& m);
+
+      /**
+       * Append the triangles of a polyline with the given width to m.
+       * Joins are mitered as long as the miter tip stays within the width, else beveled.
+       * Open lines get pointed caps, like a single thick line.
+       */
+      template<typename P>
+      void stroke (const P* pts, std::size_t count, float width, bool closed, mesh<P>& m);
+
+    } // namespace tessellation
+
+  } // namespace draw
+
+} // namespace gui
+
+#include "gui/draw/tessellation.inl"
@@ -0,0 +1,306 @@
+/**
+ * @copyright (c) 2016-2021 Ing. Buero Rothfuss
+ *                          Riedlinger Str. 8
+ *                          70327 Stuttgart
+ *                          Germany
+ *                          http://www.rothfuss-web.de
+ *
+ * @author    <a href="mailto:armin@rothfuss-web.de">Armin Rothfuss</a>
+ *
+ * Project    gui++ lib
+ *
+ * @brief     polygon triangulation and stroke tessellation
+ *
+ * @license   MIT license. See accompanying file LICENSE.
+ */
+
+#pragma once
+
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <cmath>
+
+
+namespace gui {
+
+  namespace draw {
+
+    namespace tessellation {
+
+      namespace detail {
+
+        template<typename P>
+        inline float cross (const P& a, const P& b, const P& c) {
+          return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+        }
+
+        template<typename P>
+        inline bool equal (const P& a, const P& b) {
+          return (a.x == b.x) && (a.y == b.y);
+        }
+
+        template<typename P>
+        inline bool inside_triangle (const P& p, const P& a, const P& b, const P& c, float sign) {
+          return (cross(a, b, p) * sign >= 0) &&
+                 (cross(b, c, p) * sign >= 0) &&
+                 (cross(c, a, p) * sign >= 0);
+        }
+
+        template<typename P>
+        inline P offset (const P& p, float dx, float dy) {
+          return P{p.x + dx, p.y + dy};
+        }
+
+        template<typename P>
+        void add_triangle (mesh<P>& m, int a, int b, int c) {
+          m.indices.push_back(a);
+          m.indices.push_back(b);
+          m.indices.push_back(c);
+        }
+
+        template<typename P>
+        int add_point (mesh<P>& m, const P& p) {
+          m.points.push_back(p);
+          return static_cast<int>(m.points.size() - 1);
+        }
+
+      } // namespace detail
+
+      // --------------------------------------------------------------------------
+      template<typename P>
+      inline void mesh<P>::clear () {
+        points.clear();
+        indices.clear();
+      }
+
+      template<typename P>
+      inline bool mesh<P>::empty () const {
+        return indices.empty();
+      }
+
+      // --------------------------------------------------------------------------
+      template<typename P>
+      bool is_convex (const P* pts, std::size_t count) {
+        if ((count > 3) && detail::equal(pts[0], pts[count - 1])) {
+          --count;
+        }
+        if (count < 3) {
+          return false;
+        }
+        const std::size_t n = count;
+        float turn = 0;
+        float angle = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+          const P& a = pts[i];
+          const P& b = pts[(i + 1) % n];
+          const P& c = pts[(i + 2) % n];
+          const float dx0 = b.x - a.x;
+          const float dy0 = b.y - a.y;
+          const float dx1 = c.x - b.x;
+          const float dy1 = c.y - b.y;
+          const float cr = dx0 * dy1 - dy0 * dx1;
+          const float dot = dx0 * dx1 + dy0 * dy1;
+          if (cr == 0) {
+            if (dot < 0) {
+              // the outline goes back on itself.
+              return false;
+            }
+            continue;
+          }
+          if (turn == 0) {
+            turn = cr;
+          } else if ((cr > 0) != (turn > 0)) {
+            return false;
+          }
+          angle += std::atan2(cr, dot);
+        }
+        // one full turn, a star turning the same way winds twice or more.
+        return (turn != 0) && (std::abs(angle) < 3.0F * static_cast<float>(M_PI));
+      }
+
+      // --------------------------------------------------------------------------
+      template<typename P>
+      void triangulate (const P* pts, std::size_t count, mesh<P>& m) {
+        if ((count > 3) && detail::equal(pts[0], pts[count - 1])) {
+          --count;
+        }
+        if (count < 3) {
+          return;
+        }
+
+        const int base = static_cast<int>(m.points.size());
+        m.points.insert(m.points.end(), pts, pts + count);
+        const P* p = m.points.data() + base;
+        const int n = static_cast<int>(count);
+
+        float area = 0;
+        for (int i = 0; i < n; ++i) {
+          const P& a = p[i];
+          const P& b = p[(i + 1) % n];
+          area += a.x * b.y - b.x * a.y;
+        }
+        if (area == 0) {
+          return;
+        }
+
+        if (is_convex(p, count)) {
+          for (int i = 1; i < n - 1; ++i) {
+            detail::add_triangle(m, base, base + i, base + i + 1);
+          }
+          return;
+        }
+
+        // ear clipping on the remaining vertex list.
+        const float sign = area > 0 ? 1.0F : -1.0F;
+        std::vector<int> v(count);
+        for (int i = 0; i < n; ++i) {
+          v[i] = i;
+        }
+
+        int i = 0;
+        int guard = 2 * n;
+        while (v.size() > 2) {
+          const int k = static_cast<int>(v.size());
+          const int ia = v[(i + k - 1) % k];
+          const int ib = v[i % k];
+          const int ic = v[(i + 1) % k];
+          const P& a = p[ia];
+          const P& b = p[ib];
+          const P& c = p[ic];
+
+          const float o = detail::cross(a, b, c) * sign;
+          bool ear = o > 0;
+          if (ear) {
+            for (int j = 0; j < k; ++j) {
+              const int iv = v[j];
+              if ((iv == ia) || (iv == ib) || (iv == ic)) {
+                continue;
+              }
+              const P& t = p[iv];
+              if (detail::equal(t, a) || detail::equal(t, b) || detail::equal(t, c)) {
+                continue;
+              }
+              if (detail::inside_triangle(t, a, b, c, sign)) {
+                ear = false;
+                break;
+              }
+            }
+          }
+
+          if (ear || (o == 0) || (--guard <= 0)) {
+            // collinear vertices are dropped without a triangle, a self intersecting rest is clipped anyway.
+            if (o != 0) {
+              detail::add_triangle(m, base + ia, base + ib, base + ic);
+            }
+            v.erase(v.begin() + (i % k));
+            guard = 2 * static_cast<int>(v.size());
+            i = (i + k - 2) % (k - 1);
+          } else {
+            i = (i + 1) % k;
+          }
+        }
+      }
+
+      // --------------------------------------------------------------------------
+      template<typename P>
+      void stroke (const P* pts, std::size_t count, float width, bool closed, mesh<P>& m) {
+        const float hw = width / 2.0F;
+        if ((count < 2) || (hw <= 0)) {
+          return;
+        }
+        if (closed && (count > 2) && detail::equal(pts[0], pts[count - 1])) {
+          --count;
+        }
+
+        const std::size_t segments = closed ? count : count - 1;
+
+        // first and previous non empty segment, for the joins.
+        int first_seg = -1;
+        int prev_seg = -1;
+        float first_dx = 0, first_dy = 0, prev_dx = 0, prev_dy = 0;
+
+        auto join = [&] (const P& at, int seg0, float dx0, float dy0, int seg1, float dx1, float dy1) {
+          const float c = dx0 * dy1 - dy0 * dx1;
+          if (c == 0) {
+            return;
+          }
+          // outer side of the turn: the right side (-n) on a positive turn.
+          const float s = c > 0 ? -1.0F : 1.0F;
+          const int o0 = seg0 + (s > 0 ? 2 : 3);
+          const int o1 = seg1 + (s > 0 ? 0 : 1);
+          const int center = detail::add_point(m, at);
+
+          const float mx = -dy0 * s - dy1 * s;
+          const float my = dx0 * s + dx1 * s;
+          const float ml = std::sqrt(mx * mx + my * my);
+          // cos of the half angle between the two normals.
+          const float cos_half = ml / 2.0F;
+          if (cos_half > 0.5F) {
+            const float len = hw / cos_half / ml;
+            const int miter = detail::add_point(m, detail::offset(at, mx * len, my * len));
+            detail::add_triangle(m, center, o0, miter);
+            detail::add_triangle(m, center, miter, o1);
+          } else {
+            detail::add_triangle(m, center, o0, o1);
+          }
+        };
+
+        for (std::size_t i = 0; i < segments; ++i) {
+          const P& a = pts[i];
+          const P& b = pts[(i + 1) % count];
+          const float lx = b.x - a.x;
+          const float ly = b.y - a.y;
+          const float l = std::sqrt(lx * lx + ly * ly);
+          if (l == 0) {
+            continue;
+          }
+          const float dx = lx / l;
+          const float dy = ly / l;
+          const float nx = -dy * hw;
+          const float ny = dx * hw;
+
+          const int seg = detail::add_point(m, detail::offset(a, nx, ny));
+          detail::add_point(m, detail::offset(a, -nx, -ny));
+          detail::add_point(m, detail::offset(b, nx, ny));
+          detail::add_point(m, detail::offset(b, -nx, -ny));
+          detail::add_triangle(m, seg, seg + 1, seg + 2);
+          detail::add_triangle(m, seg + 1, seg + 2, seg + 3);
+
+          if (prev_seg < 0) {
+            first_seg = seg;
+            first_dx = dx;
+            first_dy = dy;
+          } else {
+            join(a, prev_seg, prev_dx, prev_dy, seg, dx, dy);
+          }
+          prev_seg = seg;
+          prev_dx = dx;
+          prev_dy = dy;
+        }
+
+        if (prev_seg < 0) {
+          return;
+        }
+
+        if (closed) {
+          if (first_seg != prev_seg) {
+            join(pts[0], prev_seg, prev_dx, prev_dy, first_seg, first_dx, first_dy);
+          }
+        } else {
+          // pointed caps: one triangle in front of the start and behind the end.
+          const P& a = pts[0];
+          const P& b = pts[count - 1];
+          const int ca = detail::add_point(m, detail::offset(a, -first_dx * hw, -first_dy * hw));
+          detail::add_triangle(m, first_seg, first_seg + 1, ca);
+          const int cb = detail::add_point(m, detail::offset(b, prev_dx * hw, prev_dy * hw));
+          detail::add_triangle(m, prev_seg + 2, prev_seg + 3, cb);
+        }
+      }
+
+    } // namespace tessellation
+
+  } // namespace draw
+
+} // namespace gui
@@ -19,6 +19,8 @@
 // Common includes
 //
 #include <iostream>
+#include <streambuf>
+#include <vector>
 #include <util/string_util.h>
 
 // --------------------------------------------------------------------------
@@ -32,6 +34,118 @@ namespace gui {
 
   namespace io {
 
+    namespace {
+
+      // --------------------------------------------------------------------------
+      // Reads the ascii sample values directly from the stream buffer,
+      // without the sentry and locale overhead of operator>> per value.
+      class ascii_reader {
+      public:
+        typedef std::char_traits<char> traits;
+
+        explicit ascii_reader (std::istream& in)
+          : buffer(in.rdbuf())
+        {}
+
+        int next_value () {
+          auto c = skip_space();
+          if ((c < '0') || (c > '9')) {
+            throw std::runtime_error("invalid or missing value in ascii pnm");
+          }
+          int v = 0;
+          do {
+            v = v * 10 + (c - '0');
+            c = buffer->snextc();
+          } while ((c >= '0') && (c <= '9'));
+          return v;
+        }
+
+        // P1 bits may be written without separator.
+        bool next_bit () {
+          const auto c = skip_space();
+          if ((c != '0') && (c != '1')) {
+            throw std::runtime_error("invalid or missing bit in ascii pnm");
+          }
+          buffer->sbumpc();
+          return c == '1';
+        }
+
+      private:
+        traits::int_type skip_space () {
+          auto c = buffer->sgetc();
+          while (!traits::eq_int_type(c, traits::eof())) {
+            if (c == '#') {
+              do {
+                c = buffer->snextc();
+              } while (!traits::eq_int_type(c, traits::eof()) && (c != '\n'));
+            } else if ((c == ' ') || (c == '\n') || (c == '\r') || (c == '\t') || (c == '\v') || (c == '\f')) {
+              c = buffer->snextc();
+            } else {
+              break;
+            }
+          }
+          return c;
+        }
+
+        std::streambuf* buffer;
+      };
+
+      // --------------------------------------------------------------------------
+      void read_bytes (std::istream& in, byte* data, std::size_t n) {
+        in.read(reinterpret_cast<char*>(data), n);
+        if (static_cast<std::size_t>(in.gcount()) != n) {
+          throw std::runtime_error("not enough input data in binary pnm");
+        }
+      }
+
+      // --------------------------------------------------------------------------
+      // Binary formats with the same layout as the datamap rows are read in one block.
+      template<pixel_format_t F>
+      void read_pnm_binary (std::istream& in, draw::image_data<F>& img, uint32_t y, uint32_t bytes) {
+        const auto& bmi = img.get_info();
+        read_bytes(in, img.raw_data().sub(y * bmi.bytes_per_line, bytes).data(0, bytes), bytes);
+      }
+
+      template<pixel_format_t F>
+      void read_pnm_binary (std::istream& in, draw::image_data<F>& img, uint32_t bytes) {
+        const auto& bmi = img.get_info();
+        if (bmi.bytes_per_line == bytes) {
+          const std::size_t n = std::size_t(bytes) * bmi.height;
+          read_bytes(in, img.raw_data().data(0, n), n);
+        } else {
+          for (uint_fast32_t y = 0; y < bmi.height; ++y) {
+            read_pnm_binary<F>(in, img, y, bytes);
+          }
+        }
+      }
+
+      // --------------------------------------------------------------------------
+      void read_pnm1_row (ascii_reader& reader, draw::image_data<pixel_format_t::BW>& img, uint32_t y) {
+        auto row = img.row(y);
+        for (uint_fast32_t x = 0; x < img.width(); ++x) {
+          row[x] = reader.next_bit() ? pixel::mono::black : pixel::mono::white;
+        }
+      }
+
+      void read_pnm2_row (ascii_reader& reader, draw::image_data<pixel_format_t::GRAY>& img, uint32_t y) {
+        auto row = img.row(y);
+        for (uint_fast32_t x = 0; x < img.width(); ++x) {
+          row[x].value = static_cast<byte>(reader.next_value());
+        }
+      }
+
+      void read_pnm3_row (ascii_reader& reader, draw::image_data<pixel_format_t::RGB>& img, uint32_t y) {
+        auto row = img.row(y);
+        for (uint_fast32_t x = 0; x < img.width(); ++x) {
+          const auto r = static_cast<byte>(reader.next_value());
+          const auto g = static_cast<byte>(reader.next_value());
+          const auto b = static_cast<byte>(reader.next_value());
+          row[x] = pixel::rgb{r, g, b};
+        }
+      }
+
+    } // namespace
+
     pixel_format_t pnm2bpp (PNM pnm) {
       switch (pnm) {
         case PNM::P1:
@@ -203,16 +317,9 @@ namespace gui {
     draw::rgbmap read_pnm<PNM::P6> (std::istream& in, const draw::bitmap_info& bmi) {
       draw::rgbmap img(bmi.size());
       std::noskipws(in);
+      // pixel::rgb has the byte order of the file.
       auto data = img.get_data();
-      for (uint_fast32_t y = 0; y < bmi.height; ++y) {
-        auto row = data.row(y);
-        for (uint_fast32_t x = 0; x < bmi.width; ++x) {
-          auto& pixel = row[x];
-          in.read(reinterpret_cast<char*>(&pixel.red), 1);
-          in.read(reinterpret_cast<char*>(&pixel.green), 1);
-          in.read(reinterpret_cast<char*>(&pixel.blue), 1);
-        }
-      }
+      read_pnm_binary(in, data, bmi.width * 3);
       return img;
     }
 
@@ -231,18 +338,9 @@ namespace gui {
     template<>
     draw::graymap read_pnm<PNM::P5> (std::istream& in, const draw::bitmap_info& bmi) {
       draw::graymap img(bmi.size());
-      auto n = bmi.width * bmi.height;
       std::noskipws(in);
-      auto p1 = in.tellg();
-      auto raw = img.get_data();
-      for (uint_fast32_t y = 0; y < bmi.height; ++y) {
-        in.read(reinterpret_cast<char*>(raw.row(y).data(0, bmi.width)), bmi.width);
-      }
-      auto p2 = in.tellg();
-      auto m = p2 - p1;
-      if (m != n) {
-        throw std::runtime_error("not enought input data in read_pnm<5>");
-      }
+      auto data = img.get_data();
+      read_pnm_binary(in, data, bmi.width);
       return img;
     }
 
@@ -281,19 +379,16 @@ namespace gui {
 
     // --------------------------------------------------------------------------
     template<core::bit_order_t O>
-    void read_pnm4_line (std::istream& in, draw::image_data<pixel_format_t::BW>::raw_type, int bytes);
+    void convert_pnm4_line (draw::image_data<pixel_format_t::BW>::raw_type, int bytes);
 
     template<>
-    inline void read_pnm4_line<core::bit_order_t::msb_first>(std::istream& in, draw::image_data<pixel_format_t::BW>::raw_type data, int bytes) {
-      in.read(reinterpret_cast<char*>(data.data(0, bytes)), bytes);
+    inline void convert_pnm4_line<core::bit_order_t::msb_first> (draw::image_data<pixel_format_t::BW>::raw_type, int) {
     }
 
     template<>
-    inline void read_pnm4_line<core::bit_order_t::lsb_first>(std::istream& in, draw::image_data<pixel_format_t::BW>::raw_type data, int bytes) {
-      std::vector<byte> line(bytes);
-      in.read(reinterpret_cast<char*>(line.data()), bytes);
+    inline void convert_pnm4_line<core::bit_order_t::lsb_first> (draw::image_data<pixel_format_t::BW>::raw_type data, int bytes) {
       for (int x = 0; x < bytes; ++x) {
-        data[x] = core::reverse_bit_order(line[x])/* ^ 0xff*/;
+        data[x] = core::reverse_bit_order(data[x])/* ^ 0xff*/;
       }
     }
 
@@ -301,11 +396,13 @@ namespace gui {
     template<>
     draw::bwmap read_pnm<PNM::P4> (std::istream& in, const draw::bitmap_info& bmi) {
       draw::bwmap img(bmi.size());
-      int bytes = (bmi.width + 7) / 8;
-      auto raw = img.get_data().raw_data();
+      const int bytes = (bmi.width + 7) / 8;
+      auto data = img.get_data();
       std::noskipws(in);
+      read_pnm_binary(in, data, bytes);
+      auto raw = data.raw_data();
       for (uint_fast32_t y = 0; y < bmi.height; ++y) {
-        read_pnm4_line<core::os::bitmap_bit_order>(in, raw.sub(y * bmi.bytes_per_line, bmi.bytes_per_line), bytes);
+        convert_pnm4_line<core::os::bitmap_bit_order>(raw.sub(y * bmi.bytes_per_line, bmi.bytes_per_line), bytes);
       }
       return img;
     }
@@ -378,21 +475,10 @@ namespace gui {
     template<>
     draw::rgbmap read_pnm<PNM::P3> (std::istream& in, const draw::bitmap_info& bmi) {
       draw::rgbmap img(bmi.size());
-      std::skipws(in);
-      auto raw = img.get_data();
+      ascii_reader reader(in);
+      auto data = img.get_data();
       for (uint_fast32_t y = 0; y < bmi.height; ++y) {
-        auto row = raw.row(y);
-        for (uint_fast32_t x = 0; x < bmi.width; ++x) {
-          int r, g, b;
-          in >> r;
-          in >> g;
-          in >> b;
-          row[x] = pixel::rgb{
-                   static_cast<byte>(r),
-                   static_cast<byte>(g),
-                   static_cast<byte>(b)
-        };
-        }
+        read_pnm3_row(reader, data, y);
       }
       return img;
     }
@@ -415,15 +501,10 @@ namespace gui {
     template<>
     draw::graymap read_pnm<PNM::P2> (std::istream& in, const draw::bitmap_info& bmi) {
       draw::graymap img(bmi.size());
-      std::skipws(in);
-      auto raw = img.get_data();
+      ascii_reader reader(in);
+      auto data = img.get_data();
       for (uint_fast32_t y = 0; y < bmi.height; ++y) {
-        auto row = raw.row(y);
-        for (uint_fast32_t x = 0; x < bmi.width; ++x) {
-          int v;
-          in >> v;
-          row[x].value = static_cast<byte>(v);
-        }
+        read_pnm2_row(reader, data, y);
       }
       return img;
     }
@@ -446,15 +527,10 @@ namespace gui {
     template<>
     draw::bwmap read_pnm<PNM::P1> (std::istream& in, const draw::bitmap_info& bmi) {
       draw::bwmap img(bmi.size());
-      std::skipws(in);
-      auto raw = img.get_data();
+      ascii_reader reader(in);
+      auto data = img.get_data();
       for (uint_fast32_t y = 0; y < bmi.height; ++y) {
-        auto row = raw.row(y);
-        for (uint_fast32_t x = 0; x < bmi.width; ++x) {
-          char v;
-          in >> v;
-          row[x] = (v == '1') ? pixel::mono::black : pixel::mono::white;
-        }
+        read_pnm1_row(reader, data, y);
       }
       return img;
     }
@@ -474,6 +550,67 @@ namespace gui {
       }
     }
 
+    // --------------------------------------------------------------------------
+    namespace {
+
+      template<pixel_format_t F, typename R>
+      void read_pnm_rows (std::istream& in, const draw::bitmap_info& bmi,
+                          const pnm_row_callback& fn, R read_row) {
+        const draw::bitmap_info row_info(bmi.width, 1, F);
+        std::vector<byte> buffer(row_info.mem_size());
+        draw::image_data<F> row(typename draw::image_data<F>::raw_type(buffer.data(), buffer.size()), row_info);
+        for (uint_fast32_t y = 0; y < bmi.height; ++y) {
+          read_row(row);
+          fn(y, buffer.data());
+        }
+      }
+
+    } // namespace
+
+    draw::bitmap_info read_pnm_rows (std::istream& in, const pnm_row_callback& fn) {
+      int max;
+      PNM pnm;
+      const draw::bitmap_info bmi = read_pnm_header(in, pnm, max);
+      ascii_reader reader(in);
+
+      switch (pnm) {
+        case PNM::P1:
+          read_pnm_rows<pixel_format_t::BW>(in, bmi, fn, [&] (draw::image_data<pixel_format_t::BW>& row) {
+            read_pnm1_row(reader, row, 0);
+          });
+          break;
+        case PNM::P2:
+          read_pnm_rows<pixel_format_t::GRAY>(in, bmi, fn, [&] (draw::image_data<pixel_format_t::GRAY>& row) {
+            read_pnm2_row(reader, row, 0);
+          });
+          break;
+        case PNM::P3:
+          read_pnm_rows<pixel_format_t::RGB>(in, bmi, fn, [&] (draw::image_data<pixel_format_t::RGB>& row) {
+            read_pnm3_row(reader, row, 0);
+          });
+          break;
+        case PNM::P4: {
+          const int bytes = (bmi.width + 7) / 8;
+          read_pnm_rows<pixel_format_t::BW>(in, bmi, fn, [&] (draw::image_data<pixel_format_t::BW>& row) {
+            read_pnm_binary(in, row, 0, bytes);
+            convert_pnm4_line<core::os::bitmap_bit_order>(row.raw_data(), bytes);
+          });
+          break;
+        }
+        case PNM::P5:
+          read_pnm_rows<pixel_format_t::GRAY>(in, bmi, fn, [&] (draw::image_data<pixel_format_t::GRAY>& row) {
+            read_pnm_binary(in, row, 0, bmi.width);
+          });
+          break;
+        case PNM::P6:
+          read_pnm_rows<pixel_format_t::RGB>(in, bmi, fn, [&] (draw::image_data<pixel_format_t::RGB>& row) {
+            read_pnm_binary(in, row, 0, bmi.width * 3);
+          });
+          break;
+      }
+      return bmi;
+    }
+
   } // io
 
 }
@@ -22,6 +22,7 @@
 //
 #include <iostream>
 #include <fstream>
+#include <functional>
 #include <util/ostreamfmt.h>
 
 // --------------------------------------------------------------------------
@@ -186,6 +187,14 @@ namespace gui {
     GUIPP_IO_EXPORT void load_pnm (std::istream& in, draw::basic_datamap& bmp);
     GUIPP_IO_EXPORT void load_pnm (const std::string& name, draw::basic_datamap& bmp);
 
+    // --------------------------------------------------------------------------
+    /// Called for each decoded row, in the datamap row layout of the pnm pixel format.
+    typedef std::function<void(uint32_t y, const byte* row)> pnm_row_callback;
+
+    /// Read header and rows of a pnm one row at a time, for images that should not be held in memory.
+    /// Returns the bitmap info of the whole image.
+    GUIPP_IO_EXPORT draw::bitmap_info read_pnm_rows (std::istream& in, const pnm_row_callback& fn);
+
     // --------------------------------------------------------------------------
     template<bool BIN, pixel_format_t T>
     class opnm {
@@ -77,6 +77,41 @@ namespace gui {
         save_pnm_src(ofs, bmp, name);
       }
 
+      // --------------------------------------------------------------------------
+      void save_raw_src (std::ostream& out, const draw::basic_datamap& bmp, const std::string& name) {
+        using pf = pixel_format_t;
+        switch (bmp.pixel_format()) {
+          case pf::BW:    save_raw_src<pf::BW>(out, bmp.reinterpret<pf::BW>(), name); break;
+          case pf::GRAY:  save_raw_src<pf::GRAY>(out, bmp.reinterpret<pf::GRAY>(), name); break;
+          case pf::RGB:   save_raw_src<pf::RGB>(out, bmp.reinterpret<pf::RGB>(), name); break;
+          case pf::RGBA:  save_raw_src<pf::RGBA>(out, bmp.reinterpret<pf::RGBA>(), name); break;
+          case pf::BGR:   save_raw_src<pf::BGR>(out, bmp.reinterpret<pf::BGR>(), name); break;
+          case pf::BGRA:  save_raw_src<pf::BGRA>(out, bmp.reinterpret<pf::BGRA>(), name); break;
+          default:
+            throw std::out_of_range(ostreamfmt("Can not save pixel format " << bmp.pixel_format() << "to source"));
+        }
+      }
+
+      // --------------------------------------------------------------------------
+      uint32_t raw_bytes_per_line (const draw::bitmap_info& bmi) {
+        return (bmi.width * bmi.bits_per_pixel() + 7) / 8;
+      }
+
+      const char* pixel_format_name (pixel_format_t px_fmt) {
+        using pf = pixel_format_t;
+        switch (px_fmt) {
+          case pf::BW:    return "BW";
+          case pf::GRAY:  return "GRAY";
+          case pf::RGB:   return "RGB";
+          case pf::BGR:   return "BGR";
+          case pf::RGBA:  return "RGBA";
+          case pf::BGRA:  return "BGRA";
+          case pf::ARGB:  return "ARGB";
+          case pf::ABGR:  return "ABGR";
+          default:        return "Undefined";
+        }
+      }
+
       // --------------------------------------------------------------------------
       void write_pixel (std::ostream& out, const core::bit_wrapper<const pixel::mono>& pixel) {
         write_pixel(out, static_cast<const pixel::mono>(pixel));
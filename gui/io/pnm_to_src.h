@@ -61,6 +61,20 @@ namespace gui {
       GUIPP_IO_EXPORT void save_pnm_src (const std::string& fname, const draw::basic_datamap& bmp, const std::string& name);
       GUIPP_IO_EXPORT void save_pnm_src (std::ostream& out, const draw::basic_datamap& bmp, const std::string& name);
 
+      // --------------------------------------------------------------------------
+      /**
+       * Write the pixels in memory layout with the minimal line stride as
+       * name_pixels[] and a matching name_info bitmap_info.
+       * Both can be wrapped by an image_data without parsing.
+       */
+      template<pixel_format_t T>
+      void save_raw_src (std::ostream& out, const draw::image_data<T>& img, const std::string& name);
+
+      GUIPP_IO_EXPORT void save_raw_src (std::ostream& out, const draw::basic_datamap& bmp, const std::string& name);
+
+      GUIPP_IO_EXPORT uint32_t raw_bytes_per_line (const draw::bitmap_info&);
+      GUIPP_IO_EXPORT const char* pixel_format_name (pixel_format_t);
+
       // --------------------------------------------------------------------------
       template<pixel_format_t T>
       class opnm {
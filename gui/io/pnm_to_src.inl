@@ -71,6 +71,32 @@ namespace gui {
         }
       }
 
+      // --------------------------------------------------------------------------
+      template<pixel_format_t T>
+      void save_raw_src (std::ostream& out, const draw::image_data<T>& img, const std::string& name) {
+        const auto& bmi = img.get_info();
+        const auto bpl = raw_bytes_per_line(bmi);
+        const auto raw = img.raw_data();
+
+        out << "static const gui::draw::bitmap_info " << name << "_info(" << bmi.width << ", " << bmi.height
+            << ", " << bpl << ", gui::pixel_format_t::" << pixel_format_name(T) << ");" << std::endl
+            << "static const unsigned char " << name << "_pixels[] = {" << std::endl;
+        out.fill(' ');
+        for (uint_fast32_t y = 0; y < bmi.height; ++y) {
+          const auto offset = y * bmi.bytes_per_line;
+          for (uint_fast32_t x = 0; x < bpl; ++x) {
+            out << std::setw(3) << static_cast<int>(raw[offset + x]);
+            if (x < bpl - 1) {
+              out << ((x % 24 == 23) ? ",\n" : ", ");
+            } else if (y < bmi.height - 1) {
+              out << ',';
+            }
+          }
+          out << std::endl;
+        }
+        out << "};" << std::endl;
+      }
+
       // --------------------------------------------------------------------------
       template<pixel_format_t T>
       void save_pnm_src (std::ostream& out, const draw::datamap<T>& bmp, const std::string& name) {
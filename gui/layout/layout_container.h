@@ -20,6 +20,7 @@
 //
 // Library includes
 //
+#include "gui/core/tracing.h"
 #include "gui/win/overlapped_window.h"
 #include "gui/layout/layout.h"
 
@@ -53,6 +53,7 @@ namespace gui {
       template<typename B, typename L, typename ... A>
       inline void layout_container_base<B, L, A...>::layout (const core::rectangle& r) {
         logging::trace() << *this << " layout(" << r << ")";
+        GUIPP_TRACE_SPAN(layout, "layout_container::layout", this);
         layouter.layout(r);
       }
 
@@ -14,27 +14,121 @@
  * @license   MIT license. See accompanying file LICENSE.
  */
 
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <cmath>
+#include <algorithm>
+
 // --------------------------------------------------------------------------
 //
 // Library includes
 //
 #include "gui/win/container.h"
 #include "gui/win/animation.h"
+#include "gui/win/window_event_proc.h"
 
 namespace gui {
 
   namespace win {
 
     namespace animation {
+      // --------------------------------------------------------------------------
+      namespace {
+        // a lost wake up must not stop all animations.
+        constexpr int max_skipped_frames = 8;
+      }
+
+      scheduler& scheduler::get () {
+        // lazy create static
+        static scheduler s;
+        return s;
+      }
+
+      scheduler::scheduler ()
+        : next_id(0)
+        , frame_pending(false)
+        , skipped_frames(0)
+        , repeater(frame_delay, [&] () { tick(); })
+      {}
+
+      scheduler::~scheduler () {
+        repeater.stop();
+        repeater.wait_for_finish();
+      }
+
+      auto scheduler::add (frame_t&& f) -> id_t {
+        entries.push_back({++next_id, std::move(f)});
+        if (!repeater.is_active()) {
+          repeater.start();
+        }
+        return next_id;
+      }
+
+      void scheduler::remove (id_t id) {
+        // only mark it, the entry may be running right now.
+        for (auto& e : entries) {
+          if (e.id == id) {
+            e.id = 0;
+          }
+        }
+      }
+
+      bool scheduler::is_active (id_t id) const {
+        return (id != 0) && std::any_of(entries.begin(), entries.end(), [id] (const entry& e) {
+          return e.id == id;
+        });
+      }
+
+      void scheduler::frame () {
+        frame_pending = false;
+        const auto now = clock::now();
+        // entries added while running are appended and run in this frame, too.
+        for (auto i = entries.begin(); i != entries.end(); ++i) {
+          if ((i->id != 0) && !i->fn(now)) {
+            i->id = 0;
+          }
+        }
+        entries.remove_if([] (const entry& e) {
+          return e.id == 0;
+        });
+        if (entries.empty()) {
+          repeater.stop();
+        }
+      }
+
+      void scheduler::tick () {
+        if (frame_pending.exchange(true)) {
+          if (++skipped_frames < max_skipped_frames) {
+            return;
+          }
+        }
+        skipped_frames = 0;
+#if GUIPP_JS
+        // the repeater runs on the main thread.
+        frame();
+#else
+        run_on_main([&] () {
+          frame();
+        });
+#endif // GUIPP_JS
+      }
+
       // --------------------------------------------------------------------------
       engine::engine (std::chrono::milliseconds duration, int fps, float f0, float f1)
         : f0(f0)
         , delta(f1 - f0)
         , duration(duration)
-        , repeater(std::max(std::chrono::milliseconds(1000) / fps, std::chrono::milliseconds(1)))
+        , frame_interval(std::chrono::milliseconds(1000) / std::max(fps, 1))
+        , id(0)
         , animation_disabled(false)
       {}
 
+      engine::~engine () {
+        stop();
+      }
+
       void engine::start (finish_t fin) {
         if (animation_disabled) {
           for(auto& a : animations) {
@@ -46,27 +140,36 @@ namespace gui {
           }
         } else {
           stop();
-          const auto start_time = std::chrono::system_clock::now();
-          repeater.start([&, fin, start_time] () {
-            const auto now = std::chrono::system_clock::now();
-            const float f = f0 + delta * (now - start_time) / duration;
+          const auto start_time = scheduler::clock::now();
+          auto last_step = start_time;
+          id = scheduler::get().add([&, fin, start_time, last_step] (scheduler::clock::time_point now) mutable {
+            const float f = std::min(1.0F, std::chrono::duration<float>(now - start_time) / duration);
+            if ((f < 1.0F) && (now - last_step < frame_interval)) {
+              // skip frames above the requested frame rate.
+              return true;
+            }
+            last_step = now;
             for(auto& a : animations) {
-              a(f);
+              a(f0 + delta * f);
+            }
+            if (f < 1.0F) {
+              return true;
             }
-            if (now >= start_time + duration) {
-              repeater.stop();
-              clear();
-              if (fin) {
-                fin();
-              }
+            id = 0;
+            clear();
+            if (fin) {
+              fin();
             }
+            return false;
           });
         }
       }
 
       void engine::stop () {
-        repeater.stop();
-        repeater.wait_for_finish();
+        if (id) {
+          scheduler::get().remove(id);
+          id = 0;
+        }
       }
 
       void engine::add (const animation_t& a) {
@@ -85,6 +188,109 @@ namespace gui {
         animation_disabled = disable;
       }
 
+      // --------------------------------------------------------------------------
+      kinetic::kinetic (float friction)
+        : friction(friction)
+        , velocity(0)
+        , remainder(0)
+        , id(0)
+      {}
+
+      kinetic::~kinetic () {
+        stop();
+      }
+
+      void kinetic::set_scroll (scroll_t&& s) {
+        scroll = std::move(s);
+      }
+
+      void kinetic::move_by (type distance) {
+        // the whole movement covers velocity / friction.
+        impulse(distance * friction);
+      }
+
+      void kinetic::impulse (type v) {
+        if (velocity * v < 0) {
+          // turning around stops the running movement.
+          velocity = 0;
+          remainder = 0;
+        }
+        velocity += v;
+        if (!is_active()) {
+          last_frame = clock::now();
+          id = scheduler::get().add([&] (clock::time_point now) {
+            return frame(now);
+          });
+        }
+      }
+
+      void kinetic::track (type pos) {
+        // the content follows the pointer while dragging.
+        stop();
+        const auto now = clock::now();
+        samples.push_back({now, pos});
+        auto first = std::find_if(samples.begin(), samples.end(), [&] (const sample& s) {
+          return now - s.time <= track_time;
+        });
+        samples.erase(samples.begin(), std::min(first, samples.end() - 1));
+      }
+
+      void kinetic::release () {
+        type v = 0;
+        if ((samples.size() > 1) && (clock::now() - samples.back().time <= track_time)) {
+          const float dt = std::chrono::duration<float>(samples.back().time - samples.front().time).count();
+          if (dt > 0) {
+            v = (samples.back().pos - samples.front().pos) / dt;
+          }
+        }
+        samples.clear();
+        if (std::abs(v) >= min_velocity) {
+          impulse(v);
+        }
+      }
+
+      void kinetic::stop () {
+        if (id) {
+          scheduler::get().remove(id);
+          id = 0;
+        }
+        velocity = 0;
+        remainder = 0;
+      }
+
+      bool kinetic::is_active () const {
+        return id != 0;
+      }
+
+      auto kinetic::get_velocity () const -> type {
+        return velocity;
+      }
+
+      bool kinetic::frame (clock::time_point now) {
+        const float dt = std::chrono::duration<float>(now - last_frame).count();
+        last_frame = now;
+        const float decay = std::exp(-friction * dt);
+        remainder += velocity * (1.0F - decay) / friction;
+        velocity *= decay;
+
+        bool running = std::abs(velocity) >= min_velocity;
+        if (!running) {
+          // add the rest of the way, so the total distance is kept.
+          remainder += velocity / friction;
+        }
+        const type step = running ? std::trunc(remainder) : std::round(remainder);
+        remainder -= step;
+        if ((step != 0) && scroll && !scroll(step)) {
+          running = false;
+        }
+        if (!running) {
+          id = 0;
+          velocity = 0;
+          remainder = 0;
+        }
+        return running;
+      }
+
       // --------------------------------------------------------------------------
       move::move (const window_ptr& win,
                   const core::point& from,
@@ -24,6 +24,8 @@
 #include <chrono>
 #include <vector>
 #include <memory>
+#include <list>
+#include <atomic>
 
 // --------------------------------------------------------------------------
 //
@@ -39,12 +41,61 @@ namespace gui {
 
     namespace animation {
 
+      // --------------------------------------------------------------------------
+      /**
+       * Drives all running animations from one timer. The timer only requests a
+       * frame, every frame runs on the main thread and calls each animation with
+       * the current time. A frame that is requested while the previous one is
+       * still pending is dropped, so slow frames are coalesced and not queued.
+       * Frames are posted without a window, the animations have to stop
+       * themselves before the windows they change are gone.
+       */
+      struct GUIPP_WIN_EXPORT scheduler {
+        typedef std::chrono::steady_clock clock;
+        /// Called on each frame, returns false when the animation has finished.
+        typedef std::function<bool(clock::time_point)> frame_t;
+        typedef std::size_t id_t;
+
+        static constexpr std::chrono::milliseconds frame_delay = std::chrono::milliseconds(16);
+
+        static scheduler& get ();
+
+        scheduler ();
+        ~scheduler ();
+
+        /// Must be called on the main thread.
+        id_t add (frame_t&& f);
+        void remove (id_t id);
+        bool is_active (id_t id) const;
+
+        void frame ();
+
+      private:
+        void tick ();
+
+        struct entry {
+          id_t id;
+          frame_t fn;
+        };
+
+        std::list<entry> entries;
+        id_t next_id;
+
+        std::atomic_bool frame_pending;
+        int skipped_frames;
+
+        background_repeater repeater;
+      };
+
       // --------------------------------------------------------------------------
       struct GUIPP_WIN_EXPORT engine {
         typedef std::function<void(float)> animation_t;
         typedef std::function<void()> finish_t;
 
+        /// Runs on the scheduler frames, fps limits how often the animations
+        /// are called, up to the scheduler frame rate.
         engine (std::chrono::milliseconds duration, int fps = 50, float f0 = 0, float f1 = 1);
+        ~engine ();
 
         void start (finish_t fin);
         void stop ();
@@ -60,11 +111,64 @@ namespace gui {
         float delta;
 
         std::chrono::milliseconds duration;
-        background_repeater repeater;
+        std::chrono::milliseconds frame_interval;
         std::vector<animation_t> animations;
+        scheduler::id_t id;
         bool animation_disabled;
       };
 
+      // --------------------------------------------------------------------------
+      /**
+       * Velocity based scrolling with exponential deceleration. Wheel steps and
+       * the velocity of a released drag start a movement, the scroll function
+       * is called with whole pixel distances on each frame.
+       */
+      struct GUIPP_WIN_EXPORT kinetic {
+        typedef scheduler::clock clock;
+        typedef core::point::type type;
+        /// Scroll by the given distance, returns false if a limit was reached.
+        typedef std::function<bool(type)> scroll_t;
+
+        /// Movements slower than this, in pixel per second, are stopped.
+        static constexpr type min_velocity = 20;
+        /// Only drag positions of this last time span define the release velocity.
+        static constexpr std::chrono::milliseconds track_time = std::chrono::milliseconds(100);
+
+        explicit kinetic (float friction = 8.0F);
+        kinetic (const kinetic&) = delete;
+        ~kinetic ();
+
+        void set_scroll (scroll_t&& s);
+
+        /// Scroll by distance in total, as smooth movement.
+        void move_by (type distance);
+        void impulse (type velocity);
+
+        /// Record the drag position, starts a movement on release.
+        void track (type pos);
+        void release ();
+
+        void stop ();
+        bool is_active () const;
+        type get_velocity () const;
+
+      private:
+        bool frame (clock::time_point now);
+
+        struct sample {
+          clock::time_point time;
+          type pos;
+        };
+
+        scroll_t scroll;
+        float friction;
+        type velocity;
+        type remainder;
+        clock::time_point last_frame;
+        scheduler::id_t id;
+        std::vector<sample> samples;
+      };
+
       // --------------------------------------------------------------------------
       typedef std::shared_ptr<win::window> window_ptr;
 
@@ -14,8 +14,24 @@
  * @license   MIT license. See accompanying file LICENSE.
  */
 
+// --------------------------------------------------------------------------
+//
+// Common includes
+//
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+#include <array>
+#include <vector>
+#include <condition_variable>
 #if GUIPP_JS
 #include <emscripten/eventloop.h>
+#elif defined USE_MINGW && __MINGW_GCC_VERSION < 100000
+#include <mingw/mingw.thread.h>
+#include <mingw/mingw.mutex.h>
+#include <mingw/mingw.condition_variable.h>
+#else
+#include <thread>
 #endif
 
 // --------------------------------------------------------------------------
@@ -30,22 +46,266 @@ namespace gui {
 
   namespace win {
 
-    background_repeater::background_repeater (std::chrono::milliseconds delay_ms, action_t action)
-      : action(action)
-      , delay(delay_ms)
-      , active(false)
-#if GUIPP_JS
-      , task(0)
+    namespace detail {
+
+      // --------------------------------------------------------------------------
+      struct repeater_state {
+        typedef background_repeater::action_t action_t;
+
+        repeater_state (std::chrono::milliseconds delay)
+          : delay(delay)
+          , active(false)
+          , running(false)
+          , generation(0)
+        {}
+
+        std::shared_ptr<const action_t> get_action () {
+          std::lock_guard<std::mutex> lock(action_lock);
+          return action;
+        }
+
+        void set_action (action_t a) {
+          std::lock_guard<std::mutex> lock(action_lock);
+          action = std::make_shared<const action_t>(std::move(a));
+        }
+
+        std::atomic<std::chrono::milliseconds> delay;
+        std::atomic_bool active;
+        // guarded by the lock of the timer wheel.
+        bool running;
+        // each start gets a new generation, entries of older ones are dropped.
+        std::atomic<unsigned> generation;
+
+      private:
+        std::mutex action_lock;
+        std::shared_ptr<const action_t> action;
+      };
+
+#ifndef GUIPP_JS
+      // --------------------------------------------------------------------------
+      /**
+       * Hierarchical timer wheel with 1 ms ticks and four levels of 64 slots,
+       * covering 64 ms, 4 s, 4 min and 4.6 h. Entries behind the last level are
+       * put in its last slot and cascaded again. Canceled entries are not
+       * removed, they are dropped when their slot expires.
+       */
+      class timer_wheel {
+      public:
+        typedef std::chrono::steady_clock clock;
+        typedef std::uint64_t tick_t;
+
+        static constexpr int slot_bits = 6;
+        static constexpr tick_t slot_count = 1 << slot_bits;
+        static constexpr tick_t slot_mask = slot_count - 1;
+        static constexpr int level_count = 4;
+
+        static timer_wheel& get () {
+          // lazy create static
+          static timer_wheel wheel;
+          return wheel;
+        }
+
+        timer_wheel ()
+          : start_time(clock::now())
+          , current(0)
+          , quit(false)
+        {}
+
+        ~timer_wheel () {
+          {
+            std::lock_guard<std::mutex> lock(wheel_lock);
+            quit = true;
+          }
+          wakeup.notify_all();
+          if (service.joinable()) {
+            service.join();
+          }
+        }
+
+        void add (const std::shared_ptr<repeater_state>& state, clock::time_point due) {
+          std::lock_guard<std::mutex> lock(wheel_lock);
+          if (is_empty()) {
+            // catch up with the idle time without walking through it.
+            current = std::max(current, to_tick(clock::now()));
+          }
+          insert({state, state->generation, std::max(to_tick(due), current)});
+          if (!service.joinable()) {
+            service = std::thread([&] () {
+              run();
+            });
+          }
+          wakeup.notify_one();
+        }
+
+        void wait_for (const std::shared_ptr<repeater_state>& state) {
+          std::unique_lock<std::mutex> lock(wheel_lock);
+          if (std::this_thread::get_id() == service.get_id()) {
+            // called from the own action.
+            return;
+          }
+          finished.wait(lock, [&] () {
+            return !state->running;
+          });
+        }
+
+      private:
+        struct entry {
+          std::shared_ptr<repeater_state> state;
+          unsigned generation;
+          tick_t due;
+
+          bool is_valid () const {
+            return state->active && (state->generation == generation);
+          }
+        };
+
+        typedef std::vector<entry> slot_t;
+
+        tick_t to_tick (clock::time_point t) const {
+          return t > start_time ? std::chrono::duration_cast<std::chrono::milliseconds>(t - start_time).count() : 0;
+        }
+
+        clock::time_point to_time (tick_t t) const {
+          return start_time + std::chrono::milliseconds(t);
+        }
+
+        void insert (entry&& e) {
+          const tick_t diff = e.due - current;
+          for (int level = 0; level < level_count; ++level) {
+            const int shift = slot_bits * level;
+            if ((diff >> shift) < slot_count) {
+              levels[level][(e.due >> shift) & slot_mask].emplace_back(std::move(e));
+              return;
+            }
+          }
+          // too far away, wait in the last slot in reach and cascade again.
+          const int shift = slot_bits * (level_count - 1);
+          levels[level_count - 1][((current >> shift) - 1) & slot_mask].emplace_back(std::move(e));
+        }
+
+        // move all entries of the slot at index into the lower levels.
+        tick_t cascade (int level, tick_t index) {
+          slot_t moved;
+          moved.swap(levels[level][index]);
+          for (auto& e : moved) {
+            if (e.is_valid()) {
+              insert(std::move(e));
+            }
+          }
+          return index;
+        }
+
+        // the next tick with entries in the first level, or the next cascade.
+        tick_t next_tick () const {
+          for (tick_t t = current; t < ((current | slot_mask) + 1); ++t) {
+            if (!levels[0][t & slot_mask].empty()) {
+              return t;
+            }
+          }
+          return (current | slot_mask) + 1;
+        }
+
+        bool is_empty () const {
+          for (const auto& level : levels) {
+            for (const auto& slot : level) {
+              if (!slot.empty()) {
+                return false;
+              }
+            }
+          }
+          return true;
+        }
+
+        // collect the expired entries up to now.
+        void advance (tick_t now, slot_t& expired) {
+          while (current <= now) {
+            const tick_t index = current & slot_mask;
+            if (index == 0) {
+              for (int level = 1; level < level_count; ++level) {
+                if (cascade(level, (current >> (slot_bits * level)) & slot_mask) != 0) {
+                  break;
+                }
+              }
+            }
+            auto& slot = levels[0][index];
+            for (auto& e : slot) {
+              if (e.is_valid()) {
+                e.state->running = true;
+                expired.emplace_back(std::move(e));
+              }
+            }
+            slot.clear();
+            ++current;
+          }
+        }
+
+        void run () {
+          slot_t expired;
+          std::unique_lock<std::mutex> lock(wheel_lock);
+          while (!quit) {
+            if (is_empty()) {
+              wakeup.wait(lock);
+              continue;
+            }
+            const auto next = to_time(next_tick());
+            if (clock::now() < next) {
+              wakeup.wait_until(lock, next);
+              continue;
+            }
+            advance(to_tick(clock::now()), expired);
+            if (expired.empty()) {
+              continue;
+            }
+
+            for (auto& e : expired) {
+              lock.unlock();
+              const auto fired = clock::now();
+              // may be stopped by an action before.
+              if (e.is_valid()) {
+                auto action = e.state->get_action();
+                if (action && *action) {
+                  (*action)();
+                }
+              }
+              e.due = to_tick(fired + e.state->delay.load());
+              lock.lock();
+
+              // a waiting stop must not wait for the other actions.
+              e.state->running = false;
+              if (e.is_valid()) {
+                e.due = std::max(e.due, current);
+                insert(std::move(e));
+              }
+              finished.notify_all();
+            }
+            expired.clear();
+          }
+        }
+
+        const clock::time_point start_time;
+        tick_t current;
+        bool quit;
+
+        std::array<std::array<slot_t, slot_count>, level_count> levels;
+
+        std::mutex wheel_lock;
+        std::condition_variable wakeup;
+        std::condition_variable finished;
+        std::thread service;
+      };
 #endif //GUIPP_JS
+
+    } // namespace detail
+
+    // --------------------------------------------------------------------------
+    background_repeater::background_repeater (std::chrono::milliseconds delay_ms, action_t action)
+      : background_repeater(delay_ms)
     {
-      if (delay_ms < std::chrono::milliseconds(1)) {
-        throw std::runtime_error("Delay can not be smaller than 1 ms");
-      }
+      state->set_action(std::move(action));
     }
 
     background_repeater::background_repeater (std::chrono::milliseconds delay_ms)
-      : delay(delay_ms)
-      , active(false)
+      : state(std::make_shared<detail::repeater_state>(delay_ms))
 #if GUIPP_JS
       , task(0)
 #endif //GUIPP_JS
@@ -53,6 +313,10 @@ namespace gui {
       if (delay_ms < std::chrono::milliseconds(1)) {
         throw std::runtime_error("Delay can not be smaller than 1 ms");
       }
+#ifndef GUIPP_JS
+      // the wheel must outlive static repeaters.
+      detail::timer_wheel::get();
+#endif //GUIPP_JS
     }
 
     background_repeater::~background_repeater () {
@@ -61,7 +325,7 @@ namespace gui {
     }
 
     void background_repeater::start (action_t a) {
-      action = a;
+      state->set_action(std::move(a));
       start();
     }
 
@@ -74,31 +338,21 @@ namespace gui {
 
     void background_repeater::schedule_next () {
       if (is_active()) {
-        logging::trace() << "Schedule background_call in " << delay.count() << " ms";
-        task = emscripten_set_timeout(background_call, delay.count(), this);
+        logging::trace() << "Schedule background_call in " << get_delay().count() << " ms";
+        task = emscripten_set_timeout(background_call, get_delay().count(), this);
       }
     }
 #endif //GUIPP_JS
 
     void background_repeater::start () {
-      if (active) {
+      if (state->active.exchange(true)) {
         return;
       }
 #if GUIPP_JS
-      active = true;
       background_call(this);
 #else
-      wait_for_finish();
-      task = std::thread([&] () {
-        active = true;
-        while (active) {
-          const auto end_time = std::chrono::system_clock::now() + delay;
-          do_action();
-          if (active) {
-            std::this_thread::sleep_until(end_time);
-          }
-        }
-      });
+      // the first call is immediately, as before.
+      detail::timer_wheel::get().add(state, detail::timer_wheel::clock::now());
 #endif //GUIPP_JS
     }
 
@@ -106,7 +360,10 @@ namespace gui {
 #if GUIPP_JS
       task = 0;
 #endif //GUIPP_JS
-      action();
+      auto action = state->get_action();
+      if (action && *action) {
+        (*action)();
+      }
     }
 
     void background_repeater::stop () {
@@ -116,27 +373,26 @@ namespace gui {
         task = 0;
       }
 #endif //GUIPP_JS
-      active = false;
+      state->active = false;
+      ++state->generation;
     }
 
     bool background_repeater::is_active () const {
-      return active;
+      return state->active;
     }
 
     void background_repeater::set_delay (std::chrono::milliseconds d) {
-      delay = d;
+      state->delay = d;
     }
 
     std::chrono::milliseconds background_repeater::get_delay () const {
-      return delay;
+      return state->delay;
     }
 
     void background_repeater::wait_for_finish () {
 #ifndef GUIPP_JS
-      active = false;
-      if (task.joinable()) {
-        task.join();
-      }
+      stop();
+      detail::timer_wheel::get().wait_for(state);
 #endif //GUIPP_JS
     }
 
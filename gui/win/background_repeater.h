@@ -22,11 +22,7 @@
 //
 #include <functional>
 #include <chrono>
-#if defined USE_MINGW && __MINGW_GCC_VERSION < 100000
-#include <mingw/mingw.thread.h>
-#else
-#include <thread>
-#endif
+#include <memory>
 
 // --------------------------------------------------------------------------
 //
@@ -45,11 +41,23 @@ namespace gui {
 
     class window;
 
+    namespace detail {
+      struct repeater_state;
+    }
+
+    /**
+     * Calls action every delay ms. All repeaters share one timer wheel that is
+     * serviced by one background thread, the action is called in this thread
+     * and should return fast, long running work delays all other repeaters and
+     * belongs in an own thread. stop never waits, wait_for_finish and the
+     * destructor wait for a running action only.
+     */
     struct GUIPP_WIN_EXPORT background_repeater {
       typedef std::function<void()> action_t;
 
       background_repeater (std::chrono::milliseconds delay_ms, action_t action);
       background_repeater (std::chrono::milliseconds delay_ms);
+      background_repeater (const background_repeater&) = delete;
 
       ~background_repeater ();
 
@@ -66,19 +74,14 @@ namespace gui {
       std::chrono::milliseconds get_delay () const;
 
     private:
-
-      action_t action;
-      std::chrono::milliseconds delay;
-      volatile bool active;
+      std::shared_ptr<detail::repeater_state> state;
 
 #if GUIPP_JS
       static void background_call (void* userData);
 
       void schedule_next ();
 
-      volatile long task;
-#else
-      std::thread task;
+      long task;
 #endif //GUIPP_JS
     };
 
@@ -26,6 +26,7 @@
 //
 // Library includes
 //
+#include "gui/core/tracing.h"
 #include "gui/win/container.h"
 #include "gui/win/native.h"
 
@@ -267,6 +268,7 @@ namespace gui {
                   core::clip clp(*cntxt, crc);
                   native::erase(cntxt->drawable(), cntxt->graphics(), crc, w->get_background());
                   cntxt->set_offset(rect.x(), rect.y());
+                  GUIPP_TRACE_SPAN(paint, "window::paint", w);
                   ret |= w->handle_event(e, r);
                 }
               }
@@ -168,6 +168,8 @@ namespace gui {
         GUIPP_WIN_EXPORT void invalidate_window (os::window id, const core::native_rect&);
         GUIPP_WIN_EXPORT void validate_window (os::window id);
         GUIPP_WIN_EXPORT void draw_invalidated_windows ();
+        /// The render targets lost their content, all windows are painted completely again.
+        GUIPP_WIN_EXPORT void reset_window_backstores ();
 
       } // namespace sdl
 #endif // GUIPP_X11
@@ -21,6 +21,7 @@
 // Common includes
 //
 #include <map>
+#include <set>
 #include <SDL_video.h>
 #include <logging/logger.h>
 
@@ -40,6 +41,8 @@ namespace gui {
     namespace {
       std::map<const char*, class_info> s_window_class_info_map;
       const char* s_guipp_identifier = "GUIPP";
+      // all windows with a guipp overlapped_window, SDL can not enumerate its windows.
+      std::set<os::window> s_windows;
     }
 
     // --------------------------------------------------------------------------
@@ -62,11 +65,13 @@ namespace gui {
       void set_os_window (overlapped_window* win, os::window id) {
         if (win) {
           SDL_SetWindowData(id, s_guipp_identifier, win);
+          s_windows.insert(id);
         }
       }
 
       void unset_os_window (os::window id) {
           SDL_SetWindowData(id, s_guipp_identifier, NULL);
+          s_windows.erase(id);
       }
 
       overlapped_window* get_window (os::window id) {
@@ -451,6 +456,15 @@ namespace gui {
           s_invalidated_windows.clear();
         }
 
+        void reset_window_backstores () {
+          for (auto id : s_windows) {
+            win::overlapped_window* win = get_window(id);
+            if (win) {
+              win->reset_backstore();
+            }
+          }
+        }
+
       } // namespace sdl
 
     } // namespace native
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <map>
 #include <cstring>
+#include <cstdlib>
 
 #ifdef GUIPP_QT
 # include <QtCore/QEventLoop>
@@ -37,6 +38,7 @@
 // Library includes
 //
 #include "gui/core/native.h"
+#include "gui/core/tracing.h"
 #include "gui/win/overlapped_window.h"
 #include "gui/win/window_event_proc.h"
 #include "gui/win/window_event_handler.h"
@@ -107,6 +109,18 @@ namespace gui {
         XFlushGC(core::global::get_instance(), gc);
       }
 
+      bool copy_area (const core::native_rect& src, const core::native_point& dest) {
+        if (!pixel_store) {
+          return false;
+        }
+        auto display = core::global::get_instance();
+        XSetClipMask(display, gc, None);
+        XSetGraphicsExposures(display, gc, False);
+        XCopyArea(display, pixel_store, pixel_store, gc, src.x(), src.y(),
+                  src.width(), src.height(), dest.x(), dest.y());
+        return true;
+      }
+
     private:
       friend class overlapped_window;
       void destroy () {
@@ -186,6 +200,11 @@ namespace gui {
         pixel_store->flush(QRegion(0, 0, size.width(), size.height()));
       }
 
+      bool copy_area (const core::native_rect& src, const core::native_point& dest) {
+        return pixel_store && pixel_store->scroll(QRegion(src.x(), src.y(), src.width(), src.height()),
+                                                  dest.x() - src.x(), dest.y() - src.y());
+      }
+
     private:
       friend class overlapped_window;
       void destroy () {
@@ -268,6 +287,14 @@ namespace gui {
 # endif
       }
 
+      bool copy_area (const core::native_rect& src, const core::native_point& dest) {
+        if (!pixel_store) {
+          return false;
+        }
+        SelectClipRgn(gc, NULL);
+        return BitBlt(gc, dest.x(), dest.y(), src.width(), src.height(), gc, src.x(), src.y(), SRCCOPY) != 0;
+      }
+
     private:
       friend class overlapped_window;
       void destroy () {
@@ -347,6 +374,10 @@ namespace gui {
       void finish (end_return& ctx) {
       }
 
+      bool copy_area (const core::native_rect&, const core::native_point&) {
+        return false;
+      }
+
     private:
       friend class overlapped_window;
       void destroy () {
@@ -375,9 +406,14 @@ namespace gui {
     public:
       overlapped_context ()
         : gc(nullptr)
+        , target(nullptr)
       {}
 
       ~overlapped_context () {
+        if (target) {
+          SDL_DestroyTexture(target);
+          target = nullptr;
+        }
         if (gc) {
           core::native::delete_graphics_context(gc);
           gc = nullptr;
@@ -388,19 +424,37 @@ namespace gui {
         return {pixel_store, gc};
       }
 
+      /// True if the back texture still holds the last painted content in the current window size.
+      bool keeps_content () const {
+        if (!gc || !target) {
+          return false;
+        }
+        int ow = 0, oh = 0, tw = 0, th = 0;
+        SDL_GetRendererOutputSize(gc, &ow, &oh);
+        SDL_QueryTexture(target, nullptr, nullptr, &tw, &th);
+        return (ow == tw) && (oh == th);
+      }
+
       void begin (const win::overlapped_window& w, const core::native_rect& r) {
         auto id = w.get_os_window();
-        auto sz = core::global::scale_to_native(w.client_size());
         pixel_store = id;
         if (!gc) {
           gc = core::native::create_graphics_context(id);
         }
-        auto c = w.get_background();
-        SDL_SetRenderDrawColor(gc, 
-                               static_cast<int>(color::extract<color::part::red>(c)),
-                               static_cast<int>(color::extract<color::part::green>(c)),
-                               static_cast<int>(color::extract<color::part::blue>(c)), 255);
-        SDL_RenderClear(gc);
+        if (!keeps_content()) {
+          create_target();
+        }
+        if (target) {
+          // paint into the back texture, only the invalid rect will be erased and painted.
+          SDL_SetRenderTarget(gc, target);
+        } else {
+          auto c = w.get_background();
+          SDL_SetRenderDrawColor(gc,
+                                 static_cast<int>(color::extract<color::part::red>(c)),
+                                 static_cast<int>(color::extract<color::part::green>(c)),
+                                 static_cast<int>(color::extract<color::part::blue>(c)), 255);
+          SDL_RenderClear(gc);
+        }
       }
 
 # ifdef DEBUG_RECTANGLES
@@ -418,6 +472,30 @@ namespace gui {
       }
 
       void finish (end_return& ctx) {
+        present();
+      }
+
+      bool copy_area (const core::native_rect&, const core::native_point&) {
+        // a texture can not be copied onto itself.
+        return false;
+      }
+
+      /// The content of the back texture is lost, it is created and painted again with the next redraw.
+      void reset () {
+        if (target) {
+          SDL_DestroyTexture(target);
+          target = nullptr;
+        }
+      }
+
+      void present () {
+        if (!gc) {
+          return;
+        }
+        if (target) {
+          SDL_SetRenderTarget(gc, nullptr);
+          SDL_RenderCopy(gc, target, nullptr, nullptr);
+        }
         SDL_RenderPresent(gc);
       }
 
@@ -426,8 +504,23 @@ namespace gui {
       }
 
     private:
+      void create_target () {
+        if (target) {
+          SDL_DestroyTexture(target);
+          target = nullptr;
+        }
+        if (SDL_RenderTargetSupported(gc)) {
+          int ow = 0, oh = 0;
+          SDL_GetRendererOutputSize(gc, &ow, &oh);
+          if ((ow > 0) && (oh > 0)) {
+            target = SDL_CreateTexture(gc, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, ow, oh);
+          }
+        }
+      }
+
       os::drawable pixel_store;
       os::graphics gc;
+      SDL_Texture* target;
     };
 
 #else
@@ -725,6 +818,15 @@ namespace gui {
       invalidate(surface_geometry());
     }
     // --------------------------------------------------------------------------
+    void overlapped_window::reset_backstore () {
+#ifdef GUIPP_SDL
+      if (surface) {
+        surface->reset();
+      }
+#endif
+      invalidate();
+    }
+    // --------------------------------------------------------------------------
     void overlapped_window::invalidate (const core::native_rect& r) {
       if (is_valid() && is_visible()) {
         if (invalid_rect.empty()) {
@@ -739,6 +841,66 @@ namespace gui {
       }
     }
     // --------------------------------------------------------------------------
+    bool detail::scroll_strip (const core::native_rect& area,
+                               const core::native_point& delta,
+                               const core::native_rect& invalid,
+                               core::native_rect& src,
+                               core::native_rect& exposed) {
+      const auto dx = delta.x();
+      const auto dy = delta.y();
+      if ((dx != 0) && (dy != 0)) {
+        // the exposed part is no strip.
+        return false;
+      }
+      const auto w = static_cast<int32_t>(area.width());
+      const auto h = static_cast<int32_t>(area.height());
+      if ((std::abs(dx) >= w) || (std::abs(dy) >= h) || (!invalid.empty() && invalid.overlap(area))) {
+        // nothing stays visible or the backstore content is not up to date.
+        return false;
+      }
+      // src is the part of area that stays visible, exposed the rest.
+      // operator& is not used, it treats the corners as inclusive.
+      src = area;
+      exposed = area;
+      if (dx > 0) {
+        src.width(w - dx);
+        exposed.width(dx);
+      } else if (dx < 0) {
+        src.x(area.x() - dx).width(w + dx);
+        exposed.x(area.x2() + dx).width(-dx);
+      } else if (dy > 0) {
+        src.height(h - dy);
+        exposed.height(dy);
+      } else {
+        src.y(area.y() - dy).height(h + dy);
+        exposed.y(area.y2() + dy).height(-dy);
+      }
+      return true;
+    }
+    // --------------------------------------------------------------------------
+    void overlapped_window::scroll (const core::native_rect& area, const core::native_point& delta) {
+      if (!is_valid() || !is_visible() || area.empty()) {
+        return;
+      }
+      if ((delta.x() == 0) && (delta.y() == 0)) {
+        return;
+      }
+      core::native_rect src, exposed;
+      if (!detail::scroll_strip(area, delta, invalid_rect, src, exposed) ||
+          !get_context().copy_area(src, src.position() + delta)) {
+        invalidate(area);
+      } else {
+        logging::trace() << "scroll: " << area << " by " << delta << ", exposed " << exposed << " in window " << this;
+        invalidate(exposed);
+#ifdef GUIPP_WIN
+        // end() presents through the BeginPaint DC, that is clipped to the
+        // update region: only the strip is painted, but the moved part must
+        // be in the update region to be copied to the screen, too.
+        native::invalidate(get_os_window(), area);
+#endif // GUIPP_WIN
+      }
+    }
+    // --------------------------------------------------------------------------
     void frame_window (core::context& ctx, window* win, os::color col) {
       if (win) {
         native::frame(ctx.drawable(), ctx.graphics(), win->surface_geometry(), col);
@@ -748,8 +910,11 @@ namespace gui {
     void overlapped_window::redraw (const core::native_rect& r) {
       if (is_visible() && !get_state().redraw_disabled()) {
 #ifdef GUIPP_SDL
-        invalid_rect = surface_geometry();
-#else
+        if (!get_context().keeps_content()) {
+          // a new or resized back texture must be painted completely.
+          invalid_rect = surface_geometry();
+        }
+#endif
         if (!r.empty()) {
           if (invalid_rect.empty()) {
             invalid_rect = r;
@@ -758,11 +923,21 @@ namespace gui {
           }
         }
         if (invalid_rect.empty()) {
+#ifdef GUIPP_SDL
+          // exposed without changes: show the back texture again.
+          get_context().present();
+#endif
+#ifdef GUIPP_WIN
+          // exposed or scrolled without changes: copy the backstore and
+          // validate the update region, else WM_PAINT is sent again.
+          auto ctx = get_context().end(get_os_window());
+          get_context().finish(ctx);
+#endif
           logging::trace() << "skip redraw, invalid_rect is empty " << this;
           return;
         }
-#endif
         util::time::chronometer chrono;
+        GUIPP_TRACE_SPAN(paint, "overlapped_window::redraw", this);
 #ifdef GUIPP_QT
         if (!get_os_window()->isExposed()) {
           logging::trace() << "skip redraw, window is not exposed " << this;
@@ -804,7 +979,10 @@ namespace gui {
 
 //        clp.unclip();
 
-        surface.finish(wctxt);
+        {
+          GUIPP_TRACE_SPAN(present, "overlapped_window::present", this);
+          surface.finish(wctxt);
+        }
 
         invalid_rect = core::native_rect::zero;
         logging::trace() << "overlapped_window::redraw finished in "<< chrono.stop();
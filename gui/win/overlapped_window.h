@@ -61,6 +61,20 @@ namespace gui {
 
     class overlapped_context;
 
+    namespace detail {
+      /**
+       * The part of area that stays visible when its content moves by delta,
+       * and the strip that gets exposed. Returns false if the area has to be
+       * painted completely: both axes move, nothing stays visible or a repaint
+       * is pending inside the area.
+       */
+      GUIPP_WIN_EXPORT bool scroll_strip (const core::native_rect& area,
+                                          const core::native_point& delta,
+                                          const core::native_rect& invalid,
+                                          core::native_rect& src,
+                                          core::native_rect& exposed);
+    }
+
     // --------------------------------------------------------------------------
     class GUIPP_WIN_EXPORT overlapped_window : public container {
     public:
@@ -101,6 +115,12 @@ namespace gui {
       void invalidate (const core::native_rect&) override;
       void invalidate ();
       void redraw (const core::native_rect&);
+      /// Discard the painted content of the backstore and repaint the whole window.
+      void reset_backstore ();
+
+      /// Move the painted content of area by delta inside the backstore and
+      /// invalidate only the exposed strip. Falls back to invalidate area.
+      void scroll (const core::native_rect& area, const core::native_point& delta);
 
       core::point position () const override;
       using window::position;
@@ -428,6 +428,24 @@ namespace gui {
       }
     }
 
+    void window::invalidate (const core::rectangle& r) const {
+      if (is_valid() && is_visible() && !r.empty()) {
+        const auto geo = surface_geometry();
+        auto area = core::global::scale_to_native(r);
+        area.move(geo.top_left());
+        area &= geo;
+        if (area.empty()) {
+          return;
+        }
+        logging::trace() << "invalidate: " << area << " in " << *this;
+        if (get_parent() && !get_state().overlapped()) {
+          get_parent()->invalidate(area);
+        } else {
+          get_overlapped_window().invalidate(area);
+        }
+      }
+    }
+
     void window::redraw () const {
       if (is_visible() && !get_state().redraw_disabled()) {
         logging::trace() << "redraw: " << *this;
@@ -435,6 +453,29 @@ namespace gui {
       }
     }
 
+    void window::scroll_content (const core::point& delta) const {
+      scroll_content(core::rectangle(client_size()), delta);
+    }
+
+    void window::scroll_content (const core::rectangle& area, const core::point& delta) const {
+      if (is_valid() && is_visible()) {
+        core::native_rect r = core::global::scale_to_native(area) + surface_position();
+        // only the part visible in all parents can be copied.
+        const window* w = this;
+        while (w->get_parent() && !w->get_state().overlapped()) {
+          w = w->get_parent();
+          r &= w->surface_geometry();
+        }
+        const core::native_point d = core::global::scale_to_native(delta);
+        if (core::global::scale_from_native(d) == delta) {
+          get_overlapped_window().scroll(r, d);
+        } else {
+          // fractional pixels can not be copied.
+          get_overlapped_window().invalidate(r);
+        }
+      }
+    }
+
     core::size window::size () const {
       return area.size();
     }
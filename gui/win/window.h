@@ -93,8 +93,14 @@ namespace gui {
       void to_back ();
 
       void invalidate () const;
+      /// Invalidate only area, given in client coordinates.
+      void invalidate (const core::rectangle& area) const;
       void redraw () const;
 
+      /// Move the painted content by delta and repaint only the exposed part.
+      void scroll_content (const core::point& delta) const;
+      void scroll_content (const core::rectangle& area, const core::point& delta) const;
+
       core::size size () const;
       virtual core::size client_size () const;
 
@@ -82,6 +82,9 @@ namespace gui {
     typedef void (simple_action)();
 
     GUIPP_WIN_EXPORT void run_on_main (const window& w, const std::function<simple_action>& action);
+    /// Any thread: queue action for the main loop without a window, e.g. when
+    /// the window that started the work may be gone when it is posted.
+    GUIPP_WIN_EXPORT void run_on_main (const std::function<simple_action>& action);
 
   } // namespace win
 
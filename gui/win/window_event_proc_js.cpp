@@ -255,6 +255,8 @@ namespace gui {
 
     void run_on_main (const window& w, const std::function<void()>& action) {}
 
+    void run_on_main (const std::function<void()>& action) {}
+
   }   // win
 } // gui
 
@@ -22,12 +22,13 @@
 // Common includes
 //
 #include <algorithm>
+#include <atomic>
 #include <set>
 #include <thread>
 
 #include <QtGui/QGuiApplication>
 #include <QtCore/QEventLoop>
-#include <QtCore/QTimer>
+#include <QtCore/QThread>
 
 #include <logging/logger.h>
 #include <util/robbery.h>
@@ -38,6 +39,8 @@
 // Library includes
 //
 #include "gui/core/native.h"
+#include "gui/core/mpsc_queue.h"
+#include "gui/core/tracing.h"
 #include "gui/win/overlapped_window.h"
 #include "gui/win/window_event_proc.h"
 #include "gui/win/dbg_win_message.h"
@@ -120,6 +123,96 @@ namespace gui {
         }
       }
 
+      // --------------------------------------------------------------------------
+      /**
+       * Long living receiver for run_on_main. Actions are queued without lock
+       * and executed in batches, one posted event wakes the main thread per batch.
+       */
+      class ActionDispatcher : public QObject {
+      public:
+        typedef QObject super;
+        typedef core::mpsc_queue<std::function<simple_action>, 4096> action_queue;
+
+        static ActionDispatcher& get ();
+
+        void post (const std::function<simple_action>& action);
+
+        bool event (QEvent* e) override;
+
+      private:
+        ActionDispatcher ();
+
+        void schedule ();
+        void drain ();
+
+        static QEvent::Type get_drain_event ();
+
+        action_queue queue;
+        std::atomic_bool drain_pending;
+      };
+
+      ActionDispatcher::ActionDispatcher ()
+        : drain_pending(false)
+      {
+        moveToThread(core::global::get_instance()->thread());
+      }
+
+      ActionDispatcher& ActionDispatcher::get () {
+        // lazy create static, never deleted because it has to outlive the application object.
+        static ActionDispatcher* dispatcher = new ActionDispatcher();
+        return *dispatcher;
+      }
+
+      QEvent::Type ActionDispatcher::get_drain_event () {
+        // lazy create static
+        static QEvent::Type drain_event = static_cast<QEvent::Type>(QEvent::registerEventType());
+        return drain_event;
+      }
+
+      void ActionDispatcher::post (const std::function<simple_action>& action) {
+        while (!queue.push(action)) {
+          if (QThread::currentThread() == thread()) {
+            // the main thread can not wait for itself.
+            drain();
+          } else {
+            schedule();
+            std::this_thread::yield();
+          }
+        }
+        schedule();
+      }
+
+      void ActionDispatcher::schedule () {
+        // coalesce: only one drain event is in the Qt queue at any time.
+        if (!drain_pending.exchange(true)) {
+          QCoreApplication::postEvent(this, new QEvent(get_drain_event()));
+        }
+      }
+
+      bool ActionDispatcher::event (QEvent* e) {
+        if (e->type() == get_drain_event()) {
+          drain();
+          return true;
+        }
+        return super::event(e);
+      }
+
+      void ActionDispatcher::drain () {
+        // reset first, a post during the drain schedules the next one.
+        drain_pending.store(false);
+
+        // limit a batch to the queue size, to not starve the other events.
+        std::function<simple_action> action;
+        for (std::size_t i = 0; i < action_queue::capacity; ++i) {
+          if (!queue.pop(action)) {
+            return;
+          }
+          GUIPP_TRACE_SPAN(action, "queued_action", nullptr);
+          action();
+        }
+        schedule();
+      }
+
       // --------------------------------------------------------------------------
       bool check_hot_key (const core::event& e) {
         if (e.type() == QEvent::KeyPress) {
@@ -237,17 +330,12 @@ namespace gui {
       gui::core::global::get_instance()->exit();
     }
 
-    void run_on_main (const window& w, const std::function<void()>& action) {
-      QTimer* timer = new QTimer();
-      timer->moveToThread(qApp->thread());
-      timer->setSingleShot(true);
-      QObject::connect(timer, &QTimer::timeout, [=]()
-      {
-        // main thread
-        action();
-        timer->deleteLater();
-      });
-      QMetaObject::invokeMethod(timer, "start", Qt::QueuedConnection, Q_ARG(int, 0));
+    void run_on_main (const window&, const std::function<void()>& action) {
+      run_on_main(action);
+    }
+
+    void run_on_main (const std::function<void()>& action) {
+      detail::ActionDispatcher::get().post(action);
     }
   }   // win
 } // gui
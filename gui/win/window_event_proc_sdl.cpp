@@ -21,16 +21,19 @@
 // Common includes
 //
 #include <algorithm>
+#include <atomic>
 #include <set>
 #include <thread>
 
 #include <logging/logger.h>
+#include <util/blocking_queue.h>
 
 // --------------------------------------------------------------------------
 //
 // Library includes
 //
 #include "gui/core/native.h"
+#include "gui/core/tracing.h"
 #include "gui/win/overlapped_window.h"
 #include "gui/win/window_event_proc.h"
 #include "gui/win/dbg_win_message.h"
@@ -42,6 +45,60 @@ namespace gui {
 
   namespace win {
 
+    namespace sdl {
+
+      typedef util::blocking_queue<std::function<simple_action>> simple_action_queue;
+      simple_action_queue queued_actions;
+
+      // set while a wake event is in the SDL queue, so a burst of posts pushes only one.
+      std::atomic_bool wake_pending(false);
+
+      /// Max. actions executed per loop round, to keep input and paint responsive.
+      constexpr int max_actions_per_round = 256;
+
+      /// Upper bound for one wait, in case a wake event got lost.
+      constexpr int max_wait_ms = 250;
+
+      Uint32 get_wake_event () {
+        // lazy create static
+        static Uint32 wake_event = SDL_RegisterEvents(1);
+        return wake_event;
+      }
+
+      bool is_wake_event (const SDL_Event& e) {
+        return (e.type == get_wake_event()) && (e.type != static_cast<Uint32>(-1));
+      }
+
+      void wake_up () {
+        if (!wake_pending.exchange(true)) {
+          SDL_Event event;
+          SDL_zero(event);
+          event.type = get_wake_event();
+          if (SDL_PushEvent(&event) < 1) {
+            // the loop falls back to max_wait_ms
+            wake_pending.store(false);
+          }
+        }
+      }
+
+      // returns true if the round limit was reached and actions may be left.
+      bool drain_actions () {
+        // reset first, a post during the drain wakes the next round.
+        wake_pending.store(false);
+
+        std::function<simple_action> action;
+        for (int i = 0; i < max_actions_per_round; ++i) {
+          if (!queued_actions.try_dequeue(action)) {
+            return false;
+          }
+          GUIPP_TRACE_SPAN(action, "queued_action", nullptr);
+          action();
+        }
+        return true;
+      }
+
+    } // namespace sdl
+
     // --------------------------------------------------------------------------
     namespace detail {
 
@@ -140,6 +197,7 @@ namespace gui {
       win::overlapped_window* win = win::native::get_window(id);
       
       if (win && win->is_valid()) {
+        GUIPP_TRACE_SPAN(event, "process_event", win);
 
         resultValue = 0;
 
@@ -161,28 +219,37 @@ namespace gui {
       gui::os::event_result resultValue = 0;
 
       SDL_Event event;
+      int wait_ms = sdl::max_wait_ms;
       while (running) {
-        while (SDL_PollEvent(&event)) {
-          if (event.type == SDL_QUIT) {
-            logging::trace() << "Received quit event: " << event;
-          }
-
-          if ((event.type == SDL_WINDOWEVENT) && (event.window.event == SDL_WINDOWEVENT_EXPOSED)) {
-            auto id = SDL_GetWindowFromID(event.window.windowID);
-            int w = 0, h = 0;
-            SDL_GetWindowSize(id, &w, &h);
-            native::sdl::invalidate_window(id, {0, 0, static_cast<unsigned>(w), static_cast<unsigned>(h)});
+        // block until the first event, a wake up or the timeout, then take all pending events.
+        bool has_event = SDL_WaitEventTimeout(&event, wait_ms) != 0;
+        while (has_event) {
+          if (sdl::is_wake_event(event)) {
+            // only wakes the loop, queued actions are drained below.
+          } else if ((event.type == SDL_WINDOWEVENT) && (event.window.event == SDL_WINDOWEVENT_EXPOSED)) {
+            // the window keeps its content in a back texture, an expose only presents it again.
+            auto* win = native::get_window(SDL_GetWindowFromID(event.window.windowID));
+            if (win && win->is_visible()) {
+              win->redraw(core::native_rect::zero);
+            }
+          } else if ((event.type == SDL_RENDER_TARGETS_RESET) || (event.type == SDL_RENDER_DEVICE_RESET)) {
+            logging::debug() << "Render targets lost, repaint all windows";
+            native::sdl::reset_window_backstores();
           } else {
-            if (detail::check_message_filter(event) || (filter && filter(event))) {
-              continue;
-            } else {
+            if (event.type == SDL_QUIT) {
+              logging::trace() << "Received quit event: " << event;
+            }
+            if (!detail::check_message_filter(event) && !(filter && filter(event))) {
               process_event(event, resultValue);
             }
           }
+          has_event = running && SDL_PollEvent(&event);
         }
-        native::sdl::draw_invalidated_windows();
 
-        SDL_Delay(20);
+        // don't wait if the last round left actions in the queue.
+        wait_ms = sdl::drain_actions() ? 0 : sdl::max_wait_ms;
+
+        native::sdl::draw_invalidated_windows();
       }
 
       return resultValue;
@@ -200,10 +267,18 @@ namespace gui {
     void quit_main_loop () {
       logging::trace() << "Received quit_main_loop()";
       main_loop_is_running = false;
+      sdl::wake_up();
       core::global::fini();
     }
 
-    void run_on_main (const window& w, const std::function<void()>& action) {}
+    void run_on_main (const window&, const std::function<void()>& action) {
+      run_on_main(action);
+    }
+
+    void run_on_main (const std::function<void()>& action) {
+      sdl::queued_actions.enqueue(action);
+      sdl::wake_up();
+    }
 
   }   // win
 } // gui
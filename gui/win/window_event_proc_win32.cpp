@@ -254,7 +254,11 @@ namespace gui {
       core::global::fini();
     }
 
-    void run_on_main (const window& w, const std::function<void()>& action) {
+    void run_on_main (const window&, const std::function<void()>& action) {
+      run_on_main(action);
+    }
+
+    void run_on_main (const std::function<void()>& action) {
       DWORD thread_id = GetWindowThreadProcessId(GetForegroundWindow(), NULL);
       PostThreadMessage(thread_id,
                         detail::ACTION_MESSAGE,
@@ -34,6 +34,7 @@
 // Library includes
 //
 #include "gui/core/native.h"
+#include "gui/core/tracing.h"
 #include "gui/win/overlapped_window.h"
 #include "gui/win/window_event_proc.h"
 #include "gui/win/dbg_win_message.h"
@@ -224,6 +225,7 @@ namespace gui {
       win::window* win = win::detail::get_event_window(e);
 
       if (win && win->is_valid()) {
+        GUIPP_TRACE_SPAN(event, "process_event", win);
 
         resultValue = 0;
 
@@ -287,6 +289,7 @@ namespace gui {
         }
 
         if (x11::queued_actions.try_dequeue(action)) {
+          GUIPP_TRACE_SPAN(action, "queued_action", nullptr);
           action();
         } else {
           wait_for_event(fd);
@@ -317,20 +320,42 @@ namespace gui {
       core::global::fini();
     }
 
-    void run_on_main (const window& w, const std::function<void()>& action) {
-      x11::queued_actions.enqueue(action);
+    namespace {
 
-      gui::os::instance display = core::global::get_instance();
+      void wake_up (gui::os::window target) {
+        gui::os::instance display = core::global::get_instance();
 
-      XClientMessageEvent event;
-      memset(&event, 0, sizeof(event));
+        XClientMessageEvent event;
+        memset(&event, 0, sizeof(event));
+
+        event.type = ClientMessage;
+        event.send_event = True;
+        event.display = display;
+        event.window = target;
+        event.format = 32;
+        XSendEvent(display, event.window, False, 0, (XEvent*)&event);
+      }
+
+      gui::os::window get_action_window () {
+        // lazy create static, an unmapped window only to wake up the main loop.
+        static gui::os::window w = [] () {
+          gui::os::instance display = core::global::get_instance();
+          return XCreateWindow(display, DefaultRootWindow(display), 0, 0, 1, 1, 0,
+                               CopyFromParent, InputOnly, CopyFromParent, 0, nullptr);
+        }();
+        return w;
+      }
 
-      event.type = ClientMessage;
-      event.send_event = True;
-      event.display = display;
-      event.window = w.get_overlapped_window().get_os_window();
-      event.format = 32;
-      XSendEvent(display, event.window, False, 0, (XEvent*)&event);
+    }
+
+    void run_on_main (const window& w, const std::function<void()>& action) {
+      x11::queued_actions.enqueue(action);
+      wake_up(w.get_overlapped_window().get_os_window());
+    }
+
+    void run_on_main (const std::function<void()>& action) {
+      x11::queued_actions.enqueue(action);
+      wake_up(get_action_window());
     }
   }   // win
 } // gui
@@ -35,6 +35,12 @@ namespace testing {
 #ifdef GUIPP_JS
   gui::core::global::init(emscripten::val::global("document"));
 #endif //GUIPP_JS
+#ifdef GUIPP_SDL
+    // the dummy driver needs no display, SDL_VIDEODRIVER may select another one.
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 0);
+    SDL_Init(SDL_INIT_VIDEO);
+    gui::core::global::init(SDL_GetNumVideoDisplays() > -1 ? 0 : -1);
+#endif //GUIPP_SDL
   }
 
 }
@@ -1,5 +1,7 @@
 
 
+#include <atomic>
+#include <thread>
 #include <util/ostreamfmt.h>
 #include <util/fps_counter.h>
 #include "gui/draw/datamap.h"
@@ -9,7 +11,6 @@
 #include "gui/draw/shared_datamap.h"
 #include "gui/layout/split_layout.h"
 #include "gui/win/overlapped_window.h"
-#include "gui/win/background_repeater.h"
 #include "gui/ctrl/toggle_group.h"
 
 #ifdef NDEBUG
@@ -87,13 +88,21 @@ int gui_main(const std::vector<std::string>& /*args*/) {
     main.invalidate();
   };
 
-  background_repeater task(std::chrono::milliseconds(ms_delay), [&] () {
-    if (buttons.get_selection_index()) {
-      draw_gray();
-    } else {
-      draw_colors();
+  // rendering a frame takes too long for the shared timer of the
+  // background_repeater, it would delay all other repeaters.
+  std::atomic_bool running(false);
+  std::thread task;
+  auto render = [&] () {
+    while (running) {
+      const auto next = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms_delay);
+      if (buttons.get_selection_index()) {
+        draw_gray();
+      } else {
+        draw_colors();
+      }
+      std::this_thread::sleep_until(next);
     }
-  });
+  };
 
   main.on_destroy(&quit_main_loop);
   main.set_title("BackgroundTaskApp");
@@ -110,9 +119,13 @@ int gui_main(const std::vector<std::string>& /*args*/) {
     }
   }));
   main.set_visible();
-  task.start();
+  running = true;
+  task = std::thread(render);
 
   auto ret = run_main_loop();
 
+  running = false;
+  task.join();
+
   return ret;
 }
@@ -61,7 +61,7 @@ int gui_main(const std::vector<std::string>& /*args*/) {
     first->add_open_node(current.root_path());
     first->update_node_list();
     first->select_node(current);
-    client.get<1>().set_path(current);
+    client.get<1>().set_path_async(current);
     client.init([] (container&, const sys_fs::path& path) {
       if (sys_fs::is_regular_file(path)) {
         logging::debug() << "Exec " << path;
@@ -0,0 +1,109 @@
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <logging/logger.h>
+#include <util/ostreamfmt.h>
+#include <gui/win/overlapped_window.h>
+#include <gui/win/window_event_proc.h>
+#include <gui/draw/graphics.h>
+#include <gui/draw/drawers.h>
+#include <gui/draw/font.h>
+
+// --------------------------------------------------------------------------
+// Measures the throughput of run_on_main: some worker threads post small
+// actions as fast as possible, the main thread counts the executed ones.
+// The first run posts without limit, comparable to older measurements, the
+// second keeps at most max_in_flight actions queued.
+int gui_main(const std::vector<std::string>& /*args*/) {
+  using namespace gui;
+  using namespace gui::win;
+  using namespace gui::draw;
+
+  typedef std::chrono::steady_clock clock;
+
+  const std::size_t thread_count = std::max(3U, std::thread::hardware_concurrency()) - 1;
+  const std::size_t posts_per_thread = 100000;
+  const std::size_t total = thread_count * posts_per_thread;
+  // less than the queue of the Qt dispatcher, so a post never blocks on a full queue.
+  const std::size_t max_in_flight = 2048;
+
+  main_window main;
+
+  std::size_t executed = 0;
+  std::string results[2] = {"Running unthrottled ...", ""};
+  clock::time_point start;
+  std::vector<std::thread> workers;
+  std::atomic_bool stop(false);
+  std::atomic<std::size_t> in_flight(0);
+
+  std::function<void(bool)> run = [&] (bool throttled) {
+    executed = 0;
+    start = clock::now();
+    for (std::size_t t = 0; t < thread_count; ++t) {
+      workers.emplace_back([&, throttled] () {
+        for (std::size_t i = 0; (i < posts_per_thread) && !stop; ++i) {
+          while (throttled && (in_flight >= max_in_flight) && !stop) {
+            std::this_thread::yield();
+          }
+          ++in_flight;
+          run_on_main(main, [&, throttled] () {
+            --in_flight;
+            if (stop) {
+              return;
+            }
+            if (++executed == total) {
+              const auto us = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start).count();
+              std::string& result = results[throttled ? 1 : 0];
+              const std::string mode = throttled ? ostreamfmt("throttled to " << max_in_flight)
+                                                 : std::string("unthrottled");
+              result = ostreamfmt(mode << ": " << total << " actions from " << thread_count << " threads in "
+                                  << (us / 1000) << " ms: "
+                                  << (us ? total * 1000000 / us : 0) << " posts/s");
+              logging::info() << result;
+              if (!throttled) {
+                // all posts are executed, the workers are about to finish.
+                for (auto& w : workers) {
+                  w.join();
+                }
+                workers.clear();
+                results[1] = "Running throttled ...";
+                run(true);
+              }
+              main.invalidate();
+            }
+          });
+        }
+      });
+    }
+  };
+
+  main.create({50, 50, 800, 200});
+  main.on_destroy([&] () {
+    // the workers are joined after the main loop, they may wait for queued actions to run.
+    stop = true;
+    quit_main_loop();
+  });
+  main.on_paint(paint([&](graphics& graph){
+    auto r = main.client_geometry();
+    r.height(r.height() / 2);
+    for (const auto& result : results) {
+      graph.text(text_box(result, r, text_origin_t::center), font::system(), color::black);
+      r.move_y(r.height());
+    }
+  }));
+  main.set_title("run_on_main benchmark");
+  main.set_visible();
+
+  run(false);
+
+  const int ret = run_main_loop();
+  stop = true;
+  for (auto& w : workers) {
+    w.join();
+  }
+  return ret;
+}
@@ -43,8 +43,8 @@ public:
     current_path = dir;
     current_dir = fake_fs[dir];
     super::clear_selection();
-    super::set_scroll_pos(core::point::zero);
     super::invalidate();
+    super::set_scroll_pos(core::point::zero);
     for (const auto& p : util::string::split<'/'>(current_path)) {
       if (!p.empty()) {
         buttons.add_button(p);
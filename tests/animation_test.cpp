@@ -0,0 +1,170 @@
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <thread>
+
+#include "gui/win/animation.h"
+#include "gui/win/window_event_proc.h"
+#include "testlib.h"
+
+
+using namespace gui;
+using namespace gui::win;
+
+namespace {
+
+  typedef animation::kinetic::type type;
+
+  void sleep_ms (int ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  }
+
+  struct loop_state {
+    volatile bool running = true;
+    std::atomic_bool finished{false};
+  };
+
+  // runs the main loop until done returns true or two seconds passed.
+  bool run_until (const std::function<bool()>& done) {
+    auto s = std::make_shared<loop_state>();
+    const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    std::thread ticker([s, &done, end] () {
+      while (!s->finished) {
+        // actions left in the queue do nothing after finished.
+        run_on_main([s, &done, end] () {
+          if (!s->finished && (done() || (std::chrono::steady_clock::now() > end))) {
+            s->finished = true;
+            s->running = false;
+          }
+        });
+        sleep_ms(5);
+      }
+    });
+    run_loop(s->running);
+    ticker.join();
+    return done();
+  }
+
+}
+
+// --------------------------------------------------------------------------
+void test_move_by_distance () {
+  animation::kinetic k;
+  type pos = 0;
+  int steps = 0;
+  k.set_scroll([&] (type d) {
+    EXPECT_EQUAL(d, std::trunc(d));
+    pos += d;
+    ++steps;
+    return true;
+  });
+
+  for (type distance : {60.0F, -60.0F, 1.0F, 333.0F}) {
+    pos = 0;
+    k.move_by(distance);
+    EXPECT_TRUE(k.is_active());
+    EXPECT_TRUE(run_until([&] () {
+      return !k.is_active();
+    }));
+    EXPECT_EQUAL(pos, distance);
+  }
+  EXPECT_TRUE(steps > 4, "only ", steps, " steps");
+
+  // two wheel steps in a row add up.
+  pos = 0;
+  k.move_by(40);
+  k.move_by(40);
+  EXPECT_TRUE(run_until([&] () {
+    return !k.is_active();
+  }));
+  EXPECT_EQUAL(pos, 80);
+}
+
+// --------------------------------------------------------------------------
+void test_move_to_limit () {
+  animation::kinetic k;
+  type pos = 0;
+  k.set_scroll([&] (type d) {
+    pos = std::min<type>(pos + d, 10);
+    return pos < 10;
+  });
+  k.move_by(100);
+  EXPECT_TRUE(run_until([&] () {
+    return !k.is_active();
+  }));
+  EXPECT_EQUAL(pos, 10);
+  EXPECT_EQUAL(k.get_velocity(), 0);
+}
+
+// --------------------------------------------------------------------------
+void test_release_velocity () {
+  animation::kinetic k;
+  type pos = 0;
+  k.set_scroll([&] (type d) {
+    pos += d;
+    return true;
+  });
+
+  // 10 pixel every 10 ms is at most 1000 pixel per second.
+  for (int i = 0; i < 10; ++i) {
+    k.track(i * 10.0F);
+    sleep_ms(10);
+  }
+  k.release();
+  EXPECT_TRUE(k.is_active());
+  const type v = k.get_velocity();
+  EXPECT_TRUE((v > 500) && (v <= 1000), "release velocity ", v);
+  EXPECT_TRUE(run_until([&] () {
+    return !k.is_active();
+  }));
+  EXPECT_TRUE(pos > 0, "fling ended at ", pos);
+
+  // a drag that stopped before the release does not fling.
+  k.track(0);
+  sleep_ms(10);
+  k.track(50);
+  sleep_ms(static_cast<int>(animation::kinetic::track_time.count()) + 20);
+  k.release();
+  EXPECT_TRUE(!k.is_active());
+  EXPECT_EQUAL(k.get_velocity(), 0);
+
+  // a slow drag does not fling either.
+  k.track(0);
+  sleep_ms(50);
+  k.track(0.5F);
+  k.release();
+  EXPECT_TRUE(!k.is_active());
+}
+
+// --------------------------------------------------------------------------
+void test_engine_fps () {
+  int calls = 0;
+  float last = -1;
+  bool finished = false;
+  animation::engine e(std::chrono::milliseconds(300), 10);
+  e.add([&] (float f) {
+    EXPECT_TRUE(f >= last);
+    last = f;
+    ++calls;
+  });
+  e.start([&] () {
+    finished = true;
+  });
+  EXPECT_TRUE(run_until([&] () {
+    return finished;
+  }));
+  EXPECT_EQUAL(last, 1.0F);
+  // 10 fps for 300 ms and the last step, the scheduler alone would call 18 times.
+  EXPECT_TRUE((calls >= 2) && (calls <= 5), calls, " calls at 10 fps");
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::log_info("Running animation_test");
+  run_test(test_move_by_distance);
+  run_test(test_move_to_limit);
+  run_test(test_release_velocity);
+  run_test(test_engine_fps);
+}
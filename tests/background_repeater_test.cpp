@@ -0,0 +1,134 @@
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gui/win/background_repeater.h"
+#include "testlib.h"
+
+
+using namespace gui;
+
+namespace {
+  void sleep_ms (int ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  }
+}
+
+// --------------------------------------------------------------------------
+void test_repeater_calls () {
+  std::atomic<int> count(0);
+  win::background_repeater r(std::chrono::milliseconds(5), [&] () {
+    ++count;
+  });
+  EXPECT_TRUE(!r.is_active());
+  r.start();
+  EXPECT_TRUE(r.is_active());
+  sleep_ms(100);
+  r.stop();
+  r.wait_for_finish();
+  EXPECT_TRUE(!r.is_active());
+
+  const int stopped = count;
+  EXPECT_TRUE(stopped >= 5, "only ", stopped, " calls in 100 ms");
+  sleep_ms(30);
+  EXPECT_EQUAL(count, stopped);
+}
+
+// --------------------------------------------------------------------------
+void test_repeater_stop_in_action () {
+  std::atomic<int> count(0);
+  win::background_repeater r(std::chrono::milliseconds(2));
+  r.start([&] () {
+    if (++count == 3) {
+      r.stop();
+    }
+  });
+  sleep_ms(60);
+  EXPECT_EQUAL(count, 3);
+  EXPECT_TRUE(!r.is_active());
+}
+
+// --------------------------------------------------------------------------
+void test_repeater_restart () {
+  std::atomic<int> count(0);
+  win::background_repeater r(std::chrono::milliseconds(200), [&] () {
+    ++count;
+  });
+  // each start calls the action immediately, stopped entries are dropped.
+  for (int i = 0; i < 10; ++i) {
+    r.start();
+    sleep_ms(5);
+    r.stop();
+  }
+  r.wait_for_finish();
+  EXPECT_EQUAL(count, 10);
+
+  r.set_delay(std::chrono::milliseconds(5));
+  EXPECT_EQUAL(r.get_delay().count(), 5);
+  r.start();
+  sleep_ms(60);
+  r.stop();
+  r.wait_for_finish();
+  EXPECT_TRUE(count > 13, "only ", count - 10, " calls after set_delay");
+}
+
+// --------------------------------------------------------------------------
+void test_wait_for_own_action () {
+  std::atomic<int> fast_calls(0);
+  std::atomic_bool slow_running(false);
+  win::background_repeater fast(std::chrono::milliseconds(500), [&] () {
+    ++fast_calls;
+  });
+  win::background_repeater slow(std::chrono::milliseconds(500), [&] () {
+    slow_running = true;
+    sleep_ms(150);
+    slow_running = false;
+  });
+  // both are due now and may run in one batch.
+  fast.start();
+  slow.start();
+  sleep_ms(30);
+  EXPECT_EQUAL(fast_calls, 1);
+  EXPECT_TRUE(slow_running);
+
+  const auto start = std::chrono::steady_clock::now();
+  fast.wait_for_finish();
+  const auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+  EXPECT_TRUE(waited.count() < 50, "waited ", waited.count(), " ms for the slow action");
+  slow.wait_for_finish();
+  EXPECT_TRUE(!slow_running);
+}
+
+// --------------------------------------------------------------------------
+void test_many_repeaters () {
+  const int n = 200;
+  std::vector<std::atomic<int>> counts(n);
+  std::vector<std::unique_ptr<win::background_repeater>> repeaters;
+  for (int i = 0; i < n; ++i) {
+    counts[i] = 0;
+    repeaters.emplace_back(new win::background_repeater(std::chrono::milliseconds(10 + i % 50), [&, i] () {
+      ++counts[i];
+    }));
+    repeaters.back()->start();
+  }
+  sleep_ms(200);
+  int calls = 0;
+  for (int i = 0; i < n; ++i) {
+    EXPECT_TRUE(counts[i] >= 2, "repeater ", i, " called ", counts[i], " times");
+    calls += counts[i];
+  }
+  repeaters.clear();
+  testing::log_info("200 repeaters: ", calls, " calls in 200 ms");
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::log_info("Running background_repeater_test");
+  run_test(test_repeater_calls);
+  run_test(test_repeater_stop_in_action);
+  run_test(test_repeater_restart);
+  run_test(test_wait_for_own_action);
+  run_test(test_many_repeaters);
+}
@@ -0,0 +1,129 @@
+
+#include "gui/ctrl/column_list.h"
+#include "testlib.h"
+
+
+using namespace gui;
+using namespace gui::layout;
+
+namespace {
+
+  template<typename L>
+  std::vector<column_size_type> left_positions (const L& l) {
+    std::vector<column_size_type> pos;
+    for (std::size_t i = 0; i <= l.get_column_count(); ++i) {
+      pos.push_back(l.get_column_left_pos(i));
+    }
+    return pos;
+  }
+
+  typedef std::vector<column_size_type> positions;
+
+}
+
+// --------------------------------------------------------------------------
+void test_base_layout () {
+  detail::column_list_layout l(nullptr);
+  EXPECT_EQUAL(l.index_at(5), -1);
+  EXPECT_EQUAL(l.get_column_left_pos(0), 0);
+
+  l.set_columns({{10}, {20}, {30}});
+  EXPECT_TRUE(left_positions(l) == positions({0, 10, 30, 60}));
+  EXPECT_EQUAL(l.get_column_left_pos(7), 60);
+  EXPECT_EQUAL(l.get_column_right_pos(1), 30);
+  EXPECT_EQUAL(l.index_at(-1), -1);
+  EXPECT_EQUAL(l.index_at(0), 0);
+  EXPECT_EQUAL(l.index_at(9), 0);
+  EXPECT_EQUAL(l.index_at(10), 1);
+  EXPECT_EQUAL(l.index_at(29), 1);
+  EXPECT_EQUAL(l.index_at(30), 2);
+  EXPECT_EQUAL(l.index_at(59), 2);
+  // behind the last column is the last column.
+  EXPECT_EQUAL(l.index_at(1000), 2);
+
+  l.set_column_width(1, 5);
+  EXPECT_TRUE(left_positions(l) == positions({0, 10, 15, 45}));
+  EXPECT_EQUAL(l.index_at(14), 1);
+  EXPECT_EQUAL(l.index_at(15), 2);
+
+  l.set_default_width(7);
+  EXPECT_TRUE(left_positions(l) == positions({0, 7, 14, 21}));
+  EXPECT_EQUAL(l.index_at(13), 1);
+  EXPECT_EQUAL(l.index_at(14), 2);
+
+  l.set_column_count(4);
+  EXPECT_EQUAL(l.get_column_left_pos(4), 21);
+  l.set_column_width(3, 9);
+  EXPECT_EQUAL(l.get_column_left_pos(4), 30);
+  EXPECT_EQUAL(l.index_at(29), 3);
+
+  l.set_column_count(0);
+  EXPECT_EQUAL(l.index_at(0), -1);
+  EXPECT_EQUAL(l.get_column_left_pos(2), 0);
+}
+
+// --------------------------------------------------------------------------
+void test_simple_layout () {
+  simple_column_list_layout l(nullptr);
+  l.set_columns({{10, text_origin_t::vcenter_left, 5},
+                 {20, text_origin_t::vcenter_left, 5},
+                 {30, text_origin_t::vcenter_left, 5}}, false);
+  EXPECT_TRUE(left_positions(l) == positions({0, 10, 30, 60}));
+  EXPECT_EQUAL(l.index_at(30), 2);
+
+  // the min width limits the new width.
+  l.set_column_width(0, 2, false);
+  EXPECT_TRUE(left_positions(l) == positions({0, 5, 25, 55}));
+  EXPECT_EQUAL(l.index_at(4), 0);
+  EXPECT_EQUAL(l.index_at(5), 1);
+
+  l.set_column_min_width(1, 40);
+  EXPECT_TRUE(left_positions(l) == positions({0, 5, 45, 75}));
+  EXPECT_EQUAL(l.index_at(44), 1);
+
+  // the same count with other widths.
+  l.set_columns({{1}, {2}, {3}}, false);
+  EXPECT_TRUE(left_positions(l) == positions({0, 1, 3, 6}));
+  EXPECT_EQUAL(l.index_at(2), 1);
+
+  l.set_default_width(4);
+  EXPECT_TRUE(left_positions(l) == positions({0, 4, 8, 12}));
+}
+
+// --------------------------------------------------------------------------
+void test_weight_layout () {
+  win::window list;
+  list.geometry(core::rectangle(0, 0, 100, 10), false, false);
+
+  weight_column_list_layout l(nullptr);
+  l.set_list(&list);
+  l.set_columns({{10, text_origin_t::vcenter_left, 1, 1.0F},
+                 {20, text_origin_t::vcenter_left, 1, 1.0F},
+                 {30, text_origin_t::vcenter_left, 1, 2.0F}}, false);
+  EXPECT_TRUE(left_positions(l) == positions({0, 10, 30, 60}));
+
+  // the free space is shared by weight.
+  l.layout(core::rectangle(0, 0, 100, 10));
+  EXPECT_TRUE(left_positions(l) == positions({0, 20, 50, 100}));
+  EXPECT_EQUAL(l.index_at(19), 0);
+  EXPECT_EQUAL(l.index_at(20), 1);
+  EXPECT_EQUAL(l.index_at(99), 2);
+
+  // the columns on the right give up the space by weight.
+  l.set_column_width(0, 32, false);
+  EXPECT_TRUE(left_positions(l) == positions({0, 32, 58, 100}));
+  EXPECT_EQUAL(l.index_at(57), 1);
+  EXPECT_EQUAL(l.index_at(58), 2);
+
+  l.set_default_width(25);
+  EXPECT_TRUE(left_positions(l) == positions({0, 25, 50, 75}));
+  EXPECT_EQUAL(l.index_at(74), 2);
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::log_info("Running column_list_test");
+  run_test(test_base_layout);
+  run_test(test_simple_layout);
+  run_test(test_weight_layout);
+}
@@ -3,6 +3,8 @@
 #include "gui/draw/graphics.h"
 #include "testlib.h"
 
+#include <vector>
+
 
 // --------------------------------------------------------------------------
 void test_bw () {
@@ -196,6 +198,158 @@ void test_rgb2bgr () {
 
 }
 
+// --------------------------------------------------------------------------
+namespace {
+
+  using namespace gui;
+  typedef std::vector<core::byte> bytes;
+
+  bytes random_bytes (std::size_t n, uint32_t seed) {
+    bytes b(n);
+    for (auto& v : b) {
+      seed = seed * 1103515245 + 12345;
+      v = static_cast<core::byte>(seed >> 16);
+    }
+    return b;
+  }
+
+  // scalar reference, one pixel at a time
+  template<core::bit_order_t O>
+  bool get_ref (const bytes& b, uint32_t x) {
+    const auto shift = O == core::bit_order_t::lsb_first ? x % 8 : 7 - x % 8;
+    return (b[x / 8] >> shift) & 1;
+  }
+
+  template<core::bit_order_t O>
+  void set_ref (bytes& b, uint32_t x, bool v) {
+    const auto shift = O == core::bit_order_t::lsb_first ? x % 8 : 7 - x % 8;
+    b[x / 8] = v ? (b[x / 8] | (1 << shift)) : (b[x / 8] & ~(1 << shift));
+  }
+
+  template<core::bit_order_t O>
+  int test_bw_fill_invert () {
+    int errors = 0;
+    for (uint32_t x0 = 0; x0 < 18; ++x0) {
+      for (uint32_t w = 0; w < 141; ++w) {
+        for (int op = 0; op < 3; ++op) {
+          bytes expected = random_bytes(24, x0 * 1000 + w);
+          bytes actual = expected;
+          for (uint32_t x = x0; x < x0 + w; ++x) {
+            set_ref<O>(expected, x, op == 2 ? !get_ref<O>(expected, x) : op == 1);
+          }
+          if (op == 2) {
+            convert::bw::invert<O>(actual.data(), x0, w);
+          } else {
+            convert::bw::fill<O>(actual.data(), x0, w, op == 1);
+          }
+          errors += (expected != actual);
+        }
+      }
+    }
+    return errors;
+  }
+
+  template<core::bit_order_t O>
+  int test_bw_copy () {
+    int errors = 0;
+    for (uint32_t sx = 0; sx < 18; ++sx) {
+      for (uint32_t dx = 0; dx < 18; ++dx) {
+        for (uint32_t w = 0; w < 141; ++w) {
+          const bytes src = random_bytes(24, sx * 100 + w);
+          bytes expected = random_bytes(24, dx * 100 + w + 7);
+          bytes actual = expected;
+          for (uint32_t x = 0; x < w; ++x) {
+            set_ref<O>(expected, dx + x, get_ref<O>(src, sx + x));
+          }
+          convert::bw::copy<O>(src.data(), sx, actual.data(), dx, w);
+          errors += (expected != actual);
+        }
+      }
+    }
+    return errors;
+  }
+
+  template<core::bit_order_t O>
+  int test_bw_threshold_expand () {
+    int errors = 0;
+    const core::byte limits[] = {0, 1, 127, 128, 200, 255};
+    for (uint32_t w = 1; w < 80; ++w) {
+      const bytes gray = random_bytes(w, w);
+      for (auto limit : limits) {
+        for (int set_bit = 0; set_bit < 2; ++set_bit) {
+          bytes expected = random_bytes(11, w + limit);
+          bytes actual = expected;
+          for (uint32_t x = 0; x < w; ++x) {
+            set_ref<O>(expected, x, (limit < gray[x]) == (set_bit == 1));
+          }
+          convert::bw::threshold<O>(gray.data(), actual.data(), w, limit, set_bit == 1);
+          errors += (expected != actual);
+
+          const core::byte lut[2] = {0x10, 0xE0};
+          bytes out(w);
+          convert::bw::expand<core::byte, O>(actual.data(), out.data(), w, lut);
+          for (uint32_t x = 0; x < w; ++x) {
+            errors += (out[x] != lut[get_ref<O>(actual, x)]);
+          }
+        }
+      }
+    }
+    return errors;
+  }
+
+}
+
+// --------------------------------------------------------------------------
+void test_bw_kernels () {
+  // the reference matches the bit_wrapper in system order
+  bytes data = random_bytes(8, 42);
+  core::array_wrapper<pixel::mono> bits(data.data(), 64);
+  int errors = 0;
+  for (uint32_t x = 0; x < 64; ++x) {
+    errors += (static_cast<bool>(static_cast<pixel::mono>(bits[x])) != get_ref<core::os::bitmap_bit_order>(data, x));
+  }
+  EXPECT_EQUAL(errors, 0);
+
+  EXPECT_EQUAL(test_bw_fill_invert<core::bit_order_t::lsb_first>(), 0);
+  EXPECT_EQUAL(test_bw_fill_invert<core::bit_order_t::msb_first>(), 0);
+  EXPECT_EQUAL(test_bw_copy<core::bit_order_t::lsb_first>(), 0);
+  EXPECT_EQUAL(test_bw_copy<core::bit_order_t::msb_first>(), 0);
+  EXPECT_EQUAL(test_bw_threshold_expand<core::bit_order_t::lsb_first>(), 0);
+  EXPECT_EQUAL(test_bw_threshold_expand<core::bit_order_t::msb_first>(), 0);
+}
+
+// --------------------------------------------------------------------------
+void test_gray2bw2gray () {
+  using namespace gui;
+  using namespace gui::draw;
+
+  graymap img(37, 3);
+  auto raw = img.get_data();
+  for (uint32_t y = 0; y < 3; ++y) {
+    for (uint32_t x = 0; x < 37; ++x) {
+      raw.pixel(x, y) = pixel::gray{static_cast<core::byte>(x * 7 + y * 50)};
+    }
+  }
+
+  const bwmap bw = img.convert<pixel_format_t::BW>();
+  const bwmap mask = img.get_mask({100});
+  const graymap back = bw.convert<pixel_format_t::GRAY>();
+  int errors = 0;
+  for (uint32_t y = 0; y < 3; ++y) {
+    for (uint32_t x = 0; x < 37; ++x) {
+      const pixel::gray g = raw.pixel(x, y);
+      const pixel::mono m = bw.get_data().pixel(x, y);
+      errors += (m != pixel::get_bw(g));
+      errors += (static_cast<pixel::gray>(back.get_data().pixel(x, y)).value != pixel::get_gray(m));
+      // get_mask inverts the result on systems where the white bit is not set
+      const pixel::mono k = mask.get_data().pixel(x, y);
+      const bool inverted = !core::os::bitmap_bit_white;
+      errors += ((k == (g.value > 100 ? pixel::mono::white : pixel::mono::black)) == inverted);
+    }
+  }
+  EXPECT_EQUAL(errors, 0);
+}
+
 // --------------------------------------------------------------------------
 void test_main (const testing::start_params& params) {
   testing::init_gui(params);
@@ -209,6 +363,8 @@ void test_main (const testing::start_params& params) {
   run_test(test_gray2rgb);
   run_test(test_rgb2gray);
   run_test(test_rgb2bgr);
+  run_test(test_bw_kernels);
+  run_test(test_gray2bw2gray);
 }
 
 // --------------------------------------------------------------------------
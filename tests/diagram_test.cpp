@@ -322,6 +322,28 @@ void test_symlog_scaler_3 () {
   EXPECT_EQUAL(sc(-1), -2);
 }
 
+// --------------------------------------------------------------------------
+void test_decimate_columns () {
+  core::global::set_scale_factor(1.0);
+
+  std::vector<core::point> pts = {
+    {0.0F, 5.0F}, {0.2F, 9.0F}, {0.4F, 1.0F}, {0.6F, 4.0F}, {0.8F, 3.0F},
+    {1.0F, 2.0F},
+    {2.0F, 7.0F}, {2.5F, 8.0F}
+  };
+  detail::decimate_columns(pts);
+
+  const std::vector<core::point> expected = {
+    {0.0F, 5.0F}, {0.2F, 9.0F}, {0.4F, 1.0F}, {0.8F, 3.0F},
+    {1.0F, 2.0F},
+    {2.0F, 7.0F}, {2.5F, 8.0F}
+  };
+  EXPECT_EQUAL(pts.size(), expected.size());
+  for (std::size_t i = 0; i < std::min(pts.size(), expected.size()); ++i) {
+    EXPECT_EQUAL(pts[i], expected[i], " at index ", i);
+  }
+}
+
 // --------------------------------------------------------------------------
 void test_main (const testing::start_params& params) {
   testing::init_gui(params);
@@ -349,6 +371,7 @@ void test_main (const testing::start_params& params) {
   run_test(test_symlog_scaler_1);
   run_test(test_symlog_scaler_2);
   run_test(test_symlog_scaler_3);
+  run_test(test_decimate_columns);
 }
 
 // --------------------------------------------------------------------------
@@ -7,6 +7,7 @@
 #include "gui/draw/brush.h"
 #include "gui/draw/pen.h"
 #include "gui/draw/use.h"
+#include "gui/draw/tessellation.h"
 #include "image_test_lib.h"
 #include "testlib.h"
 
@@ -3665,6 +3666,102 @@ void listX11Fonts () {
   XFreeFontNames(names);
 }
 #endif
+// --------------------------------------------------------------------------
+struct tess_point {
+  float x, y;
+};
+
+typedef tessellation::mesh<tess_point> tess_mesh;
+
+float mesh_area (const tess_mesh& m) {
+  float area = 0;
+  for (std::size_t i = 0; i < m.indices.size(); i += 3) {
+    const auto& a = m.points[m.indices[i]];
+    const auto& b = m.points[m.indices[i + 1]];
+    const auto& c = m.points[m.indices[i + 2]];
+    area += std::abs((b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x)) / 2.0F;
+  }
+  return area;
+}
+
+void test_triangulate_convex () {
+  const tess_point pts[] = {{0, 0}, {10, 0}, {10, 10}, {0, 10}, {0, 0}};
+  tess_mesh m;
+  tessellation::triangulate(pts, 5, m);
+  EXPECT_EQUAL(m.indices.size(), 6U);
+  EXPECT_EQUAL(mesh_area(m), 100.0F);
+}
+
+void test_triangulate_concave () {
+  // L shape, in both orientations.
+  const tess_point pts[] = {{0, 0}, {10, 0}, {10, 2}, {2, 2}, {2, 10}, {0, 10}};
+  tess_mesh m;
+  tessellation::triangulate(pts, 6, m);
+  EXPECT_EQUAL(m.indices.size(), 12U);
+  EXPECT_EQUAL(mesh_area(m), 36.0F);
+
+  const tess_point rev[] = {{0, 10}, {2, 10}, {2, 2}, {10, 2}, {10, 0}, {0, 0}};
+  m.clear();
+  tessellation::triangulate(rev, 6, m);
+  EXPECT_EQUAL(m.indices.size(), 12U);
+  EXPECT_EQUAL(mesh_area(m), 36.0F);
+}
+
+void test_triangulate_degenerated () {
+  const tess_point line[] = {{0, 0}, {5, 0}, {10, 0}};
+  tess_mesh m;
+  tessellation::triangulate(line, 3, m);
+  EXPECT_TRUE(m.empty());
+
+  const tess_point pts[] = {{0, 0}, {5, 0}, {10, 0}, {10, 10}, {0, 10}};
+  tessellation::triangulate(pts, 5, m);
+  EXPECT_EQUAL(mesh_area(m), 100.0F);
+}
+
+void test_convex_detection () {
+  const tess_point square[] = {{0, 0}, {10, 0}, {10, 10}, {0, 10}, {0, 0}};
+  EXPECT_TRUE(tessellation::is_convex(square, 5));
+  const tess_point rev[] = {{0, 10}, {10, 10}, {10, 0}, {0, 0}};
+  EXPECT_TRUE(tessellation::is_convex(rev, 4));
+  // collinear points do not break convexity.
+  const tess_point straight[] = {{0, 0}, {5, 0}, {10, 0}, {10, 10}, {0, 10}};
+  EXPECT_TRUE(tessellation::is_convex(straight, 5));
+
+  const tess_point l_shape[] = {{0, 0}, {10, 0}, {10, 2}, {2, 2}, {2, 10}, {0, 10}};
+  EXPECT_TRUE(!tessellation::is_convex(l_shape, 6));
+  // a pentagram turns the same way at every point, but winds twice.
+  const tess_point star[] = {{50, 0}, {79, 90}, {2, 35}, {98, 35}, {21, 90}};
+  EXPECT_TRUE(!tessellation::is_convex(star, 5));
+  // a bow tie crosses itself.
+  const tess_point bow_tie[] = {{0, 0}, {10, 10}, {10, 0}, {0, 10}};
+  EXPECT_TRUE(!tessellation::is_convex(bow_tie, 4));
+  // a spike back along an edge.
+  const tess_point spike[] = {{0, 0}, {10, 0}, {5, 0}, {5, 10}};
+  EXPECT_TRUE(!tessellation::is_convex(spike, 4));
+
+  const tess_point line[] = {{0, 0}, {5, 0}, {10, 0}};
+  EXPECT_TRUE(!tessellation::is_convex(line, 3));
+  EXPECT_TRUE(!tessellation::is_convex(square, 2));
+}
+
+void test_stroke () {
+  const tess_point line[] = {{0, 0}, {100, 0}};
+  tess_mesh m;
+  tessellation::stroke(line, 2, 4, false, m);
+  // body plus two pointed caps.
+  EXPECT_EQUAL(mesh_area(m), 408.0F);
+
+  const tess_point box[] = {{0, 0}, {100, 0}, {100, 100}, {0, 100}};
+  m.clear();
+  tessellation::stroke(box, 4, 4, true, m);
+  // four segments, four mitered corners.
+  EXPECT_EQUAL(mesh_area(m), 1616.0F);
+
+  m.clear();
+  tessellation::stroke(box, 4, 0, true, m);
+  EXPECT_TRUE(m.empty());
+}
+
 // --------------------------------------------------------------------------
 #define TEST_CLEAR
 #define TEST_RAW
@@ -3677,6 +3774,7 @@ void listX11Fonts () {
 #define TEST_ROUND_RECT
 #define TEST_POLYGON
 #define TEST_RAW_RECTx
+#define TEST_TESSELLATION
 
 // --------------------------------------------------------------------------
 void test_main (const testing::start_params& params) {
@@ -3896,6 +3994,14 @@ void test_main (const testing::start_params& params) {
   run_test(test_draw_polygon);
 #endif //TEST_POLYGON
 
+#ifdef TEST_TESSELLATION
+  run_test(test_triangulate_convex);
+  run_test(test_triangulate_concave);
+  run_test(test_triangulate_degenerated);
+  run_test(test_convex_detection);
+  run_test(test_stroke);
+#endif //TEST_TESSELLATION
+
 #ifdef TEST_RAW_RECT
   for (int scale = 1; scale < 4; ++scale) {
     for (int w = 0; w < 5; ++w) {
@@ -0,0 +1,103 @@
+
+#include <fstream>
+
+#include "gui/ctrl/file_tree.h"
+#include "testlib.h"
+
+
+using namespace gui;
+
+namespace {
+
+  sys_fs::path make_test_dir (const std::string& name) {
+    const auto dir = sys_fs::temp_directory_path() / name;
+    sys_fs::remove_all(dir);
+    sys_fs::create_directories(dir);
+    std::ofstream(dir / "a.txt") << "a";
+    return dir;
+  }
+
+  fs::file_info_cache::list_ptr make_list (const sys_fs::path& dir) {
+    auto list = std::make_shared<fs::file_info_cache::list_type>();
+    for (sys_fs::directory_iterator i(dir), end; i != end; ++i) {
+      list->emplace_back(*i);
+    }
+    return list;
+  }
+
+}
+
+// --------------------------------------------------------------------------
+void test_cache_lookup () {
+  auto& cache = fs::file_info_cache::get();
+  cache.clear();
+  const auto dir = make_test_dir("guipp_cache_lookup");
+
+  EXPECT_TRUE(!cache.lookup(dir));
+  cache.store(dir, sys_fs::last_write_time(dir), make_list(dir));
+  auto list = cache.lookup(dir);
+  EXPECT_TRUE(list != nullptr);
+  EXPECT_EQUAL(list->size(), 1);
+
+  cache.invalidate(dir);
+  EXPECT_TRUE(!cache.lookup(dir));
+
+  sys_fs::remove_all(dir);
+}
+
+// --------------------------------------------------------------------------
+void test_cache_changed_dir () {
+  auto& cache = fs::file_info_cache::get();
+  cache.clear();
+  const auto dir = make_test_dir("guipp_cache_changed");
+  const auto dir_time = sys_fs::last_write_time(dir);
+
+  cache.store(dir, dir_time, make_list(dir));
+  EXPECT_TRUE(cache.lookup(dir) != nullptr);
+
+  // a new entry changes the directory time, the file system time resolution may be coarse.
+  std::ofstream(dir / "b.txt") << "b";
+  sys_fs::last_write_time(dir, dir_time + std::chrono::seconds(2));
+  EXPECT_TRUE(!cache.lookup(dir));
+
+  // a removed directory is never served from the cache.
+  cache.store(dir, sys_fs::last_write_time(dir), make_list(dir));
+  sys_fs::remove_all(dir);
+  EXPECT_TRUE(!cache.lookup(dir));
+}
+
+// --------------------------------------------------------------------------
+void test_cache_lru_bound () {
+  auto& cache = fs::file_info_cache::get();
+  cache.clear();
+  const auto max = cache.get_max_directories();
+  cache.set_max_directories(2);
+
+  const auto d1 = make_test_dir("guipp_cache_lru1");
+  const auto d2 = make_test_dir("guipp_cache_lru2");
+  const auto d3 = make_test_dir("guipp_cache_lru3");
+
+  cache.store(d1, sys_fs::last_write_time(d1), make_list(d1));
+  cache.store(d2, sys_fs::last_write_time(d2), make_list(d2));
+  // d1 is used again, d2 is the least recently used entry now.
+  EXPECT_TRUE(cache.lookup(d1) != nullptr);
+  cache.store(d3, sys_fs::last_write_time(d3), make_list(d3));
+
+  EXPECT_TRUE(cache.lookup(d1) != nullptr);
+  EXPECT_TRUE(!cache.lookup(d2));
+  EXPECT_TRUE(cache.lookup(d3) != nullptr);
+
+  cache.set_max_directories(max);
+  cache.clear();
+  sys_fs::remove_all(d1);
+  sys_fs::remove_all(d2);
+  sys_fs::remove_all(d3);
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::log_info("Running file_info_cache_test");
+  run_test(test_cache_lookup);
+  run_test(test_cache_changed_dir);
+  run_test(test_cache_lru_bound);
+}
@@ -0,0 +1,93 @@
+
+#include <fstream>
+#include <set>
+
+#include "gui/ctrl/file_tree.h"
+#include "testlib.h"
+
+
+using namespace gui;
+using namespace gui::ctrl;
+
+namespace {
+
+  sys_fs::path make_test_dir () {
+    const auto dir = sys_fs::temp_directory_path() / "guipp_file_list_merge";
+    sys_fs::remove_all(dir);
+    sys_fs::create_directories(dir);
+    // names, sizes and directories in different orders.
+    for (int i = 0; i < 60; ++i) {
+      const auto name = std::to_string((i * 37) % 60);
+      if (i % 7 == 0) {
+        sys_fs::create_directory(dir / ("d" + name));
+      } else {
+        std::ofstream(dir / ("f" + name)) << std::string(static_cast<std::size_t>((i * 13) % 17), 'x');
+      }
+    }
+    return dir;
+  }
+
+  std::vector<fs::file_info> read_dir (const sys_fs::path& dir) {
+    std::vector<fs::file_info> list;
+    for (sys_fs::directory_iterator i(dir), end; i != end; ++i) {
+      list.emplace_back(*i);
+    }
+    return list;
+  }
+
+  bool is_sorted_by (const std::vector<fs::file_info>& list, sort_order order) {
+    // a stable sort keeps a sorted list unchanged.
+    auto sorted = list;
+    sort_list_by(sorted, order);
+    for (std::size_t i = 0; i < list.size(); ++i) {
+      if (list[i].path != sorted[i].path) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+}
+
+// --------------------------------------------------------------------------
+void test_merge_batches () {
+  const auto dir = make_test_dir();
+  const auto entries = read_dir(dir);
+  EXPECT_EQUAL(entries.size(), 60);
+
+  for (auto order : {sort_order::name_up, sort_order::name_down,
+                     sort_order::size_up, sort_order::size_down,
+                     sort_order::date_up, sort_order::date_down}) {
+    std::vector<fs::file_info> shown;
+    for (std::size_t first = 0; first < entries.size(); first += 11) {
+      const auto last = std::min(first + 11, entries.size());
+      const auto sorted = shown.size();
+      shown.insert(shown.end(), entries.begin() + first, entries.begin() + last);
+      merge_list_by(shown, sorted, order);
+      EXPECT_EQUAL(shown.size(), last);
+      EXPECT_TRUE(is_sorted_by(shown, order), "order ", static_cast<int>(order), " not sorted after ", last, " entries");
+    }
+    std::set<sys_fs::path> paths;
+    for (const auto& f : shown) {
+      paths.insert(f.path);
+    }
+    EXPECT_EQUAL(paths.size(), entries.size());
+  }
+
+  // the name order puts the directories first.
+  std::vector<fs::file_info> shown;
+  merge_list_by(shown, 0, sort_order::name_up);
+  EXPECT_TRUE(shown.empty());
+  shown = entries;
+  merge_list_by(shown, 0, sort_order::name_up);
+  EXPECT_TRUE(shown.front().is_directory());
+  EXPECT_TRUE(!shown.back().is_directory());
+
+  sys_fs::remove_all(dir);
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::log_info("Running file_list_merge_test");
+  run_test(test_merge_batches);
+}
@@ -8,8 +8,10 @@
 #include "gui/draw/font.h"
 #include "gui/draw/bitmap.h"
 #include "gui/draw/icons.h"
+#include "gui/draw/icon_cache.h"
 #include "gui/io/pnm.h"
 #include "gui/ctrl/tree.h"
+#include "gui/ctrl/look/image_cache.h"
 #include "testlib.h"
 #include "image_test_lib.h"
 
@@ -624,6 +626,88 @@ void test_file_icon_selected () {
   }
 }
 
+// --------------------------------------------------------------------------
+void test_cached_file_icon () {
+  core::global::set_scale_factor(1.0);
+
+  auto& cache = draw::icon_cache::get();
+  cache.clear();
+  cache.reset_statistics();
+
+  for (int i = 0; i < 2; ++i) {
+    draw::pixmap mem(20, 20);
+    draw::graphics g(mem);
+    g.clear(L);
+    g.frame(draw::cached_icon_t<draw::icon_type::file>({7, 9}, 7), color::black);
+
+    auto generated = pixmap2colormap(mem);
+    EXPECT_EQUAL(generated, expected_file_icon_map, " in pass ", i);
+  }
+
+  const auto stats = cache.get_statistics();
+  EXPECT_EQUAL(stats.misses, 1);
+  EXPECT_EQUAL(stats.hits, 1);
+  EXPECT_EQUAL(stats.entries, 1);
+}
+
+// --------------------------------------------------------------------------
+void test_icon_cache_limit () {
+  core::global::set_scale_factor(1.0);
+
+  auto& cache = draw::icon_cache::get();
+  cache.clear();
+  cache.reset_statistics();
+  const auto max_bytes = cache.get_max_bytes();
+  cache.set_max_bytes(1);
+
+  cache.prewarm({draw::icon_type::file, draw::icon_type::folder, draw::icon_type::add}, color::black, 7);
+
+  const auto stats = cache.get_statistics();
+  EXPECT_EQUAL(stats.misses, 3);
+  EXPECT_EQUAL(stats.evictions, 2);
+  EXPECT_EQUAL(stats.entries, 1);
+
+  cache.set_max_bytes(max_bytes);
+  cache.clear();
+}
+
+// --------------------------------------------------------------------------
+void test_shelf_packer () {
+  draw::shelf_packer packer({64, 32});
+  core::native_point pt;
+  EXPECT_TRUE(packer.insert({30, 10}, pt));
+  EXPECT_EQUAL(pt, core::native_point(0, 0));
+  EXPECT_TRUE(packer.insert({30, 20}, pt));
+  EXPECT_EQUAL(pt, core::native_point(0, 10));
+  EXPECT_TRUE(packer.insert({30, 8}, pt));
+  EXPECT_EQUAL(pt, core::native_point(30, 0));
+  EXPECT_TRUE(!packer.insert({40, 10}, pt));
+  EXPECT_EQUAL(packer.used_pixels(), 1140);
+}
+
+// --------------------------------------------------------------------------
+void test_look_image_cache () {
+  typedef look::image_cache::resource resource;
+  auto& cache = look::image_cache::get();
+
+  core::global::set_scale_factor(2.0);
+  cache.wait();
+  EXPECT_EQUAL(cache.get_scale(), 2.0);
+  EXPECT_EQUAL(cache.size(), 29);
+  EXPECT_EQUAL(cache.get_image(resource::osx_checkbox, look::image_cache::checked).native_size(), core::native_size(28, 28));
+  EXPECT_EQUAL(cache.get_image(resource::metal_radio).native_size(), core::native_size(32, 32));
+
+  core::global::set_scale_factor(1.0);
+  EXPECT_EQUAL(cache.get_image(resource::metal_radio).native_size(), core::native_size(16, 16));
+  EXPECT_EQUAL(cache.get_image(resource::button_frame).native_size(), core::native_size(9, 28));
+  const auto region = cache.get_region(resource::osx_radio, look::image_cache::check_state(true, true));
+  EXPECT_TRUE(region.is_valid());
+  EXPECT_EQUAL(region.native_size(), core::native_size(16, 16));
+  cache.wait();
+  EXPECT_EQUAL(cache.size(), 29);
+  EXPECT_EQUAL(cache.atlas_pages(), 1);
+}
+
 // --------------------------------------------------------------------------
 void test_main (const testing::start_params& params) {
   testing::init_gui(params);
@@ -640,6 +724,10 @@ void test_main (const testing::start_params& params) {
   run_test(test_masked_bitmap);
   run_test(test_file_icon);
   run_test(test_file_icon_selected);
+  run_test(test_cached_file_icon);
+  run_test(test_icon_cache_limit);
+  run_test(test_shelf_packer);
+  run_test(test_look_image_cache);
   run_test(test_pixmap2colormap);
   run_test(test_text_pixmap);
 }
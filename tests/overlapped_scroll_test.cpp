@@ -0,0 +1,71 @@
+
+#include "gui/win/overlapped_window.h"
+#include "testlib.h"
+
+
+using namespace gui;
+using namespace gui::core;
+
+namespace {
+
+  const native_rect area(10, 20, 100, 50);
+
+  bool strip (const native_point& delta, const native_rect& invalid,
+              native_rect& src, native_rect& exposed) {
+    return win::detail::scroll_strip(area, delta, invalid, src, exposed);
+  }
+
+}
+
+// --------------------------------------------------------------------------
+void test_vertical_strip () {
+  native_rect src, exposed;
+  // content moves down, the top rows get exposed.
+  EXPECT_TRUE(strip({0, 10}, native_rect::zero, src, exposed));
+  EXPECT_EQUAL(src, native_rect(10, 20, 100, 40));
+  EXPECT_EQUAL(exposed, native_rect(10, 20, 100, 10));
+
+  // content moves up, the bottom rows get exposed.
+  EXPECT_TRUE(strip({0, -10}, native_rect::zero, src, exposed));
+  EXPECT_EQUAL(src, native_rect(10, 30, 100, 40));
+  EXPECT_EQUAL(exposed, native_rect(10, 60, 100, 10));
+}
+
+// --------------------------------------------------------------------------
+void test_horizontal_strip () {
+  native_rect src, exposed;
+  EXPECT_TRUE(strip({20, 0}, native_rect::zero, src, exposed));
+  EXPECT_EQUAL(src, native_rect(10, 20, 80, 50));
+  EXPECT_EQUAL(exposed, native_rect(10, 20, 20, 50));
+
+  EXPECT_TRUE(strip({-20, 0}, native_rect::zero, src, exposed));
+  EXPECT_EQUAL(src, native_rect(30, 20, 80, 50));
+  EXPECT_EQUAL(exposed, native_rect(90, 20, 20, 50));
+}
+
+// --------------------------------------------------------------------------
+void test_strip_fallbacks () {
+  native_rect src, exposed;
+  // both axes move: the exposed part is no strip.
+  EXPECT_TRUE(!strip({5, 5}, native_rect::zero, src, exposed));
+
+  // nothing stays visible.
+  EXPECT_TRUE(!strip({0, 50}, native_rect::zero, src, exposed));
+  EXPECT_TRUE(!strip({-120, 0}, native_rect::zero, src, exposed));
+
+  // a pending repaint inside the area: the backstore is not up to date.
+  EXPECT_TRUE(!strip({0, 10}, native_rect(50, 40, 10, 10), src, exposed));
+  EXPECT_TRUE(!strip({0, 10}, native_rect(0, 0, 200, 200), src, exposed));
+
+  // a pending repaint outside the area does not matter.
+  EXPECT_TRUE(strip({0, 10}, native_rect(200, 0, 10, 10), src, exposed));
+  EXPECT_EQUAL(exposed, native_rect(10, 20, 100, 10));
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::log_info("Running overlapped_scroll_test");
+  run_test(test_vertical_strip);
+  run_test(test_horizontal_strip);
+  run_test(test_strip_fallbacks);
+}
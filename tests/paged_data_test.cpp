@@ -0,0 +1,155 @@
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include "gui/ctrl/paged_data.h"
+#include "testlib.h"
+
+
+using namespace gui;
+
+namespace {
+
+  typedef ctrl::paged_data_source<int> source_t;
+
+  void sleep_ms (int ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  }
+
+  struct loop_state {
+    volatile bool running = true;
+    std::atomic_bool finished{false};
+  };
+
+  // runs the main loop until done returns true or two seconds passed.
+  bool run_until (const std::function<bool()>& done) {
+    auto s = std::make_shared<loop_state>();
+    const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    std::thread ticker([s, &done, end] () {
+      while (!s->finished) {
+        // actions left in the queue do nothing after finished.
+        win::run_on_main([s, &done, end] () {
+          if (!s->finished && (done() || (std::chrono::steady_clock::now() > end))) {
+            s->finished = true;
+            s->running = false;
+          }
+        });
+        sleep_ms(5);
+      }
+    });
+    win::run_loop(s->running);
+    ticker.join();
+    return done();
+  }
+
+  std::vector<int> fetch_rows (std::size_t first, std::size_t n) {
+    std::vector<int> rows(n);
+    for (std::size_t i = 0; i < n; ++i) {
+      rows[i] = static_cast<int>(first + i);
+    }
+    return rows;
+  }
+
+  bool load (const source_t& src, std::size_t row) {
+    return run_until([&] () {
+      return src.get(row) != nullptr;
+    });
+  }
+
+}
+
+// --------------------------------------------------------------------------
+void test_load_pages () {
+  source_t src(fetch_rows, 10, 4);
+  src.set_size(100);
+  EXPECT_TRUE(src.get(0) == nullptr);
+  EXPECT_TRUE(src.get(100) == nullptr);
+  EXPECT_TRUE(load(src, 0));
+  EXPECT_EQUAL(*src.get(0), 0);
+  EXPECT_EQUAL(*src.get(9), 9);
+
+  for (std::size_t row = 0; row < 100; row += 10) {
+    EXPECT_TRUE(load(src, row), "page ", row / 10, " not loaded");
+    EXPECT_EQUAL(*src.get(row), static_cast<int>(row));
+  }
+  EXPECT_TRUE(src.loaded_pages() <= 4, src.loaded_pages(), " pages loaded");
+}
+
+// --------------------------------------------------------------------------
+void test_grow_keeps_pages () {
+  std::atomic<int> fetches(0);
+  source_t src([&] (std::size_t first, std::size_t n) {
+    ++fetches;
+    return fetch_rows(first, n);
+  }, 10, 8);
+  src.set_size(25);
+  EXPECT_TRUE(load(src, 0));
+  EXPECT_TRUE(load(src, 20));
+  EXPECT_TRUE(src.get(25) == nullptr);
+
+  src.set_size(35);
+  // pages before the old last page stay, the last page is fetched again.
+  EXPECT_TRUE(src.get(0) != nullptr);
+  EXPECT_TRUE(src.get(9) != nullptr);
+  EXPECT_TRUE(src.get(20) == nullptr);
+  EXPECT_TRUE(load(src, 29));
+  EXPECT_EQUAL(*src.get(29), 29);
+  EXPECT_TRUE(load(src, 34));
+  EXPECT_EQUAL(*src.get(34), 34);
+
+  src.set_size(35);
+  EXPECT_TRUE(src.get(0) != nullptr);
+
+  src.set_size(30);
+  EXPECT_EQUAL(src.loaded_pages(), 0U);
+  EXPECT_TRUE(src.get(34) == nullptr);
+  EXPECT_TRUE(load(src, 29));
+  testing::log_info("grow and shrink: ", fetches.load(), " fetches");
+}
+
+// --------------------------------------------------------------------------
+void test_fetch_error () {
+  std::atomic<int> fetches(0);
+  source_t src([&] (std::size_t first, std::size_t n) {
+    if (++fetches == 1) {
+      throw std::runtime_error("store not ready");
+    }
+    return fetch_rows(first, n);
+  }, 10, 4);
+  src.set_size(10);
+  EXPECT_TRUE(src.get(5) == nullptr);
+  // the failed page must not stay pending, the next get requests it again.
+  EXPECT_TRUE(load(src, 5));
+  EXPECT_EQUAL(*src.get(5), 5);
+  EXPECT_TRUE(fetches >= 2, "only ", fetches.load(), " fetches");
+}
+
+// --------------------------------------------------------------------------
+void test_worker_survives_exception () {
+  std::atomic<int> count(0);
+  {
+    ctrl::worker_pool pool(1);
+    pool.push([] () {
+      throw std::runtime_error("failing job");
+    });
+    pool.push([&] () {
+      ++count;
+    }, true);
+    for (int i = 0; (i < 200) && (count == 0); ++i) {
+      sleep_ms(5);
+    }
+  }
+  EXPECT_EQUAL(count, 1);
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::log_info("Running paged_data_test");
+  run_test(test_load_pages);
+  run_test(test_grow_keeps_pages);
+  run_test(test_fetch_error);
+  run_test(test_worker_survives_exception);
+}
@@ -0,0 +1,95 @@
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gui/core/pending_update.h"
+#include "testlib.h"
+
+
+using namespace gui;
+
+// --------------------------------------------------------------------------
+void test_coalesce () {
+  core::pending_update u;
+  int calls = 0;
+  EXPECT_TRUE(u.request());
+  EXPECT_TRUE(!u.request());
+  EXPECT_TRUE(u.is_pending());
+
+  auto action = u.bind([&] () {
+    ++calls;
+  });
+  action();
+  EXPECT_EQUAL(calls, 1);
+  EXPECT_TRUE(!u.is_pending());
+  EXPECT_TRUE(u.request());
+}
+
+// --------------------------------------------------------------------------
+void test_cancel () {
+  core::pending_update u;
+  EXPECT_TRUE(u.request());
+  // e.g. no window to post to yet.
+  u.cancel();
+  EXPECT_TRUE(!u.is_pending());
+  EXPECT_TRUE(u.request());
+}
+
+// --------------------------------------------------------------------------
+void test_request_in_action () {
+  core::pending_update u;
+  bool next = false;
+  EXPECT_TRUE(u.request());
+  u.bind([&] () {
+    next = u.request();
+  })();
+  EXPECT_TRUE(next);
+}
+
+// --------------------------------------------------------------------------
+void test_destroyed_owner () {
+  int calls = 0;
+  core::pending_update::action_t action;
+  {
+    auto u = std::make_unique<core::pending_update>();
+    u->request();
+    action = u->bind([&] () {
+      ++calls;
+    });
+  }
+  action();
+  EXPECT_EQUAL(calls, 0);
+}
+
+// --------------------------------------------------------------------------
+void test_many_producers () {
+  core::pending_update u;
+  std::atomic<int> posted(0);
+  std::vector<std::thread> producers;
+  for (int t = 0; t < 4; ++t) {
+    producers.emplace_back([&] () {
+      for (int i = 0; i < 10000; ++i) {
+        if (u.request()) {
+          ++posted;
+        }
+      }
+    });
+  }
+  for (auto& t : producers) {
+    t.join();
+  }
+  // nothing consumed the request, so only one post.
+  EXPECT_EQUAL(posted, 1);
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::log_info("Running pending_update_test");
+  run_test(test_coalesce);
+  run_test(test_cancel);
+  run_test(test_request_in_action);
+  run_test(test_destroyed_owner);
+  run_test(test_many_producers);
+}
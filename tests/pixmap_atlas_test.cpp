@@ -0,0 +1,129 @@
+
+#include "gui/draw/pixmap_atlas.h"
+#include "gui/draw/graphics.h"
+#include "image_test_lib.h"
+#include "testlib.h"
+
+
+using namespace gui;
+using namespace gui::draw;
+using namespace testing;
+
+namespace {
+
+  rgbmap make_image (uint32_t w, uint32_t h, os::color c) {
+    rgbmap img(w, h);
+    img.fill(pixel::rgb::build(c));
+    return img;
+  }
+
+  bwmap make_mask (uint32_t w, uint32_t h) {
+    bwmap mask(w, h);
+    mask.fill(pixel::mono::white);
+    return mask;
+  }
+
+  bool is_color (const colormap& m, std::size_t x, std::size_t y, os::color c) {
+    return colorline{m[y][x]} == CM({{c}})[0];
+  }
+
+}
+
+// --------------------------------------------------------------------------
+void test_shelf_packer () {
+  shelf_packer packer({8, 8});
+  core::native_point pos;
+  EXPECT_TRUE(packer.insert({4, 3}, pos));
+  EXPECT_EQUAL(pos, core::native_point(0, 0));
+  EXPECT_TRUE(packer.insert({4, 3}, pos));
+  EXPECT_EQUAL(pos, core::native_point(4, 0));
+  // the first shelf is full, a new one opens below.
+  EXPECT_TRUE(packer.insert({2, 2}, pos));
+  EXPECT_EQUAL(pos, core::native_point(0, 3));
+  // the lower shelf has room and is closer in height.
+  EXPECT_TRUE(packer.insert({2, 2}, pos));
+  EXPECT_EQUAL(pos, core::native_point(2, 3));
+  EXPECT_EQUAL(packer.used_pixels(), 32);
+
+  EXPECT_TRUE(!packer.insert({9, 1}, pos));
+  EXPECT_TRUE(!packer.insert({1, 4}, pos));
+
+  packer.clear();
+  EXPECT_TRUE(packer.insert({8, 8}, pos));
+  EXPECT_EQUAL(pos, core::native_point(0, 0));
+}
+
+// --------------------------------------------------------------------------
+void test_add_regions () {
+  pixmap_atlas atlas(8);
+  const auto a = atlas.add(make_image(4, 3, color::red), make_mask(4, 3));
+  EXPECT_TRUE(a.is_valid());
+  EXPECT_EQUAL(a.page, 0);
+  EXPECT_EQUAL(a.rect, core::native_rect(0, 0, 4, 3));
+
+  const auto b = atlas.add(make_image(4, 3, color::green), make_mask(4, 3));
+  EXPECT_EQUAL(b.page, 0);
+  EXPECT_EQUAL(b.rect, core::native_rect(4, 0, 4, 3));
+
+  // larger than a page: a page of its own.
+  const auto c = atlas.add(make_image(10, 2, color::blue), make_mask(10, 2));
+  EXPECT_EQUAL(c.page, 1);
+  EXPECT_EQUAL(c.rect, core::native_rect(0, 0, 10, 2));
+  EXPECT_EQUAL(c.native_size(), core::native_size(10, 2));
+
+  const auto d = atlas.add(make_image(2, 2, color::white), make_mask(2, 2));
+  EXPECT_EQUAL(d.page, 0);
+  EXPECT_EQUAL(d.rect, core::native_rect(0, 3, 2, 2));
+  EXPECT_EQUAL(atlas.page_count(), 2);
+
+  EXPECT_TRUE(!atlas.add(rgbmap(), bwmap()).is_valid());
+
+  atlas.clear();
+  EXPECT_EQUAL(atlas.page_count(), 0);
+}
+
+// --------------------------------------------------------------------------
+void test_page_pixels () {
+  core::global::set_scale_factor(1.0);
+  pixmap_atlas atlas(8);
+  atlas.add(make_image(4, 3, color::red), make_mask(4, 3));
+
+  auto m = pixmap2colormap(atlas.get_page(0).image);
+  EXPECT_EQUAL(m.size(), 8);
+  EXPECT_TRUE(is_color(m, 0, 0, R));
+  EXPECT_TRUE(is_color(m, 3, 2, R));
+  EXPECT_TRUE(is_color(m, 4, 0, _));
+  EXPECT_TRUE(is_color(m, 0, 3, _));
+
+  // added after the first draw: only the new part is uploaded.
+  atlas.add(make_image(4, 3, color::green), make_mask(4, 3));
+  atlas.add(make_image(2, 2, color::blue), make_mask(2, 2));
+  m = pixmap2colormap(atlas.get_page(0).image);
+  EXPECT_TRUE(is_color(m, 0, 0, R));
+  EXPECT_TRUE(is_color(m, 4, 0, G));
+  EXPECT_TRUE(is_color(m, 7, 2, G));
+  EXPECT_TRUE(is_color(m, 1, 4, B));
+  EXPECT_TRUE(is_color(m, 2, 4, _));
+  EXPECT_TRUE(is_color(m, 7, 7, _));
+
+  // drawing a region copies it out of the page.
+  const auto r = atlas.add(make_image(2, 2, color::white), make_mask(2, 2));
+  pixmap img(4, 4);
+  graphics g(img);
+  g.clear(color::black);
+  g.copy_from(r, core::native_point(1, 1));
+  m = pixmap2colormap(img);
+  EXPECT_TRUE(is_color(m, 1, 1, W));
+  EXPECT_TRUE(is_color(m, 2, 2, W));
+  EXPECT_TRUE(is_color(m, 0, 0, _));
+  EXPECT_TRUE(is_color(m, 3, 3, _));
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::init_gui(params);
+  testing::log_info("Running pixmap_atlas_test");
+  run_test(test_shelf_packer);
+  run_test(test_add_regions);
+  run_test(test_page_pixels);
+}
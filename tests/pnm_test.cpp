@@ -0,0 +1,135 @@
+
+#include <chrono>
+#include <sstream>
+
+#include "gui/draw/datamap.h"
+#include "gui/io/pnm.h"
+#include "testlib.h"
+
+
+using namespace gui;
+
+// --------------------------------------------------------------------------
+draw::rgbmap make_rgb_image (uint32_t w, uint32_t h) {
+  draw::rgbmap img(core::native_size(w, h));
+  auto data = img.get_data();
+  for (uint32_t y = 0; y < h; ++y) {
+    auto row = data.row(y);
+    for (uint32_t x = 0; x < w; ++x) {
+      row[x] = pixel::rgb{static_cast<byte>(x * 7), static_cast<byte>(y * 13), static_cast<byte>(x ^ y)};
+    }
+  }
+  return img;
+}
+
+void expect_equal_rgb (const draw::rgbmap& lhs, const draw::rgbmap& rhs) {
+  EXPECT_EQUAL(lhs.native_size(), rhs.native_size());
+  const auto l = lhs.get_data();
+  const auto r = rhs.get_data();
+  for (uint32_t y = 0; y < lhs.native_size().height(); ++y) {
+    for (uint32_t x = 0; x < lhs.native_size().width(); ++x) {
+      const pixel::rgb a = l.row(y)[x];
+      const pixel::rgb b = r.row(y)[x];
+      EXPECT_EQUAL(a.red, b.red, " at x:", x, ", y:", y);
+      EXPECT_EQUAL(a.green, b.green, " at x:", x, ", y:", y);
+      EXPECT_EQUAL(a.blue, b.blue, " at x:", x, ", y:", y);
+    }
+  }
+}
+
+// --------------------------------------------------------------------------
+void test_pnm_rgb_roundtrip () {
+  // 5 pixel rows are padded, 4 pixel rows are read in one block.
+  for (uint32_t w : {4, 5}) {
+    const auto img = make_rgb_image(w, 3);
+    for (bool binary : {true, false}) {
+      std::ostringstream out;
+      io::save_pnm(out, img, binary);
+      std::istringstream in(out.str());
+      draw::rgbmap result;
+      io::load_pnm(in, result);
+      expect_equal_rgb(result, img);
+    }
+  }
+}
+
+// --------------------------------------------------------------------------
+void test_pnm_gray_ascii () {
+  std::istringstream in("P2\n# comment\n3 2\n255\n1 #inline\n 22\n255\n\n0 7   128\n");
+  draw::graymap img;
+  io::load_pnm(in, img);
+  const auto data = img.get_data();
+  EXPECT_EQUAL(data.row(0)[0].value, 1);
+  EXPECT_EQUAL(data.row(0)[1].value, 22);
+  EXPECT_EQUAL(data.row(0)[2].value, 255);
+  EXPECT_EQUAL(data.row(1)[0].value, 0);
+  EXPECT_EQUAL(data.row(1)[1].value, 7);
+  EXPECT_EQUAL(data.row(1)[2].value, 128);
+}
+
+// --------------------------------------------------------------------------
+void test_pnm_truncated () {
+  std::istringstream in("P5\n4 4\n255\n0123");
+  draw::graymap img;
+  bool thrown = false;
+  try {
+    io::load_pnm(in, img);
+  } catch (std::exception&) {
+    thrown = true;
+  }
+  EXPECT_TRUE(thrown);
+}
+
+// --------------------------------------------------------------------------
+void test_pnm_rows () {
+  const auto img = make_rgb_image(5, 4);
+  for (bool binary : {true, false}) {
+    std::ostringstream out;
+    io::save_pnm(out, img, binary);
+    std::istringstream in(out.str());
+
+    uint32_t rows = 0;
+    const auto bmi = io::read_pnm_rows(in, [&] (uint32_t y, const byte* row) {
+      EXPECT_EQUAL(y, rows);
+      const auto* px = reinterpret_cast<const pixel::rgb*>(row);
+      EXPECT_EQUAL(px[3].red, 21);
+      EXPECT_EQUAL(px[3].green, static_cast<byte>(y * 13));
+      ++rows;
+    });
+    EXPECT_EQUAL(rows, 4U);
+    EXPECT_EQUAL(bmi.width, 5U);
+    EXPECT_EQUAL(bmi.pixel_format, pixel_format_t::RGB);
+  }
+}
+
+// --------------------------------------------------------------------------
+void test_pnm_throughput () {
+  const auto img = make_rgb_image(2000, 2000);
+  for (bool binary : {true, false}) {
+    std::ostringstream out;
+    io::save_pnm(out, img, binary);
+    const auto str = out.str();
+
+    const auto start = std::chrono::steady_clock::now();
+    std::istringstream in(str);
+    draw::rgbmap result;
+    io::load_pnm(in, result);
+    const auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+    testing::log_info("read ", (binary ? "P6" : "P3"), " 4 MPixel: ", ms, " ms, ",
+                      (ms ? str.size() / 1000 / ms : 0), " MB/s");
+  }
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::init_gui(params);
+  testing::log_info("Running pnm_test");
+  run_test(test_pnm_rgb_roundtrip);
+  run_test(test_pnm_gray_ascii);
+  run_test(test_pnm_truncated);
+  run_test(test_pnm_rows);
+  run_test(test_pnm_throughput);
+}
+
+// --------------------------------------------------------------------------
@@ -0,0 +1,101 @@
+
+#include <chrono>
+#include <thread>
+
+#include "gui/win/window_event_proc.h"
+#include "testlib.h"
+
+
+using namespace gui;
+
+#ifdef GUIPP_SDL
+
+namespace {
+
+  typedef std::chrono::steady_clock steady_clock;
+
+  // more than max_actions_per_round, the loop needs several rounds.
+  const int burst_size = 8 * 256 + 10;
+
+  long long run_loop_ms () {
+    const auto start = steady_clock::now();
+    win::run_main_loop();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - start).count();
+  }
+
+}
+
+// --------------------------------------------------------------------------
+void test_burst_from_thread () {
+  const auto main_id = std::this_thread::get_id();
+  int count = 0;
+  bool on_main = true;
+
+  std::thread poster([&] () {
+    for (int i = 0; i < burst_size; ++i) {
+      win::run_on_main([&] () {
+        ++count;
+        on_main &= (std::this_thread::get_id() == main_id);
+      });
+    }
+    win::run_on_main([] () {
+      win::quit_main_loop();
+    });
+  });
+
+  run_loop_ms();
+  poster.join();
+  EXPECT_EQUAL(count, burst_size);
+  EXPECT_TRUE(on_main);
+}
+
+// --------------------------------------------------------------------------
+void test_quit_wakes_loop () {
+  std::thread quitter([] () {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    win::quit_main_loop();
+  });
+
+  // the loop waits up to 250ms, a quit without wake up would only be seen after the timeout.
+  const auto ms = run_loop_ms();
+  quitter.join();
+  EXPECT_TRUE(ms < 200, "quit took ", ms, "ms");
+}
+
+// --------------------------------------------------------------------------
+void test_round_limit_leaves_nothing () {
+  int count = 0;
+  // all posted before the loop runs: a single wake event for several rounds.
+  for (int i = 0; i < burst_size; ++i) {
+    win::run_on_main([&] () {
+      ++count;
+    });
+  }
+  win::run_on_main([] () {
+    win::quit_main_loop();
+  });
+
+  // a round that hits the limit continues without waiting for the next wake up.
+  const auto ms = run_loop_ms();
+  EXPECT_EQUAL(count, burst_size);
+  EXPECT_TRUE(ms < 1000, "draining took ", ms, "ms");
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::init_gui(params);
+  testing::log_info("Running sdl_event_loop_test");
+  run_test(test_burst_from_thread);
+  run_test(test_quit_wakes_loop);
+  run_test(test_round_limit_leaves_nothing);
+  SDL_Quit();
+}
+
+#else
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params&) {
+  testing::log_info("sdl_event_loop_test needs the SDL front end");
+}
+
+#endif // GUIPP_SDL
@@ -0,0 +1,118 @@
+
+#include <chrono>
+#include <set>
+#include <vector>
+
+#include "gui/core/selector.h"
+#include "testlib.h"
+
+
+using namespace gui;
+
+// --------------------------------------------------------------------------
+void test_index_ranges_merge () {
+  core::index_ranges r;
+  r.insert(5, 9);
+  r.insert(20, 24);
+  EXPECT_EQUAL(r.get_ranges().size(), 2);
+  EXPECT_EQUAL(r.size(), 10);
+
+  r.insert(10, 19);
+  EXPECT_EQUAL(r.get_ranges().size(), 1);
+  EXPECT_EQUAL(r.size(), 20);
+  EXPECT_EQUAL(r.front(), 5);
+  EXPECT_EQUAL(r.back(), 24);
+
+  r.erase(12);
+  EXPECT_EQUAL(r.get_ranges().size(), 2);
+  EXPECT_EQUAL(r.size(), 19);
+  EXPECT_TRUE(r.contains(11));
+  EXPECT_TRUE(!r.contains(12));
+  EXPECT_TRUE(r.contains(13));
+
+  r.insert(12);
+  EXPECT_EQUAL(r.get_ranges().size(), 1);
+}
+
+// --------------------------------------------------------------------------
+void test_index_ranges_like_set () {
+  // random inserts and erases must behave like a std::set.
+  core::index_ranges r;
+  std::set<int> s;
+  unsigned int seed = 1;
+  auto next = [&] () {
+    seed = seed * 1103515245 + 12345;
+    return static_cast<int>((seed >> 16) % 64);
+  };
+  for (int i = 0; i < 2000; ++i) {
+    const int a = next();
+    switch (next() % 3) {
+      case 0: {
+        const int b = a + next() % 8;
+        r.insert(a, b);
+        for (int j = a; j <= b; ++j) {
+          s.insert(j);
+        }
+        break;
+      }
+      case 1:
+        r.insert(a);
+        s.insert(a);
+        break;
+      default:
+        r.erase(a);
+        s.erase(a);
+        break;
+    }
+  }
+  EXPECT_EQUAL(r.size(), s.size());
+  EXPECT_TRUE(std::vector<int>(r.begin(), r.end()) == std::vector<int>(s.begin(), s.end()));
+  for (int i = -1; i < 80; ++i) {
+    EXPECT_EQUAL(r.contains(i), s.count(i) == 1, " at ", i);
+  }
+}
+
+// --------------------------------------------------------------------------
+void test_multi_selector () {
+  core::selector::multi m;
+  m.set_selected(3);
+  m.expand_to(6);
+  EXPECT_EQUAL(m.size(), 4);
+  EXPECT_EQUAL(m.get_first_index(), 3);
+  EXPECT_EQUAL(m.get_last_index(), 6);
+
+  const std::vector<char> v = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'};
+  EXPECT_TRUE(core::get_selected_elements(v, m) == std::vector<char>({'d', 'e', 'f', 'g'}));
+
+  m.set_unselected(4);
+  EXPECT_TRUE(core::get_selected_elements(v, m) == std::vector<char>({'d', 'f', 'g'}));
+}
+
+// --------------------------------------------------------------------------
+void test_multi_selector_large_range () {
+  const int count = 5000000;
+  core::selector::multi m;
+
+  const auto start = std::chrono::steady_clock::now();
+  m.select_range(0, count - 1);
+  const auto select_us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+  int selected = 0;
+  for (int i = 0; i < count; ++i) {
+    selected += m.is_selected(i);
+  }
+  const auto total_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+  EXPECT_EQUAL(selected, count);
+  EXPECT_EQUAL(m.size(), count);
+  testing::log_info("select 5M rows: ", select_us, " us, test all: ", total_ms, " ms");
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::log_info("Running selector_test");
+  run_test(test_index_ranges_merge);
+  run_test(test_index_ranges_like_set);
+  run_test(test_multi_selector);
+  run_test(test_multi_selector_large_range);
+}
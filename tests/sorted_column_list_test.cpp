@@ -0,0 +1,116 @@
+
+#include <string>
+
+#include "gui/ctrl/sorted_column_list.h"
+#include "testlib.h"
+
+
+using namespace gui;
+
+typedef ctrl::const_column_list_data<int, std::string> source_data;
+typedef ctrl::sorted_column_list_data<int, std::string> sorted_data;
+
+// --------------------------------------------------------------------------
+source_data::container_type make_rows (int count) {
+  source_data::container_type rows;
+  for (int i = 0; i < count; ++i) {
+    rows.emplace_back((i * 7919) % 100, std::to_string(i % 13));
+  }
+  return rows;
+}
+
+// --------------------------------------------------------------------------
+bool is_sorted_up_down (const sorted_data& v) {
+  for (std::size_t i = 1; i < v.size(); ++i) {
+    const auto a = v.at(i - 1);
+    const auto b = v.at(i);
+    if ((std::get<0>(a) > std::get<0>(b)) ||
+        ((std::get<0>(a) == std::get<0>(b)) && (std::get<1>(a) < std::get<1>(b)))) {
+      return false;
+    }
+    if ((a == b) && (v.source_index(i - 1) > v.source_index(i))) {
+      // equal rows keep the source order.
+      return false;
+    }
+  }
+  return true;
+}
+
+// --------------------------------------------------------------------------
+void test_sort_multi_column () {
+  source_data src(make_rows(50000));
+  sorted_data v;
+  v.set_source(&src);
+  EXPECT_EQUAL(v.size(), 50000);
+  EXPECT_EQUAL(v.source_index(7), 7);
+
+  v.sort({{0, util::sort::order::up}, {1, util::sort::order::down}});
+  EXPECT_TRUE(is_sorted_up_down(v));
+
+  v.sort({});
+  EXPECT_EQUAL(v.source_index(7), 7);
+}
+
+// --------------------------------------------------------------------------
+void test_filter_and_append () {
+  source_data src(make_rows(50000));
+  sorted_data v;
+  v.set_source(&src);
+  v.sort({{0, util::sort::order::up}, {1, util::sort::order::down}});
+  v.set_filter([] (const sorted_data::row_type& r) {
+    return std::get<0>(r) % 2 == 0;
+  });
+  EXPECT_EQUAL(v.size(), 25000);
+
+  auto rows = src.get_data();
+  for (int i = 0; i < 20000; ++i) {
+    rows.emplace_back(i % 100, "x");
+  }
+  src.set_data(rows);
+  v.rows_appended();
+  EXPECT_EQUAL(v.size(), 35000);
+  EXPECT_TRUE(is_sorted_up_down(v));
+  EXPECT_EQUAL(std::get<0>(v.at(v.size() - 1)) % 2, 0);
+}
+
+// --------------------------------------------------------------------------
+struct no_less {
+  int value;
+};
+
+typedef ctrl::const_column_list_data<no_less, int> unsortable_source;
+typedef ctrl::sorted_column_list_data<no_less, int> unsortable_data;
+
+void test_unsortable_column () {
+  unsortable_source::container_type rows;
+  for (int i = 0; i < 20000; ++i) {
+    rows.emplace_back(no_less{i}, (i * 7919) % 100);
+  }
+  unsortable_source src(rows);
+  unsortable_data v(unsortable_data::drawer_type(nullptr, nullptr));
+  v.set_source(&src);
+
+  // a column without operator< keeps the source order.
+  v.sort({{0, util::sort::order::up}});
+  EXPECT_EQUAL(v.source_index(7), 7);
+
+  v.sort({{0, util::sort::order::down}, {1, util::sort::order::up}});
+  bool sorted = true;
+  for (std::size_t i = 1; i < v.size(); ++i) {
+    const auto a = v.at(i - 1);
+    const auto b = v.at(i);
+    if ((std::get<1>(a) > std::get<1>(b)) ||
+        ((std::get<1>(a) == std::get<1>(b)) && (std::get<0>(a).value > std::get<0>(b).value))) {
+      sorted = false;
+    }
+  }
+  EXPECT_TRUE(sorted);
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::log_info("Running sorted_column_list_test");
+  run_test(test_sort_multi_column);
+  run_test(test_filter_and_append);
+  run_test(test_unsortable_column);
+}
@@ -0,0 +1,153 @@
+
+#include <thread>
+
+#include "gui/core/ring_buffer.h"
+#include "gui/ctrl/stream_chart.h"
+#include "image_test_lib.h"
+#include "testlib.h"
+
+
+using namespace gui;
+using namespace testing;
+
+namespace {
+
+  bool is_color (const colormap& m, std::size_t x, std::size_t y, os::color c) {
+    return colorline{m[y][x]} == CM({{c}})[0];
+  }
+
+}
+
+// --------------------------------------------------------------------------
+void test_ring_buffer_wrap () {
+  core::ring_buffer<int, 8> rb;
+  EXPECT_TRUE(rb.empty());
+
+  int data[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  EXPECT_EQUAL(rb.push(data, 10), 8);
+  EXPECT_TRUE(!rb.push(10));
+  EXPECT_EQUAL(rb.size(), 8);
+
+  int out[8] = {};
+  EXPECT_EQUAL(rb.pop(out, 5), 5);
+  EXPECT_EQUAL(out[0], 0);
+  EXPECT_EQUAL(out[4], 4);
+
+  // the next values wrap around the end of the buffer.
+  EXPECT_EQUAL(rb.push(data + 8, 2), 2);
+  EXPECT_TRUE(rb.push(10));
+  EXPECT_EQUAL(rb.size(), 6);
+  EXPECT_EQUAL(rb.pop(out, 8), 6);
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQUAL(out[i], i + 5);
+  }
+  EXPECT_TRUE(rb.empty());
+  EXPECT_EQUAL(rb.pop(out, 8), 0);
+}
+
+// --------------------------------------------------------------------------
+void test_ring_buffer_threads () {
+  core::ring_buffer<int, 64> rb;
+  const int count = 100000;
+
+  std::thread producer([&] () {
+    for (int i = 0; i < count;) {
+      if (rb.push(i)) {
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  int next = 0;
+  bool in_order = true;
+  int buffer[16];
+  while (next < count) {
+    const auto n = rb.pop(buffer, 16);
+    for (std::size_t i = 0; i < n; ++i) {
+      in_order &= (buffer[i] == next++);
+    }
+    if (n == 0) {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(in_order);
+  EXPECT_TRUE(rb.empty());
+}
+
+// --------------------------------------------------------------------------
+void test_plot_columns () {
+  core::global::set_scale_factor(1.0);
+  // range 0 to 5 maps value v to row 5 - v.
+  const ctrl::stream_plot::range_type range(0, 5);
+  ctrl::stream_plot plot(2);
+  plot.resize({5, 6}, color::black);
+  EXPECT_TRUE(!plot.draw(range, color::red, color::black));
+
+  // one sample is no column yet.
+  plot.add(5);
+  EXPECT_TRUE(!plot.draw(range, color::red, color::black));
+
+  plot.add(0);
+  EXPECT_TRUE(plot.draw(range, color::red, color::black));
+  auto m = pixmap2colormap(plot.get_pixmap());
+  for (std::size_t y = 1; y < 5; ++y) {
+    EXPECT_TRUE(is_color(m, 4, y, R), "new column at row ", y);
+    for (std::size_t x = 0; x < 4; ++x) {
+      EXPECT_TRUE(is_color(m, x, y, _), "empty column ", x, " at row ", y);
+    }
+  }
+
+  // the next column moves the first one left by one pixel.
+  plot.add(0);
+  plot.add(2);
+  EXPECT_TRUE(plot.draw(range, color::red, color::black));
+  m = pixmap2colormap(plot.get_pixmap());
+  for (std::size_t y = 1; y < 5; ++y) {
+    EXPECT_TRUE(is_color(m, 3, y, R), "moved column at row ", y);
+    EXPECT_TRUE(is_color(m, 2, y, _), "column 2 at row ", y);
+  }
+  EXPECT_TRUE(is_color(m, 4, 1, _));
+  EXPECT_TRUE(is_color(m, 4, 2, _));
+  EXPECT_TRUE(is_color(m, 4, 4, R));
+}
+
+// --------------------------------------------------------------------------
+void test_plot_overflow () {
+  core::global::set_scale_factor(1.0);
+  const ctrl::stream_plot::range_type range(0, 5);
+  ctrl::stream_plot plot(1);
+  plot.resize({4, 6}, color::black);
+
+  // more columns than pixels: only the newest are drawn.
+  for (int i = 0; i < 10; ++i) {
+    plot.add(i < 6 ? 0 : 5);
+  }
+  EXPECT_TRUE(plot.draw(range, color::red, color::black));
+  const auto m = pixmap2colormap(plot.get_pixmap());
+  for (std::size_t x = 0; x < 4; ++x) {
+    EXPECT_TRUE(is_color(m, x, 0, R), "column ", x, " top");
+    EXPECT_TRUE(is_color(m, x, 5, _), "column ", x, " bottom");
+  }
+
+  // a reset column does not connect to the last one.
+  plot.reset();
+  plot.add(0);
+  EXPECT_TRUE(plot.draw(range, color::red, color::black));
+  const auto m2 = pixmap2colormap(plot.get_pixmap());
+  EXPECT_TRUE(is_color(m2, 3, 5, R));
+  EXPECT_TRUE(is_color(m2, 3, 2, _));
+  EXPECT_TRUE(is_color(m2, 2, 0, R));
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::init_gui(params);
+  testing::log_info("Running stream_chart_test");
+  run_test(test_ring_buffer_wrap);
+  run_test(test_ring_buffer_threads);
+  run_test(test_plot_columns);
+  run_test(test_plot_overflow);
+}
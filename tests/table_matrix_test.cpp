@@ -0,0 +1,93 @@
+
+#include "gui/ctrl/table.h"
+#include "testlib.h"
+
+
+using namespace gui::ctrl::table;
+
+// --------------------------------------------------------------------------
+void test_default_data () {
+  data::matrix<int> m(0);
+  EXPECT_EQUAL(m.get_cell({3, 5}), 0);
+  EXPECT_EQUAL(m.size(), position(0, 0));
+
+  m.set_cell({2, 9}, 1);
+  EXPECT_EQUAL(m.size(), position(3, 10));
+
+  // a new default applies to every unset cell.
+  m.set_default_data(8);
+  EXPECT_EQUAL(m.get_cell({100, 100}), 8);
+  EXPECT_EQUAL(m.get_cell({2, 9}), 1);
+
+  m.clear();
+  EXPECT_EQUAL(m.get_cell({2, 9}), 8);
+}
+
+// --------------------------------------------------------------------------
+void test_row_column_override_cells () {
+  data::matrix<int> m(0);
+  m.set_cell({2, 9}, 1);
+  m.set_cell({7, 3}, 2);
+
+  m.set_row(9, 3);
+  EXPECT_EQUAL(m.get_cell({2, 9}), 3);
+  EXPECT_EQUAL(m.get_cell({50, 9}), 3);
+  EXPECT_EQUAL(m.get_cell({2, 8}), 0);
+
+  m.set_column(7, 4);
+  EXPECT_EQUAL(m.get_cell({7, 3}), 4);
+  EXPECT_EQUAL(m.get_cell({7, 1000}), 4);
+  EXPECT_EQUAL(m.get_cell({6, 3}), 0);
+}
+
+// --------------------------------------------------------------------------
+void test_later_row_column_wins () {
+  data::matrix<int> m(0);
+  m.set_row(5, 1);
+  m.set_column(7, 2);
+  // the column is newer than the row.
+  EXPECT_EQUAL(m.get_cell({7, 5}), 2);
+  // a row set before a column of an other column is not hidden.
+  EXPECT_EQUAL(m.get_cell({3, 5}), 1);
+  EXPECT_EQUAL(m.get_cell({7, 4}), 2);
+
+  m.set_row(5, 3);
+  EXPECT_EQUAL(m.get_cell({7, 5}), 3);
+  EXPECT_EQUAL(m.get_cell({7, 6}), 2);
+
+  m.set_column(7, 5);
+  EXPECT_EQUAL(m.get_cell({7, 5}), 5);
+  EXPECT_EQUAL(m.get_cell({3, 5}), 3);
+}
+
+// --------------------------------------------------------------------------
+void test_later_cell_wins () {
+  data::matrix<int> m(0);
+  m.set_row(5, 1);
+  m.set_column(7, 2);
+
+  m.set_cell({7, 5}, 4);
+  m.set_cell({3, 5}, 6);
+  m.set_cell({7, 9}, 7);
+  EXPECT_EQUAL(m.get_cell({7, 5}), 4);
+  EXPECT_EQUAL(m.get_cell({3, 5}), 6);
+  EXPECT_EQUAL(m.get_cell({7, 9}), 7);
+  // the neighbours keep the row and column values.
+  EXPECT_EQUAL(m.get_cell({4, 5}), 1);
+  EXPECT_EQUAL(m.get_cell({7, 6}), 2);
+
+  // and a later row drops the cells again.
+  m.set_row(5, 8);
+  EXPECT_EQUAL(m.get_cell({7, 5}), 8);
+  EXPECT_EQUAL(m.get_cell({3, 5}), 8);
+  EXPECT_EQUAL(m.get_cell({7, 9}), 7);
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::log_info("Running table_matrix_test");
+  run_test(test_default_data);
+  run_test(test_row_column_override_cells);
+  run_test(test_later_row_column_wins);
+  run_test(test_later_cell_wins);
+}
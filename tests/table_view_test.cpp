@@ -0,0 +1,133 @@
+
+#include "gui/ctrl/table.h"
+#include "gui/draw/graphics.h"
+#include "gui/draw/bitmap.h"
+#include "testlib.h"
+
+
+using namespace gui;
+using namespace gui::ctrl;
+
+namespace {
+
+  struct recorded_cells {
+    std::vector<table::position> cells;
+
+    std::function<table::cell_drawer> drawer () {
+      return [&] (const table::position& cell, draw::graphics&, const core::rectangle&,
+                  const text_origin_t, const os::color&, const os::color&, item_state) {
+        cells.push_back(cell);
+      };
+    }
+  };
+
+  std::vector<table::position> draw_dirty (const table::metric& geometrie, const core::rectangle& dirty) {
+    draw::pixmap img(1, 1);
+    draw::graphics graph(img);
+    const table::data::matrix<text_origin_t> aligns(text_origin_t::center);
+    const table::data::matrix<os::color> colors(color::black);
+    recorded_cells recorder;
+    table::paint::draw_table_data(graph, core::rectangle(0, 0, 800, 200), geometrie, aligns, colors, colors,
+                                  recorder.drawer(), table::filter::data_selection, table::filter::data_hilite,
+                                  dirty);
+    return recorder.cells;
+  }
+
+}
+
+// --------------------------------------------------------------------------
+void test_hilite_damage () {
+  table_view view;
+  view.columns.geometry(core::rectangle(80, 0, 800, 20), false, false);
+  view.rows.geometry(core::rectangle(0, 20, 80, 200), false, false);
+
+  const table::position old_hilite(1, 1);
+  view.geometrie.hilite = table::position(3, 2);
+  auto damage = view.get_hilite_damage(old_hilite);
+  EXPECT_EQUAL(damage.data.size(), 2);
+  EXPECT_EQUAL(damage.data[0], core::rectangle(80, 20, 80, 20));
+  EXPECT_EQUAL(damage.data[1], core::rectangle(240, 40, 80, 20));
+  EXPECT_EQUAL(damage.columns.size(), 2);
+  EXPECT_EQUAL(damage.columns[0], core::rectangle(80, 0, 80, 20));
+  EXPECT_EQUAL(damage.columns[1], core::rectangle(240, 0, 80, 20));
+  EXPECT_EQUAL(damage.rows.size(), 2);
+  EXPECT_EQUAL(damage.rows[0], core::rectangle(0, 20, 80, 20));
+  EXPECT_EQUAL(damage.rows[1], core::rectangle(0, 40, 80, 20));
+
+  // a move inside the row leaves the row header alone.
+  view.geometrie.hilite = table::position(2, 1);
+  damage = view.get_hilite_damage(old_hilite);
+  EXPECT_EQUAL(damage.data.size(), 2);
+  EXPECT_EQUAL(damage.columns.size(), 2);
+  EXPECT_TRUE(damage.rows.empty());
+
+  // leaving the table repaints the old cell only.
+  view.geometrie.hilite = table::position(-1, -1);
+  damage = view.get_hilite_damage(old_hilite);
+  EXPECT_EQUAL(damage.data.size(), 1);
+  EXPECT_EQUAL(damage.data[0], core::rectangle(80, 20, 80, 20));
+
+  // a cell hidden by a spawn repaints the whole spawn.
+  view.geometrie.spawns.set(table::position(0, 0), table::data::spawn(1, 1));
+  view.geometrie.hilite = table::position(3, 2);
+  damage = view.get_hilite_damage(old_hilite);
+  EXPECT_EQUAL(damage.data[0], core::rectangle(0, 0, 160, 40));
+}
+
+// --------------------------------------------------------------------------
+void test_paint_skips_clean_cells () {
+  table::metric geometrie(80, 20);
+  geometrie.hilite = table::position(3, 2);
+
+  // every cell whose hilite state changed is inside the damage, no other cell is drawn.
+  const std::vector<core::rectangle> damage = {core::rectangle(80, 20, 80, 20), core::rectangle(240, 40, 80, 20)};
+  std::vector<table::position> drawn;
+  for (const auto& dirty : damage) {
+    const auto cells = draw_dirty(geometrie, dirty);
+    drawn.insert(drawn.end(), cells.begin(), cells.end());
+  }
+  EXPECT_EQUAL(drawn.size(), 2);
+  EXPECT_EQUAL(drawn[0], table::position(1, 1));
+  EXPECT_EQUAL(drawn[1], table::position(3, 2));
+
+  // a dirty area over a cell border draws both cells.
+  auto cells = draw_dirty(geometrie, core::rectangle(150, 10, 20, 5));
+  EXPECT_EQUAL(cells.size(), 2);
+  EXPECT_EQUAL(cells[0], table::position(1, 0));
+  EXPECT_EQUAL(cells[1], table::position(2, 0));
+
+  EXPECT_TRUE(draw_dirty(geometrie, core::rectangle::zero).empty());
+
+  // a spawn reaching into the dirty area is drawn once from its hidden cells.
+  geometrie.spawns.set(table::position(0, 0), table::data::spawn(1, 1));
+  cells = draw_dirty(geometrie, core::rectangle(90, 30, 10, 5));
+  EXPECT_EQUAL(cells.size(), 1);
+  EXPECT_EQUAL(cells[0], table::position(0, 0));
+}
+
+// --------------------------------------------------------------------------
+void test_custom_hilite_filter () {
+  table_view view;
+  EXPECT_TRUE(view.has_default_hilite_filters());
+
+  // hilites the whole row, the partial repaint would miss cells.
+  view.data.set_hilite_filter([] (const table::position& cell, const table::metric& geometrie) {
+    return cell.y() == geometrie.hilite.y();
+  });
+  EXPECT_TRUE(!view.has_default_hilite_filters());
+
+  view.data.set_hilite_filter(table::filter::data_hilite);
+  EXPECT_TRUE(view.has_default_hilite_filters());
+
+  view.rows.set_hilite_filter(table::filter::column_hilite);
+  EXPECT_TRUE(!view.has_default_hilite_filters());
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::init_gui(params);
+  testing::log_info("Running table_view_test");
+  run_test(test_hilite_damage);
+  run_test(test_paint_skips_clean_cells);
+  run_test(test_custom_hilite_filter);
+}
@@ -0,0 +1,141 @@
+
+#include <atomic>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "gui/core/tracing.h"
+#include "testlib.h"
+
+
+using namespace gui::core;
+
+namespace {
+
+  std::size_t count_of (const std::string& text, const std::string& what) {
+    std::size_t n = 0;
+    for (auto pos = text.find(what); pos != std::string::npos; pos = text.find(what, pos + what.size())) {
+      ++n;
+    }
+    return n;
+  }
+
+  std::string export_trace () {
+    std::ostringstream out;
+    tracing::write_chrome_trace(out);
+    return out.str();
+  }
+
+  // records of a fresh thread get a buffer of their own.
+  template<typename F>
+  void in_thread (F f) {
+    std::thread t(f);
+    t.join();
+  }
+
+}
+
+// --------------------------------------------------------------------------
+void test_export () {
+  tracing::clear();
+  in_thread([] () {
+    tracing::record({"export_a", nullptr, 1000, 3500, tracing::category::paint});
+    tracing::record({"export_b", nullptr, 4000, 5000, tracing::category::layout});
+  });
+  const auto json = export_trace();
+  EXPECT_EQUAL(count_of(json, "\"ph\":\"X\""), 2);
+  EXPECT_EQUAL(count_of(json, "\"name\":\"export_a\",\"cat\":\"paint\""), 1);
+  EXPECT_EQUAL(count_of(json, "\"name\":\"export_b\",\"cat\":\"layout\""), 1);
+  EXPECT_EQUAL(count_of(json, "\"ts\":1.0,\"dur\":2.5"), 1);
+}
+
+// --------------------------------------------------------------------------
+void test_wraparound () {
+  tracing::clear();
+  in_thread([] () {
+    for (int i = 0; i < 10; ++i) {
+      tracing::record({"wrap_old", nullptr, 1, 2, tracing::category::event});
+    }
+    for (std::size_t i = 0; i < tracing::buffer_capacity; ++i) {
+      tracing::record({"wrap_new", nullptr, 1, 2, tracing::category::event});
+    }
+  });
+  const auto json = export_trace();
+  EXPECT_EQUAL(count_of(json, "\"ph\":\"X\""), tracing::buffer_capacity);
+  EXPECT_EQUAL(count_of(json, "wrap_old"), 0);
+  EXPECT_EQUAL(count_of(json, "wrap_new"), tracing::buffer_capacity);
+}
+
+// --------------------------------------------------------------------------
+void test_clear () {
+  in_thread([] () {
+    tracing::record({"clear_a", nullptr, 1, 2, tracing::category::event});
+  });
+  tracing::clear();
+  EXPECT_EQUAL(count_of(export_trace(), "\"ph\":\"X\""), 0);
+}
+
+// --------------------------------------------------------------------------
+void test_finished_threads () {
+  tracing::clear();
+  EXPECT_EQUAL(tracing::buffer_count(), 0);
+
+  // finished threads keep their records until they are cleared.
+  for (int i = 0; i < 10; ++i) {
+    in_thread([] () {
+      tracing::record({"finished", nullptr, 1, 2, tracing::category::event});
+    });
+  }
+  EXPECT_EQUAL(tracing::buffer_count(), 10);
+  EXPECT_EQUAL(count_of(export_trace(), "finished"), 10);
+
+  tracing::clear();
+  EXPECT_EQUAL(tracing::buffer_count(), 0);
+
+  // a new thread gets a recycled buffer, without the old records.
+  for (int i = 0; i < 100; ++i) {
+    in_thread([] () {
+      tracing::record({"recycled", nullptr, 1, 2, tracing::category::event});
+    });
+    tracing::clear();
+  }
+  EXPECT_EQUAL(tracing::buffer_count(), 0);
+
+  in_thread([] () {
+    tracing::record({"last", nullptr, 1, 2, tracing::category::event});
+  });
+  const auto json = export_trace();
+  EXPECT_EQUAL(count_of(json, "\"ph\":\"X\""), 1);
+  EXPECT_EQUAL(count_of(json, "last"), 1);
+  EXPECT_EQUAL(tracing::buffer_count(), 1);
+  tracing::clear();
+}
+
+// --------------------------------------------------------------------------
+void test_export_while_recording () {
+  tracing::clear();
+  std::atomic_bool stop(false);
+  std::thread writer([&] () {
+    while (!stop) {
+      tracing::record({"busy", nullptr, 1, 2, tracing::category::action});
+    }
+  });
+  // every exported record must be complete.
+  for (int i = 0; i < 20; ++i) {
+    const auto json = export_trace();
+    EXPECT_EQUAL(count_of(json, "\"ph\":\"X\""), count_of(json, "\"name\":\"busy\",\"cat\":\"action\""));
+    tracing::clear();
+  }
+  stop = true;
+  writer.join();
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::log_info("Running tracing_test");
+  run_test(test_export);
+  run_test(test_wraparound);
+  run_test(test_clear);
+  run_test(test_finished_threads);
+  run_test(test_export_while_recording);
+}
@@ -0,0 +1,316 @@
+
+#include <chrono>
+#include <map>
+#include <random>
+#include <set>
+
+#include "gui/ctrl/tree.h"
+#include "testlib.h"
+
+
+using namespace gui;
+
+typedef ctrl::tree::default_node_info::reference reference;
+
+namespace {
+
+  ctrl::tree::node make_tree (int depth, int width, const std::string& label) {
+    ctrl::tree::node n(label);
+    if (depth > 0) {
+      for (int i = 0; i < width; ++i) {
+        n.add_node(make_tree(depth - 1, width, label + "." + std::to_string(i)));
+      }
+    }
+    return n;
+  }
+
+  int linear_index_of (const ctrl::tree_view& t, reference ref) {
+    for (int i = 0; i < t.size(); ++i) {
+      if (t.get_item(i) == ref) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  template<typename T>
+  void collect_visible (const T& t, std::vector<reference>& items, std::vector<int>& parents) {
+    items.clear();
+    parents.clear();
+    for (int i = 0; i < t.size(); ++i) {
+      items.push_back(t.get_item(i));
+      parents.push_back(const_cast<T&>(t).get_parent_item_of(i));
+    }
+  }
+
+}
+
+// --------------------------------------------------------------------------
+void test_splice_parents () {
+  ctrl::tree_view t;
+  t.set_root(make_tree(3, 3, "r"));
+  t.update_node_list();
+  EXPECT_EQUAL(t.size(), 1);
+
+  const ctrl::tree::node& r = t.get_root();
+  const ctrl::tree::node& a = r.nodes()[0];
+  const ctrl::tree::node& b = r.nodes()[1];
+  const ctrl::tree::node& c = r.nodes()[2];
+
+  t.open_node(&r);
+  EXPECT_EQUAL(t.size(), 4);
+  EXPECT_EQUAL(t.get_parent_item_of(3), 0);
+
+  // r, a, b, b.0, b.1, b.2, c
+  t.open_node(&b);
+  EXPECT_EQUAL(t.size(), 7);
+  EXPECT_TRUE(t.get_item(3) == &b.nodes()[0]);
+  EXPECT_EQUAL(t.get_parent_item_of(3), 2);
+  EXPECT_EQUAL(t.get_parent_item_of(6), 0);
+
+  // r, a, a.0, a.1, a.2, b, b.0, b.1, b.2, c
+  t.open_node(&a);
+  EXPECT_EQUAL(t.size(), 10);
+  EXPECT_TRUE(t.get_item(6) == &b.nodes()[0]);
+  EXPECT_EQUAL(t.get_parent_item_of(6), 5);
+  EXPECT_EQUAL(t.get_parent_item_of(4), 1);
+  EXPECT_TRUE(t.get_item(9) == &c);
+
+  // r, a, a.0, a.0.0, a.0.1, a.0.2, a.1, a.2, b, ...
+  t.open_node(&a.nodes()[0]);
+  EXPECT_EQUAL(t.size(), 13);
+  EXPECT_EQUAL(t.get_parent_item_of(4), 2);
+  EXPECT_EQUAL(t.get_parent_item_of(9), 8);
+
+  t.close_node(&a);
+  EXPECT_EQUAL(t.size(), 7);
+  EXPECT_TRUE(t.get_item(3) == &b.nodes()[0]);
+  EXPECT_EQUAL(t.get_parent_item_of(3), 2);
+
+  // a.0 stays open.
+  t.toggle_node(&a);
+  EXPECT_EQUAL(t.size(), 13);
+  EXPECT_TRUE(t.get_item(3) == &a.nodes()[0].nodes()[0]);
+
+  t.close_node(&c);
+  t.open_node(&c);
+  EXPECT_EQUAL(t.size(), 16);
+  EXPECT_EQUAL(t.get_parent_item_of(15), 12);
+}
+
+// --------------------------------------------------------------------------
+void test_splice_matches_rebuild () {
+  ctrl::tree_view t;
+  t.set_root(make_tree(5, 4, "r"));
+  t.update_node_list();
+
+  std::mt19937 rnd(43);
+  std::vector<reference> items, rebuilt_items;
+  std::vector<int> parents, rebuilt_parents;
+  for (int n = 0; n < 500; ++n) {
+    const reference ref = t.get_item(static_cast<int>(rnd() % t.size()));
+    const int idx = linear_index_of(t, ref);
+    if (t.is_open(ref)) {
+      t.close_node(ref);
+      EXPECT_TRUE(!t.is_open(ref));
+    } else {
+      t.open_node(ref);
+      if (!ref->nodes().empty()) {
+        // the node was found at its current position.
+        EXPECT_TRUE(t.get_item(idx + 1) == &ref->nodes()[0], "open ", ref->label(), " at ", idx);
+      }
+    }
+    if (n % 50 == 0) {
+      collect_visible(t, items, parents);
+      t.update_node_list();
+      collect_visible(t, rebuilt_items, rebuilt_parents);
+      EXPECT_TRUE(items == rebuilt_items, "items differ after ", n, " toggles");
+      EXPECT_TRUE(parents == rebuilt_parents, "parents differ after ", n, " toggles");
+    }
+  }
+  testing::log_info("visible nodes after 500 toggles: ", t.size());
+}
+
+// --------------------------------------------------------------------------
+void test_large_tree_splice () {
+  typedef std::chrono::steady_clock clock_type;
+  ctrl::tree_view t;
+  t.set_root(make_tree(2, 300, "r"));
+  t.update_node_list();
+
+  const ctrl::tree::node& r = t.get_root();
+  t.open_node(&r);
+  for (const auto& n : r.nodes()) {
+    t.open_node(&n);
+  }
+  EXPECT_EQUAL(t.size(), 1 + 300 + 300 * 300);
+
+  // a node near the top moves nearly all indices on each toggle.
+  const reference top = &r.nodes()[1];
+  const int toggles = 100;
+  auto start = clock_type::now();
+  for (int i = 0; i < toggles; ++i) {
+    t.toggle_node(top);
+  }
+  const auto splice_time = (clock_type::now() - start) / toggles;
+
+  std::vector<reference> items, rebuilt_items;
+  std::vector<int> parents, rebuilt_parents;
+  collect_visible(t, items, parents);
+  start = clock_type::now();
+  t.update_node_list();
+  const auto rebuild_time = clock_type::now() - start;
+  collect_visible(t, rebuilt_items, rebuilt_parents);
+  EXPECT_TRUE(items == rebuilt_items);
+  EXPECT_TRUE(parents == rebuilt_parents);
+
+  typedef std::chrono::microseconds us;
+  testing::log_info("toggle of ", t.size(), " nodes: ",
+                    std::chrono::duration_cast<us>(splice_time).count(), "us, rebuild: ",
+                    std::chrono::duration_cast<us>(rebuild_time).count(), "us");
+  EXPECT_TRUE(splice_time < rebuild_time);
+}
+
+// --------------------------------------------------------------------------
+namespace {
+
+  // sub nodes are loaded when the test finishes their load.
+  struct async_node_info : public ctrl::tree::default_node_info {
+    static constexpr bool async_loading = true;
+
+    bool is_loaded (const ctrl::tree::node& n) const {
+      return n.nodes().empty() || (loaded.find(&n) != loaded.end());
+    }
+
+    void load_sub_nodes (const win::window&, const ctrl::tree::node& n, std::function<void()> ready, bool prefetch) {
+      requests[&n] = ready;
+      if (prefetch) {
+        ++prefetches;
+      }
+    }
+
+    void cancel_load (const ctrl::tree::node& n) {
+      requests.erase(&n);
+    }
+
+    void pin (const ctrl::tree::node& n) {
+      pinned.insert(&n);
+    }
+
+    void invalidate (const ctrl::tree::node& n) {
+      pinned.erase(&n);
+      loaded.erase(&n);
+    }
+
+    bool finish (reference ref) {
+      auto i = requests.find(ref);
+      if (i == requests.end()) {
+        return false;
+      }
+      auto ready = i->second;
+      requests.erase(i);
+      loaded.insert(ref);
+      ready();
+      return true;
+    }
+
+    std::set<reference> loaded;
+    std::set<reference> pinned;
+    std::map<reference, std::function<void()>> requests;
+    int prefetches = 0;
+  };
+
+  typedef ctrl::tree::basic_tree<async_node_info> async_tree;
+
+}
+
+// --------------------------------------------------------------------------
+void test_async_placeholder () {
+  async_tree t;
+  t.set_root(make_tree(3, 3, "r"));
+  t.update_node_list();
+
+  const ctrl::tree::node& r = t.get_root();
+  const ctrl::tree::node& a = r.nodes()[0];
+  const ctrl::tree::node& b = r.nodes()[1];
+
+  // r, placeholder
+  t.open_node(&r);
+  EXPECT_EQUAL(t.size(), 2);
+  EXPECT_EQUAL(t.info().requests.size(), 1);
+  EXPECT_TRUE(t.info().pinned.find(&r) != t.info().pinned.end());
+
+  // r, a, b, c and the sub nodes of a, b and c are prefetched.
+  EXPECT_TRUE(t.info().finish(&r));
+  EXPECT_EQUAL(t.size(), 4);
+  EXPECT_TRUE(t.get_item(3) == &r.nodes()[2]);
+  EXPECT_EQUAL(t.get_parent_item_of(3), 0);
+  EXPECT_EQUAL(t.info().prefetches, 3);
+
+  // r, b, placeholder, c, then r, b, b.0, b.1, b.2, c
+  t.open_node(&b);
+  EXPECT_EQUAL(t.size(), 5);
+  EXPECT_TRUE(t.info().finish(&b));
+  EXPECT_EQUAL(t.size(), 7);
+  EXPECT_TRUE(t.get_item(3) == &b.nodes()[0]);
+  EXPECT_EQUAL(t.get_parent_item_of(5), 2);
+  EXPECT_EQUAL(t.get_parent_item_of(6), 0);
+
+  // a prefetched node opens without placeholder.
+  EXPECT_TRUE(t.info().finish(&a));
+  t.open_node(&a);
+  EXPECT_EQUAL(t.size(), 10);
+  EXPECT_EQUAL(t.get_parent_item_of(6), 5);
+
+  // closing drops the loaded sub nodes, they are loaded again.
+  t.close_node(&b);
+  EXPECT_TRUE(t.info().loaded.find(&b) == t.info().loaded.end());
+  EXPECT_TRUE(t.info().pinned.find(&b) == t.info().pinned.end());
+  t.open_node(&b);
+  EXPECT_EQUAL(t.size(), 8);
+  EXPECT_TRUE(t.info().finish(&b));
+  EXPECT_EQUAL(t.size(), 10);
+
+  // closing a node cancels the loads below it.
+  t.open_node(&a.nodes()[1]);
+  EXPECT_TRUE(t.info().requests.find(&a.nodes()[1]) != t.info().requests.end());
+  t.close_node(&a);
+  EXPECT_TRUE(t.info().requests.find(&a.nodes()[1]) == t.info().requests.end());
+  EXPECT_EQUAL(t.size(), 7);
+}
+
+// --------------------------------------------------------------------------
+void test_async_open_all () {
+  async_tree t;
+  t.set_root(make_tree(2, 3, "r"));
+  t.open_all();
+  t.update_node_list();
+  EXPECT_EQUAL(t.size(), 2);
+
+  // the sub nodes open when they arrive, until all 13 nodes are shown.
+  int loads = 0;
+  while (!t.info().requests.empty()) {
+    t.info().finish(t.info().requests.begin()->first);
+    ++loads;
+  }
+  EXPECT_EQUAL(loads, 4);
+  EXPECT_EQUAL(t.size(), 13);
+
+  std::vector<reference> items, rebuilt_items;
+  std::vector<int> parents, rebuilt_parents;
+  collect_visible(t, items, parents);
+  t.update_node_list();
+  collect_visible(t, rebuilt_items, rebuilt_parents);
+  EXPECT_TRUE(items == rebuilt_items);
+  EXPECT_TRUE(parents == rebuilt_parents);
+}
+
+// --------------------------------------------------------------------------
+void test_main (const testing::start_params& params) {
+  testing::log_info("Running tree_view_test");
+  run_test(test_splice_parents);
+  run_test(test_splice_matches_rebuild);
+  run_test(test_large_tree_splice);
+  run_test(test_async_placeholder);
+  run_test(test_async_open_all);
+}
@@ -1,6 +1,11 @@
 
 
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
 #include <util/command_line.h>
+#include <util/ostreamfmt.h>
 #include <util/sys_fs.h>
 #include "gui/io/pnm_to_src.h"
 
@@ -12,12 +17,49 @@ using namespace gui::draw;
 enum class Target {
   Source,
   Ascii,
-  Binary
+  Binary,
+  Raw
 };
 
+// --------------------------------------------------------------------------
+std::string scale_name (const std::string& stem, float f) {
+  std::string name = ostreamfmt(stem << '_' << f << 'x');
+  std::replace(name.begin(), name.end(), '.', '_');
+  return name;
+}
+
+template<pixel_format_t T>
+void save_raw (const std::string& fname, const datamap<T>& img, const std::string& stem,
+               float input_scale, const std::vector<float>& scales) {
+  std::ofstream out(fname);
+  out << "// generated by pnm2src, do not edit." << std::endl;
+  for (const float f : scales) {
+    if (f == input_scale) {
+      src::save_raw_src(out, img.get_data(), scale_name(stem, f));
+    } else {
+      datamap<T> scaled(img.native_size() * (f / input_scale));
+      scaled.stretch_from(img);
+      src::save_raw_src(out, scaled.get_data(), scale_name(stem, f));
+    }
+  }
+}
+
+std::vector<float> parse_scales (const std::string& arg) {
+  std::vector<float> scales;
+  std::istringstream in(arg);
+  std::string f;
+  while (std::getline(in, f, ',')) {
+    scales.push_back(std::stof(f));
+  }
+  return scales;
+}
+
 // --------------------------------------------------------------------------
 int gui_main(const std::vector<std::string>& args) {
   Target t = Target::Source;
+  bool to_rgb = false;
+  float input_scale = 1.0F;
+  std::vector<float> scales;
 
   util::command_line::parser cmd("pnm2src", {
     {"-a", "--asscii", {}, "write pnm 2 ascii pnm",
@@ -35,10 +77,34 @@ int gui_main(const std::vector<std::string>& args) {
         t = Target::Source;
       }
     },
+    {"-r", "--raw", {}, "write pnm 2 raw pixel source header",
+      [&](const std::string&) {
+        t = Target::Raw;
+      }
+    },
+    {"-c", "--rgb", {}, "convert to rgb before writing raw pixels",
+      [&](const std::string&) {
+        to_rgb = true;
+      }
+    },
+    {"-i", "--input-scale", "<factor>", "scale factor the input image was drawn for, default 1",
+      [&](const std::string& arg) {
+        input_scale = std::stof(arg);
+      }
+    },
+    {"-x", "--scales", "<f1,f2,..>", "comma separated scale factors to write raw pixels for, default input scale",
+      [&](const std::string& arg) {
+        scales = parse_scales(arg);
+      }
+    },
   });
 
   cmd.process(args);
 
+  if (scales.empty()) {
+    scales.push_back(input_scale);
+  }
+
   bool first = true;
   for (const auto& f: cmd.remaining_args()) {
     if (first) {
@@ -60,6 +126,25 @@ int gui_main(const std::vector<std::string>& args) {
         src::save_pnm_src(src, bmp, stem);
         break;
       }
+      case Target::Raw: {
+        p.replace_extension();
+        auto src = p.string() + "_raw.h";
+        logging::info() << "Convert " << f << " to " << src;
+        if (to_rgb) {
+          save_raw(src, bmp.convert<F::RGB>(), stem, input_scale, scales);
+        } else {
+          switch (bmp.pixel_format()) {
+            case F::BW: save_raw(src, bmp.convert<F::BW>(), stem, input_scale, scales); break;
+            case F::GRAY: save_raw(src, bmp.convert<F::GRAY>(), stem, input_scale, scales); break;
+            case F::RGB: save_raw(src, bmp.convert<F::RGB>(), stem, input_scale, scales); break;
+            default:
+              logging::error() << "Unsupported pixel format " << static_cast<int>(bmp.pixel_format())
+                               << " in " << f << ", use -c to convert to rgb";
+              return 1;
+          }
+        }
+        break;
+      }
       case Target::Ascii: {
         p.replace_extension(".ascii" + p.extension().string());
         auto out = p.string();